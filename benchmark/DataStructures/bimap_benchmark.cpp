@@ -0,0 +1,78 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Benchmark.h"
+#include "BiMap.h"
+#include "FlatBiMap.h"
+#include "StringHash.h"
+
+namespace {
+
+    /**
+     * Intern names as ids, then look names up by id and ids up by name, as a string interning table does.
+     * @tparam Map
+     * @param name
+     * @param names
+     * @param reserve Reserve space for every name first
+     */
+    template<typename Map>
+    void runInterning(const std::string& name, const std::vector<std::string>& names, bool reserve) {
+        Map map;
+        if constexpr (std::is_same_v<Map, wtl::FlatBiMap<std::string, std::size_t, wtl::StringHash>>) {
+            if (reserve) {
+                map.reserve(names.size());
+            }
+        }
+        wtl_bench::measure(name + " insert", names.size(), [&]() {
+            for (std::size_t i = 0; i < names.size(); i++) {
+                map.insert(names[i], i);
+            }
+        });
+        std::size_t found = 0;
+        wtl_bench::measure(name + " name -> id", names.size(), [&]() {
+            for (std::size_t i = names.size(); i > 0; i--) {
+                found += map.find(names[(i * 7919) % names.size()]).value();
+            }
+        });
+        wtl_bench::measure(name + " id -> name", names.size(), [&]() {
+            for (std::size_t i = names.size(); i > 0; i--) {
+                found += map.find((i * 7919) % names.size()).value().get().size();
+            }
+        });
+        wtl_bench::doNotOptimize(found);
+    }
+
+}
+
+int main() {
+    for (std::size_t count : {std::size_t{1} << 14, std::size_t{1} << 20}) {
+        std::vector<std::uint64_t> keys = wtl_bench::randomKeys(count);
+        std::vector<std::string> names;
+        names.reserve(count);
+        for (std::uint64_t key : keys) {
+            names.push_back("symbol_" + std::to_string(key));
+        }
+
+        wtl_bench::section("Interning " + std::to_string(count) + " names");
+        runInterning<wtl::BiMap<std::string, std::size_t>>("BiMap", names, false);
+        runInterning<wtl::FlatBiMap<std::string, std::size_t, wtl::StringHash>>("FlatBiMap", names, false);
+        runInterning<wtl::FlatBiMap<std::string, std::size_t, wtl::StringHash>>("FlatBiMap reserved", names, true);
+
+        wtl::FlatBiMap<std::string, std::size_t, wtl::StringHash> map;
+        for (std::size_t i = 0; i < names.size(); i++) {
+            map.insert(names[i], i);
+        }
+        std::printf("%-56s %12.2f bytes/entry\n", "FlatBiMap memory", map.getMemoryPerEntry());
+        map.shrinkToFit();
+        std::printf("%-56s %12.2f bytes/entry\n", "FlatBiMap memory after shrinkToFit", map.getMemoryPerEntry());
+    }
+    return 0;
+}
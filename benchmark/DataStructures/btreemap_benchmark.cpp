@@ -0,0 +1,171 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "BinarySearchTree.h"
+#include "BTreeMap.h"
+#include "TreeMap.h"
+
+namespace {
+
+    using Key = std::uint64_t;
+    using Value = std::uint32_t;
+
+    /**
+     * Look up a key in any of the maps being compared.
+     */
+    bool lookup(wtl::BinarySearchTree<Key, Value>& map, Key key) {
+        return map.get(key).has_value();
+    }
+
+    bool lookup(std::map<Key, Value>& map, Key key) {
+        return map.find(key) != map.end();
+    }
+
+    template<typename Map>
+    bool lookup(Map& map, Key key) {
+        return map.contains(key);
+    }
+
+    void insert(std::map<Key, Value>& map, Key key) {
+        map.emplace(key, static_cast<Value>(key));
+    }
+
+    template<typename Map>
+    void insert(Map& map, Key key) {
+        map.insert(key, static_cast<Value>(key));
+    }
+
+    /**
+     * Insert random keys, look each of them up in a different random order, then destroy the map.
+     * @tparam Map
+     * @param name
+     * @param keys
+     * @param probes
+     */
+    template<typename Map>
+    void runRandom(const std::string& name, const std::vector<Key>& keys, const std::vector<Key>& probes) {
+        Map map;
+        wtl_bench::measure(name + " insert", keys.size(), [&]() {
+            for (Key key : keys) {
+                insert(map, key);
+            }
+        });
+        wtl_bench::measure(name + " lookup", probes.size(), [&]() {
+            std::size_t found = 0;
+            for (Key key : probes) {
+                found += lookup(map, key);
+            }
+            wtl_bench::doNotOptimize(found);
+        });
+        wtl_bench::measure(name + " destroy", keys.size(), [&]() {
+            Map moved(std::move(map));
+        });
+    }
+
+    /**
+     * Sum the values of many short ranges of keys.
+     * @tparam Map
+     * @param name
+     * @param map
+     * @param starts First key of each range
+     * @param width Number of keys in each range
+     */
+    template<typename Map>
+    void runRanges(const std::string& name, const Map& map, const std::vector<Key>& starts, std::size_t width) {
+        wtl_bench::measure(name + " range scan x" + std::to_string(width), starts.size() * width, [&]() {
+            std::uint64_t sum = 0;
+            for (Key start : starts) {
+                auto iterator = map.lowerBound(start);
+                for (std::size_t i = 0; i < width && iterator != map.end(); i++, ++iterator) {
+                    sum += iterator->second;
+                }
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+    }
+
+    void runRanges(const std::string& name, const std::map<Key, Value>& map, const std::vector<Key>& starts,
+                   std::size_t width) {
+        wtl_bench::measure(name + " range scan x" + std::to_string(width), starts.size() * width, [&]() {
+            std::uint64_t sum = 0;
+            for (Key start : starts) {
+                auto iterator = map.lower_bound(start);
+                for (std::size_t i = 0; i < width && iterator != map.end(); i++, ++iterator) {
+                    sum += iterator->second;
+                }
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+    }
+
+}
+
+int main() {
+    constexpr std::size_t count = 1000000;
+    std::vector<Key> keys = wtl_bench::randomKeys(count);
+    std::vector<Key> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), std::mt19937_64(7));
+
+    wtl_bench::section("Random keys");
+    runRandom<wtl::BinarySearchTree<Key, Value>>("BinarySearchTree", keys, probes);
+    runRandom<std::map<Key, Value>>("std::map", keys, probes);
+    runRandom<wtl::TreeMap<Key, Value>>("TreeMap", keys, probes);
+    runRandom<wtl::BTreeMap<Key, Value>>("BTreeMap", keys, probes);
+
+    std::vector<std::pair<Key, Value>> sorted;
+    for (Key key : keys) {
+        sorted.emplace_back(key, static_cast<Value>(key));
+    }
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+    wtl_bench::section("Building from sorted keys");
+    std::map<Key, Value> stdMap;
+    wtl_bench::measure("std::map insert with hint", sorted.size(), [&]() {
+        for (const auto& pair : sorted) {
+            stdMap.emplace_hint(stdMap.end(), pair);
+        }
+    });
+    wtl::TreeMap<Key, Value> treeMap;
+    wtl_bench::measure("TreeMap insert", sorted.size(), [&]() {
+        for (const auto&[key, value] : sorted) {
+            treeMap.insert(key, value);
+        }
+    });
+    wtl::BTreeMap<Key, Value> bTreeMap;
+    wtl_bench::measure("BTreeMap bulkLoad", sorted.size(), [&]() {
+        bTreeMap.bulkLoad(sorted.begin(), sorted.end());
+    });
+
+    wtl_bench::section("Range scans");
+    std::vector<Key> starts(probes.begin(), probes.begin() + count / 100);
+    for (std::size_t width : {16, 256}) {
+        runRanges("std::map", stdMap, starts, width);
+        runRanges("TreeMap", treeMap, starts, width);
+        runRanges("BTreeMap", bTreeMap, starts, width);
+        wtl_bench::measure("BTreeMap forEachInRange x" + std::to_string(width), starts.size() * width, [&]() {
+            // Ranges of keys covering about width keys each, since the keys are uniformly distributed.
+            std::uint64_t sum = 0;
+            Key span = (~Key(0) / count) * width;
+            for (Key start : starts) {
+                Key end = start > ~Key(0) - span ? ~Key(0) : start + span;
+                bTreeMap.forEachInRange(start, end, [&sum](const Key&, Value& value) {
+                    sum += value;
+                });
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "ConcurrentFenwickTree.h"
+#include "FenwickTree.h"
+
+namespace {
+
+    using Count = std::uint64_t;
+
+    constexpr std::size_t BUCKETS = 4096;
+
+    /**
+     * Fenwick tree behind a single mutex, which is how the histogram was shared between threads before.
+     */
+    class LockedFenwickTree {
+    private:
+        mutable std::mutex m_Mutex;
+        wtl::FenwickTree<Count> m_Tree;
+
+    public:
+        explicit LockedFenwickTree(std::size_t size) : m_Tree(std::vector<Count>(size, 0)) {}
+
+        void update(std::size_t index, Count value) {
+            std::lock_guard lock(m_Mutex);
+            m_Tree.update(index, value);
+        }
+
+        Count query(std::size_t index) const {
+            std::lock_guard lock(m_Mutex);
+            return m_Tree.query(index);
+        }
+
+        void fold() {}
+    };
+
+    /**
+     * Run a function on the specified number of threads at once and wait for all of them.
+     * @tparam Func Callable taking the index of the thread
+     * @param threadCount
+     * @param func
+     */
+    template<typename Func>
+    void runThreads(std::size_t threadCount, Func&& func) {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < threadCount; t++) {
+            threads.emplace_back(func, t);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Every thread updates random buckets, and every one in readEvery operations is a prefix query instead. The
+     * reported time is per operation, so Mop/s is the total throughput.
+     * @tparam Tree
+     * @param name
+     * @param tree
+     * @param threadCount
+     * @param operations
+     * @param readEvery
+     */
+    template<typename Tree>
+    void run(const std::string& name, Tree& tree, std::size_t threadCount, std::size_t operations,
+             std::size_t readEvery) {
+        std::vector<std::uint64_t> keys = wtl_bench::randomKeys(operations);
+        wtl_bench::measure(name + ", " + std::to_string(threadCount) + " threads", operations, [&]() {
+            runThreads(threadCount, [&](std::size_t t) {
+                Count sum = 0;
+                for (std::size_t i = t; i < operations; i += threadCount) {
+                    std::size_t bucket = keys[i] % BUCKETS;
+                    if (i % readEvery == 0) {
+                        sum += tree.query(bucket);
+                    } else {
+                        tree.update(bucket, 1);
+                    }
+                }
+                wtl_bench::doNotOptimize(sum);
+            });
+        });
+        tree.fold();
+    }
+
+}
+
+int main() {
+    constexpr std::size_t operations = 4000000;
+    for (std::size_t readEvery : {std::size_t(1000000000), std::size_t(10)}) {
+        wtl_bench::section(readEvery > operations ? "Updates only" : "90% updates, 10% prefix queries");
+        for (std::size_t threads = 1; threads <= 64; threads *= 2) {
+            LockedFenwickTree locked(BUCKETS);
+            wtl::ConcurrentFenwickTree<Count> atomic(BUCKETS);
+            wtl::ConcurrentFenwickTree<Count> striped(BUCKETS, threads);
+            run("FenwickTree + mutex", locked, threads, operations, readEvery);
+            run("ConcurrentFenwickTree", atomic, threads, operations, readEvery);
+            run("ConcurrentFenwickTree, " + std::to_string(threads) + " stripes", striped, threads, operations,
+                readEvery);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "ConcurrentMap.h"
+#include "UnorderedMap.h"
+
+namespace {
+
+    using Key = std::uint64_t;
+
+    /**
+     * UnorderedMap behind a single mutex, which is what callers had to do before ConcurrentMap existed.
+     */
+    class LockedUnorderedMap {
+    private:
+        mutable std::mutex m_Mutex;
+        wtl::UnorderedMap<Key, Key> m_Map;
+
+    public:
+        bool insert(Key key, Key value) {
+            std::lock_guard lock(m_Mutex);
+            return m_Map.insert(key, value).second;
+        }
+
+        bool contains(Key key) const {
+            std::lock_guard lock(m_Mutex);
+            return m_Map.contains(key);
+        }
+
+        bool erase(Key key) {
+            std::lock_guard lock(m_Mutex);
+            return m_Map.erase(key);
+        }
+    };
+
+    /**
+     * Run a function on the specified number of threads at once and wait for all of them.
+     * @tparam Func Callable taking the index of the thread
+     * @param threadCount
+     * @param func
+     */
+    template<typename Func>
+    void runThreads(std::size_t threadCount, Func&& func) {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < threadCount; t++) {
+            threads.emplace_back(func, t);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Every thread does lookups on its own slice of the keys, and in one out of every writeInterval operations,
+     * erases and re-inserts the key instead. The reported time is per operation over all threads, so
+     * Mop/s is the total throughput.
+     * @tparam Map
+     * @param name
+     * @param keys Keys that are already in the map
+     * @param threadCount
+     * @param operationsPerThread
+     * @param writeInterval 0 for a read-only workload
+     */
+    template<typename Map>
+    void runWorkload(const std::string& name, Map& map, const std::vector<Key>& keys, std::size_t threadCount,
+                     std::size_t operationsPerThread, std::size_t writeInterval) {
+        wtl_bench::measure(name + ", " + std::to_string(threadCount) + " threads",
+                           threadCount * operationsPerThread, [&]() {
+            runThreads(threadCount, [&](std::size_t t) {
+                std::size_t found = 0;
+                std::size_t slice = keys.size() / threadCount;
+                const Key* mine = keys.data() + t * slice;
+                for (std::size_t i = 0; i < operationsPerThread; i++) {
+                    Key key = mine[(i * 7919) % slice];
+                    if (writeInterval != 0 && i % writeInterval == 0) {
+                        map.erase(key);
+                        map.insert(key, key);
+                    } else {
+                        found += map.contains(key);
+                    }
+                }
+                wtl_bench::doNotOptimize(found);
+            });
+        });
+    }
+
+}
+
+int main() {
+    constexpr std::size_t keyCount = 1000000;
+    constexpr std::size_t operationsPerThread = 2000000;
+    std::vector<Key> keys = wtl_bench::randomKeys(keyCount);
+
+    std::size_t maximumThreads = std::thread::hardware_concurrency();
+    if (maximumThreads == 0) {
+        maximumThreads = 1;
+    }
+    std::vector<std::size_t> threadCounts;
+    for (std::size_t t = 1; t < maximumThreads; t *= 2) {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maximumThreads);
+    std::printf("hardware threads: %zu\n", maximumThreads);
+
+    LockedUnorderedMap lockedMap;
+    wtl::ConcurrentMap<Key, Key> concurrentMap;
+    for (Key key : keys) {
+        lockedMap.insert(key, key);
+        concurrentMap.insert(key, key);
+    }
+    std::printf("ConcurrentMap shards: %zu\n", concurrentMap.getShardCount());
+
+    wtl_bench::section("Lookups only");
+    for (std::size_t threadCount : threadCounts) {
+        runWorkload("UnorderedMap + mutex", lockedMap, keys, threadCount, operationsPerThread, 0);
+        runWorkload("ConcurrentMap", concurrentMap, keys, threadCount, operationsPerThread, 0);
+    }
+
+    wtl_bench::section("90% lookups, 10% erase + insert");
+    for (std::size_t threadCount : threadCounts) {
+        runWorkload("UnorderedMap + mutex", lockedMap, keys, threadCount, operationsPerThread, 10);
+        runWorkload("ConcurrentMap", concurrentMap, keys, threadCount, operationsPerThread, 10);
+    }
+    return 0;
+}
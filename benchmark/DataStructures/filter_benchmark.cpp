@@ -0,0 +1,87 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "BloomFilter.h"
+#include "CuckooFilter.h"
+#include "FilteredContainer.h"
+#include "UnorderedSet.h"
+
+namespace {
+
+    using Key = std::uint64_t;
+
+    /**
+     * Lookups where almost every key is missing, as in a deduplication pipeline.
+     * @tparam Set
+     * @param name
+     * @param set Set holding the inserted keys
+     * @param queries Keys that are looked up
+     */
+    template<typename Set>
+    void runMisses(const std::string& name, const Set& set, const std::vector<Key>& queries) {
+        wtl_bench::measure(name + " contains (miss)", queries.size(), [&]() {
+            std::size_t found = 0;
+            for (Key key : queries) {
+                found += set.contains(key);
+            }
+            wtl_bench::doNotOptimize(found);
+        });
+    }
+
+    /**
+     * Queries of a filter alone, to show the cost of a single probe.
+     * @tparam Filter
+     * @param name
+     * @param filter
+     * @param queries
+     */
+    template<typename Filter>
+    void runFilter(const std::string& name, const Filter& filter, const std::vector<Key>& queries) {
+        wtl_bench::measure(name + " mayContain (miss)", queries.size(), [&]() {
+            std::size_t found = 0;
+            for (Key key : queries) {
+                found += filter.mayContain(key);
+            }
+            wtl_bench::doNotOptimize(found);
+        });
+        std::size_t falsePositives = 0;
+        for (Key key : queries) {
+            falsePositives += filter.mayContain(key);
+        }
+        std::printf("%s: %zu bytes, measured false positive rate %.4f%%\n", name.c_str(), filter.getMemoryUsage(),
+                    100.0 * static_cast<double>(falsePositives) / static_cast<double>(queries.size()));
+    }
+
+}
+
+int main() {
+    constexpr std::size_t size = 1000000;
+    std::vector<Key> keys = wtl_bench::randomKeys(size, 1);
+    std::vector<Key> queries = wtl_bench::randomKeys(size * 4, 2);
+
+    wtl::UnorderedSet<Key> plainSet;
+    wtl::FilteredContainer<wtl::UnorderedSet<Key>, wtl::BloomFilter<Key>> bloomSet{
+            wtl::BloomFilter<Key>(size, 0.01)};
+    wtl::FilteredContainer<wtl::UnorderedSet<Key>, wtl::CuckooFilter<Key>> cuckooSet{
+            wtl::CuckooFilter<Key>(size)};
+    for (Key key : keys) {
+        plainSet.insert(key);
+        bloomSet.insert(key);
+        cuckooSet.insert(key);
+    }
+
+    wtl_bench::section(std::to_string(size) + " keys, 1% Bloom filter, 16 bit cuckoo filter");
+    runFilter("BloomFilter", bloomSet.getFilter(), queries);
+    runFilter("CuckooFilter", cuckooSet.getFilter(), queries);
+    runMisses("UnorderedSet", plainSet, queries);
+    runMisses("UnorderedSet + BloomFilter", bloomSet, queries);
+    runMisses("UnorderedSet + CuckooFilter", cuckooSet, queries);
+    return 0;
+}
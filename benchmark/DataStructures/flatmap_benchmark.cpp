@@ -0,0 +1,133 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "ClosedMap.h"
+#include "FlatMap.h"
+#include "RobinHoodMap.h"
+#include "UnorderedMap.h"
+
+namespace {
+
+    /**
+     * Insert, lookup hits, lookup misses and erase on a map type sharing the UnorderedMap interface.
+     * @tparam Map
+     * @param name
+     * @param keys Unique keys that are inserted
+     * @param missingKeys Keys that are never inserted
+     */
+    template<typename Map>
+    void runMap(const std::string& name, const std::vector<std::uint64_t>& keys,
+                const std::vector<std::uint64_t>& missingKeys) {
+        Map map;
+        wtl_bench::measure(name + " insert", keys.size(), [&]() {
+            for (std::uint64_t key : keys) {
+                map.insert(key, key);
+            }
+        });
+        wtl_bench::measure(name + " lookup (hit)", keys.size(), [&]() {
+            std::uint64_t sum = 0;
+            for (std::uint64_t key : keys) {
+                sum += map.at(key).value().get();
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+        wtl_bench::measure(name + " lookup (miss)", missingKeys.size(), [&]() {
+            std::size_t found = 0;
+            for (std::uint64_t key : missingKeys) {
+                found += map.contains(key);
+            }
+            wtl_bench::doNotOptimize(found);
+        });
+        wtl_bench::measure(name + " erase", keys.size(), [&]() {
+            for (std::uint64_t key : keys) {
+                map.erase(key);
+            }
+        });
+    }
+
+    /**
+     * Repeated lookups in a small map. ClosedMap cannot grow past 31 elements, so this is the only workload
+     * that all three maps can run.
+     * @tparam Map
+     * @param name
+     * @param keys
+     * @param rounds
+     */
+    template<typename Map>
+    void runSmallMap(const std::string& name, const std::vector<std::uint64_t>& keys, std::size_t rounds) {
+        Map map;
+        for (std::uint64_t key : keys) {
+            map.insert(key, key);
+        }
+        wtl_bench::measure(name + " lookup (hit)", keys.size() * rounds, [&]() {
+            std::uint64_t sum = 0;
+            for (std::size_t r = 0; r < rounds; r++) {
+                for (std::uint64_t key : keys) {
+                    sum += map.at(key).value().get();
+                }
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+    }
+
+    /**
+     * Keep a fixed number of live keys while inserting and erasing, then report the RobinHoodMap probe lengths.
+     * Without tombstones, the probe lengths should stay where they were before the churn.
+     * @param keys Keys that are inserted before the churn
+     * @param churnKeys Keys that each replace the oldest live key
+     */
+    void runChurn(const std::vector<std::uint64_t>& keys, const std::vector<std::uint64_t>& churnKeys) {
+        wtl::RobinHoodMap<std::uint64_t, std::uint64_t> map;
+        for (std::uint64_t key : keys) {
+            map.insert(key, key);
+        }
+        auto before = map.getProbeStatistics();
+        std::vector<std::uint64_t> live(keys);
+        wtl_bench::measure("RobinHoodMap insert + erase", churnKeys.size(), [&]() {
+            for (std::size_t i = 0; i < churnKeys.size(); i++) {
+                std::uint64_t& slot = live[i % live.size()];
+                map.erase(slot);
+                map.insert(churnKeys[i], churnKeys[i]);
+                slot = churnKeys[i];
+            }
+        });
+        auto after = map.getProbeStatistics();
+        std::printf("probe length before churn: average %.3f, maximum %zu\n",
+                    before.m_AverageProbeLength, before.m_MaximumProbeLength);
+        std::printf("probe length after churn:  average %.3f, maximum %zu\n",
+                    after.m_AverageProbeLength, after.m_MaximumProbeLength);
+    }
+
+}
+
+int main() {
+    using Key = std::uint64_t;
+
+    wtl_bench::section("24 keys, 1M rounds");
+    std::vector<Key> smallKeys = wtl_bench::randomKeys(24);
+    runSmallMap<wtl::FlatMap<Key, Key>>("FlatMap", smallKeys, 1000000);
+    runSmallMap<wtl::RobinHoodMap<Key, Key>>("RobinHoodMap", smallKeys, 1000000);
+    runSmallMap<wtl::UnorderedMap<Key, Key>>("UnorderedMap", smallKeys, 1000000);
+    runSmallMap<wtl::ClosedMap<Key, Key>>("ClosedMap", smallKeys, 1000000);
+
+    for (std::size_t size : {100000, 1000000, 10000000}) {
+        wtl_bench::section(std::to_string(size) + " keys");
+        std::vector<Key> keys = wtl_bench::randomKeys(size, 1);
+        std::vector<Key> missingKeys = wtl_bench::randomKeys(size, 2);
+        runMap<wtl::FlatMap<Key, Key>>("FlatMap", keys, missingKeys);
+        runMap<wtl::RobinHoodMap<Key, Key>>("RobinHoodMap", keys, missingKeys);
+        runMap<wtl::UnorderedMap<Key, Key>>("UnorderedMap", keys, missingKeys);
+    }
+
+    wtl_bench::section("Insert/erase churn, 1M live keys");
+    runChurn(wtl_bench::randomKeys(1000000, 3), wtl_bench::randomKeys(4000000, 4));
+    return 0;
+}
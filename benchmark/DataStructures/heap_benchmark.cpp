@@ -0,0 +1,113 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Heap.h"
+
+namespace {
+
+    using Key = std::uint64_t;
+
+    template<std::size_t Arity>
+    using Heap = wtl::Heap<Key, wtl::impl::ds::StandardComparator<Key>, Arity>;
+
+    /**
+     * Build a heap from all keys at once, in O(n) time, and from one key at a time.
+     * @tparam Arity
+     * @param keys
+     */
+    template<std::size_t Arity>
+    void runBuild(const std::vector<Key>& keys) {
+        std::string name = std::to_string(Arity) + "-ary Heap";
+        wtl_bench::measure(name + " build from range", keys.size(), [&]() {
+            Heap<Arity> heap(keys.begin(), keys.end());
+            wtl_bench::doNotOptimize(heap.peek());
+        });
+        wtl_bench::measure(name + " insert one at a time", keys.size(), [&]() {
+            Heap<Arity> heap;
+            for (Key key : keys) {
+                heap.insert(key);
+            }
+            wtl_bench::doNotOptimize(heap.peek());
+        });
+    }
+
+    /**
+     * Keep a heap at a fixed size, replacing the root with a new key each time, as a priority queue in a graph
+     * search does. Each operation is a poll and an insert.
+     * @tparam Arity
+     * @param keys
+     */
+    template<std::size_t Arity>
+    void runChurn(const std::vector<Key>& keys) {
+        Heap<Arity> heap(keys.begin(), keys.begin() + keys.size() / 2);
+        wtl_bench::measure(std::to_string(Arity) + "-ary Heap poll + insert", keys.size() / 2, [&]() {
+            for (std::size_t i = keys.size() / 2; i < keys.size(); i++) {
+                heap.poll();
+                heap.insert(keys[i]);
+            }
+        });
+        wtl_bench::doNotOptimize(heap.peek());
+    }
+
+    /**
+     * Remove every key in order of priority, which is the cost that dominates a heap sort.
+     * @tparam Arity
+     * @param keys
+     */
+    template<std::size_t Arity>
+    void runPopAll(const std::vector<Key>& keys) {
+        Heap<Arity> heap(keys.begin(), keys.end());
+        std::vector<Key> sorted;
+        sorted.reserve(keys.size());
+        wtl_bench::measure(std::to_string(Arity) + "-ary Heap popN all", keys.size(), [&]() {
+            heap.popN(keys.size(), std::back_inserter(sorted));
+        });
+        wtl_bench::doNotOptimize(sorted.back());
+    }
+
+}
+
+int main() {
+    for (std::size_t count : {std::size_t{1} << 12, std::size_t{1} << 20}) {
+        std::vector<Key> keys = wtl_bench::randomKeys(count);
+
+        wtl_bench::section("Building, " + std::to_string(count) + " keys");
+        wtl_bench::measure("std::priority_queue build from range", count, [&]() {
+            std::priority_queue<Key> queue(keys.begin(), keys.end());
+            wtl_bench::doNotOptimize(queue.top());
+        });
+        runBuild<2>(keys);
+        runBuild<4>(keys);
+        runBuild<8>(keys);
+
+        wtl_bench::section("Poll and insert, " + std::to_string(count / 2) + " keys");
+        {
+            std::priority_queue<Key> queue(keys.begin(), keys.begin() + count / 2);
+            wtl_bench::measure("std::priority_queue pop + push", count / 2, [&]() {
+                for (std::size_t i = count / 2; i < count; i++) {
+                    queue.pop();
+                    queue.push(keys[i]);
+                }
+            });
+            wtl_bench::doNotOptimize(queue.top());
+        }
+        runChurn<2>(keys);
+        runChurn<4>(keys);
+        runChurn<8>(keys);
+
+        wtl_bench::section("Removing every key, " + std::to_string(count) + " keys");
+        runPopAll<2>(keys);
+        runPopAll<4>(keys);
+        runPopAll<8>(keys);
+    }
+    return 0;
+}
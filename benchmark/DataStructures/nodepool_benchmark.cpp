@@ -0,0 +1,124 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "BinarySearchTree.h"
+#include "DoublyLinkedList.h"
+#include "NodePool.h"
+#include "SinglyLinkedList.h"
+
+namespace {
+
+    using Key = std::uint64_t;
+
+    /**
+     * Build a large list at the front, then destroy it.
+     * @tparam List
+     * @param name
+     * @param count Number of elements
+     */
+    template<typename List>
+    void runAppendFront(const std::string& name, std::size_t count) {
+        wtl_bench::measure(name + " appendFront + destroy", count, [&]() {
+            List list;
+            for (std::size_t i = 0; i < count; i++) {
+                list.appendFront(static_cast<Key>(i));
+            }
+            wtl_bench::doNotOptimize(list.getSize());
+        });
+    }
+
+    /**
+     * Build a large list at the back, then destroy it.
+     * @tparam List
+     * @param name
+     * @param count Number of elements
+     */
+    template<typename List>
+    void runAppendBack(const std::string& name, std::size_t count) {
+        wtl_bench::measure(name + " appendBack + destroy", count, [&]() {
+            List list;
+            for (std::size_t i = 0; i < count; i++) {
+                list.appendBack(static_cast<Key>(i));
+            }
+            wtl_bench::doNotOptimize(list.getSize());
+        });
+    }
+
+    /**
+     * Fill a list with a few elements and clear it, over and over, as a per-request scratch list would be.
+     * @tparam List
+     * @param name
+     * @param rounds
+     * @param elementsPerRound
+     */
+    template<typename List>
+    void runClear(const std::string& name, std::size_t rounds, std::size_t elementsPerRound) {
+        wtl_bench::measure(name + " appendBack x" + std::to_string(elementsPerRound) + " + clear",
+                           rounds * elementsPerRound, [&]() {
+            List list;
+            for (std::size_t round = 0; round < rounds; round++) {
+                for (std::size_t i = 0; i < elementsPerRound; i++) {
+                    list.appendBack(static_cast<Key>(i));
+                }
+                wtl_bench::doNotOptimize(list.getSize());
+                list.clear();
+            }
+        });
+    }
+
+    /**
+     * Insert random keys into a tree, then destroy it.
+     * @tparam Tree
+     * @param name
+     * @param keys
+     */
+    template<typename Tree>
+    void runTreeInsert(const std::string& name, const std::vector<Key>& keys) {
+        wtl_bench::measure(name + " insert + destroy", keys.size(), [&]() {
+            Tree tree;
+            for (Key key : keys) {
+                tree.insert(key, static_cast<std::uint32_t>(key));
+            }
+            wtl_bench::doNotOptimize(tree.getSize());
+        });
+    }
+
+    template<typename T>
+    using PooledSLL = wtl::SinglyLinkedList<T, wtl::NodePool>;
+
+    template<typename T>
+    using PooledDLL = wtl::DoublyLinkedList<T, wtl::NodePool>;
+
+    template<typename K, typename V>
+    using PooledBST = wtl::BinarySearchTree<K, V, wtl::NodePool>;
+
+}
+
+int main() {
+    constexpr std::size_t count = 2000000;
+    std::vector<Key> keys = wtl_bench::randomKeys(count);
+
+    wtl_bench::section("Append-heavy");
+    runAppendFront<wtl::SinglyLinkedList<Key>>("SinglyLinkedList, new/delete", count);
+    runAppendFront<PooledSLL<Key>>("SinglyLinkedList, NodePool", count);
+    runAppendBack<wtl::DoublyLinkedList<Key>>("DoublyLinkedList, new/delete", count);
+    runAppendBack<PooledDLL<Key>>("DoublyLinkedList, NodePool", count);
+
+    wtl_bench::section("Clear-heavy");
+    runClear<wtl::DoublyLinkedList<Key>>("DoublyLinkedList, new/delete", count / 100, 100);
+    runClear<PooledDLL<Key>>("DoublyLinkedList, NodePool", count / 100, 100);
+    runClear<wtl::DoublyLinkedList<Key>>("DoublyLinkedList, new/delete", count / 10000, 10000);
+    runClear<PooledDLL<Key>>("DoublyLinkedList, NodePool", count / 10000, 10000);
+
+    wtl_bench::section("Random inserts");
+    runTreeInsert<wtl::BinarySearchTree<Key, std::uint32_t>>("BinarySearchTree, new/delete", keys);
+    runTreeInsert<PooledBST<Key, std::uint32_t>>("BinarySearchTree, NodePool", keys);
+    return 0;
+}
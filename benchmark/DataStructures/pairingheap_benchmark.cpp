@@ -0,0 +1,121 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "PairingHeap.h"
+#include "PriorityQueue.h"
+
+namespace {
+
+    using Key = std::uint64_t;
+
+    /**
+     * Every tick, each shard queues a batch of events, then the shard queues are merged into the main queue and the
+     * earliest events are run. The PriorityQueue version has to move every element of a shard across.
+     * @param shardCount
+     * @param perShard Events queued by each shard per tick
+     * @param ticks
+     */
+    void runShardMerge(std::size_t shardCount, std::size_t perShard, std::size_t ticks) {
+        std::vector<Key> keys = wtl_bench::randomKeys(shardCount * perShard * ticks);
+        std::size_t operations = keys.size();
+        std::string suffix = ", " + std::to_string(shardCount) + " shards x " + std::to_string(perShard);
+
+        wtl_bench::measure("PriorityQueue pollN + insertRange" + suffix, operations, [&]() {
+            wtl::PriorityQueue<Key> main;
+            std::vector<wtl::PriorityQueue<Key>> shards(shardCount);
+            std::vector<Key> buffer;
+            std::size_t next = 0;
+            for (std::size_t tick = 0; tick < ticks; tick++) {
+                for (wtl::PriorityQueue<Key>& shard : shards) {
+                    for (std::size_t i = 0; i < perShard; i++) {
+                        shard.insert(keys[next++]);
+                    }
+                }
+                for (wtl::PriorityQueue<Key>& shard : shards) {
+                    buffer.clear();
+                    shard.pollN(shard.getSize(), std::back_inserter(buffer));
+                    main.insertRange(buffer.begin(), buffer.end());
+                }
+                for (std::size_t i = 0; i < perShard && !main.isEmpty(); i++) {
+                    main.poll();
+                }
+            }
+            wtl_bench::doNotOptimize(main.getSize());
+        });
+
+        wtl_bench::measure("PairingHeap meld" + suffix, operations, [&]() {
+            wtl::PairingHeap<Key> main;
+            std::vector<wtl::PairingHeap<Key>> shards;
+            for (std::size_t s = 0; s < shardCount; s++) {
+                shards.emplace_back(main.getPool());
+            }
+            std::size_t next = 0;
+            for (std::size_t tick = 0; tick < ticks; tick++) {
+                for (wtl::PairingHeap<Key>& shard : shards) {
+                    for (std::size_t i = 0; i < perShard; i++) {
+                        shard.insert(keys[next++]);
+                    }
+                }
+                for (wtl::PairingHeap<Key>& shard : shards) {
+                    main.meld(shard);
+                }
+                for (std::size_t i = 0; i < perShard && !main.isEmpty(); i++) {
+                    main.poll();
+                }
+            }
+            wtl_bench::doNotOptimize(main.getSize());
+        });
+    }
+
+    /**
+     * Keep a queue at a fixed size, replacing the root with a new key each time.
+     * @param count
+     */
+    void runChurn(std::size_t count) {
+        std::vector<Key> keys = wtl_bench::randomKeys(count * 2);
+        std::string suffix = ", " + std::to_string(count) + " keys";
+        {
+            wtl::PriorityQueue<Key> queue(keys.begin(), keys.begin() + count);
+            wtl_bench::measure("PriorityQueue poll + insert" + suffix, count, [&]() {
+                for (std::size_t i = count; i < keys.size(); i++) {
+                    queue.poll();
+                    queue.insert(keys[i]);
+                }
+            });
+            wtl_bench::doNotOptimize(queue.peek());
+        }
+        {
+            wtl::PairingHeap<Key> heap;
+            for (std::size_t i = 0; i < count; i++) {
+                heap.insert(keys[i]);
+            }
+            wtl_bench::measure("PairingHeap poll + insert" + suffix, count, [&]() {
+                for (std::size_t i = count; i < keys.size(); i++) {
+                    heap.poll();
+                    heap.insert(keys[i]);
+                }
+            });
+            wtl_bench::doNotOptimize(heap.peek());
+        }
+    }
+
+}
+
+int main() {
+    wtl_bench::section("Merging shard queues every tick");
+    runShardMerge(8, 256, 200);
+    runShardMerge(64, 64, 100);
+
+    wtl_bench::section("Poll and insert");
+    runChurn(1 << 12);
+    runChurn(1 << 18);
+    return 0;
+}
@@ -0,0 +1,218 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "MpmcQueue.h"
+#include "Queue.h"
+#include "SpscQueue.h"
+
+namespace {
+
+    using Item = std::uint64_t;
+
+    constexpr std::size_t CAPACITY = 1024;
+
+    /**
+     * Queue behind a single mutex, which is how work was passed between threads before the lock-free queues.
+     */
+    class LockedQueue {
+    private:
+        std::mutex m_Mutex;
+        wtl::Queue<Item> m_Queue;
+
+    public:
+        explicit LockedQueue(std::size_t) {}
+
+        bool tryEnqueue(Item item) {
+            std::lock_guard lock(m_Mutex);
+            if (m_Queue.getSize() == CAPACITY) {
+                return false;
+            }
+            m_Queue.enqueue(item);
+            return true;
+        }
+
+        bool tryDequeue(Item& item) {
+            std::lock_guard lock(m_Mutex);
+            if (m_Queue.isEmpty()) {
+                return false;
+            }
+            item = m_Queue.peek();
+            m_Queue.dequeue();
+            return true;
+        }
+    };
+
+    /**
+     * Run a function on the specified number of threads at once and wait for all of them.
+     * @tparam Func Callable taking the index of the thread
+     * @param threadCount
+     * @param func
+     */
+    template<typename Func>
+    void runThreads(std::size_t threadCount, Func&& func) {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < threadCount; t++) {
+            threads.emplace_back(func, t);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Producers enqueue items one at a time and consumers dequeue them one at a time, until every item has passed
+     * through the queue. The reported time is per item, so Mop/s is the total throughput.
+     * @tparam Queue
+     * @param name
+     * @param producers
+     * @param consumers
+     * @param items
+     */
+    template<typename Queue>
+    void runThroughput(const std::string& name, std::size_t producers, std::size_t consumers, std::size_t items) {
+        Queue queue(CAPACITY);
+        std::atomic<std::size_t> remaining = items;
+        wtl_bench::measure(name + ", " + std::to_string(producers) + "P/" + std::to_string(consumers) + "C",
+                           items, [&]() {
+            runThreads(producers + consumers, [&](std::size_t t) {
+                if (t < producers) {
+                    std::size_t count = items / producers + (t < items % producers ? 1 : 0);
+                    for (std::size_t i = 0; i < count;) {
+                        if (queue.tryEnqueue(i)) {
+                            i++;
+                        } else {
+                            std::this_thread::yield();
+                        }
+                    }
+                } else {
+                    Item sum = 0;
+                    Item item;
+                    while (remaining.load(std::memory_order_relaxed) > 0) {
+                        if (queue.tryDequeue(item)) {
+                            sum += item;
+                            remaining.fetch_sub(1, std::memory_order_relaxed);
+                        } else {
+                            std::this_thread::yield();
+                        }
+                    }
+                    wtl_bench::doNotOptimize(sum);
+                }
+            });
+        });
+    }
+
+    /**
+     * Like runThroughput, but items are enqueued and dequeued in batches.
+     * @tparam Queue
+     * @param name
+     * @param producers
+     * @param consumers
+     * @param items
+     * @param batch
+     */
+    template<typename Queue>
+    void runBatchThroughput(const std::string& name, std::size_t producers, std::size_t consumers, std::size_t items,
+                            std::size_t batch) {
+        Queue queue(CAPACITY);
+        std::atomic<std::size_t> remaining = items;
+        wtl_bench::measure(name + " x" + std::to_string(batch) + ", " + std::to_string(producers) + "P/" +
+                           std::to_string(consumers) + "C", items, [&]() {
+            runThreads(producers + consumers, [&](std::size_t t) {
+                std::vector<Item> buffer(batch);
+                if (t < producers) {
+                    std::size_t count = items / producers + (t < items % producers ? 1 : 0);
+                    for (std::size_t i = 0; i < count;) {
+                        std::size_t size = std::min(batch, count - i);
+                        std::size_t enqueued = queue.tryEnqueueRange(buffer.begin(), buffer.begin() + size);
+                        if (enqueued == 0) {
+                            std::this_thread::yield();
+                        }
+                        i += enqueued;
+                    }
+                } else {
+                    while (remaining.load(std::memory_order_relaxed) > 0) {
+                        std::size_t dequeued = queue.tryDequeueInto(buffer.begin(), batch);
+                        if (dequeued == 0) {
+                            std::this_thread::yield();
+                        }
+                        remaining.fetch_sub(dequeued, std::memory_order_relaxed);
+                    }
+                }
+            });
+        });
+    }
+
+    /**
+     * Bounce an item between two threads through a pair of queues. Half of each round trip is the latency of
+     * handing one item over.
+     * @tparam Queue
+     * @param name
+     * @param rounds
+     */
+    template<typename Queue>
+    void runLatency(const std::string& name, std::size_t rounds) {
+        Queue ping(CAPACITY);
+        Queue pong(CAPACITY);
+        auto start = std::chrono::steady_clock::now();
+        runThreads(2, [&](std::size_t t) {
+            Item item = 0;
+            for (std::size_t i = 0; i < rounds; i++) {
+                if (t == 0) {
+                    while (!ping.tryEnqueue(i)) {}
+                    while (!pong.tryDequeue(item)) {
+                        std::this_thread::yield();
+                    }
+                } else {
+                    while (!ping.tryDequeue(item)) {
+                        std::this_thread::yield();
+                    }
+                    while (!pong.tryEnqueue(item)) {}
+                }
+            }
+        });
+        auto end = std::chrono::steady_clock::now();
+        double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count();
+        std::printf("%-56s %12.2f ns/handoff\n", (name + " ping-pong").c_str(), nanoseconds / (2.0 * rounds));
+    }
+
+}
+
+int main() {
+    constexpr std::size_t items = 2000000;
+    std::size_t hardwareThreads = std::thread::hardware_concurrency();
+    std::size_t maxThreads = hardwareThreads < 2 ? 1 : hardwareThreads / 2;
+
+    wtl_bench::section("Throughput, one producer and one consumer");
+    runThroughput<LockedQueue>("Queue + mutex", 1, 1, items);
+    runThroughput<wtl::SpscQueue<Item>>("SpscQueue", 1, 1, items);
+    runThroughput<wtl::MpmcQueue<Item>>("MpmcQueue", 1, 1, items);
+    runBatchThroughput<wtl::SpscQueue<Item>>("SpscQueue", 1, 1, items, 32);
+    runBatchThroughput<wtl::MpmcQueue<Item>>("MpmcQueue", 1, 1, items, 32);
+
+    wtl_bench::section("Throughput, several producers and consumers");
+    for (std::size_t threads = 2; threads <= std::max<std::size_t>(maxThreads, 2); threads *= 2) {
+        runThroughput<LockedQueue>("Queue + mutex", threads, threads, items);
+        runThroughput<wtl::MpmcQueue<Item>>("MpmcQueue", threads, threads, items);
+        runBatchThroughput<wtl::MpmcQueue<Item>>("MpmcQueue", threads, threads, items, 32);
+    }
+
+    wtl_bench::section("Latency");
+    runLatency<LockedQueue>("Queue + mutex", items / 20);
+    runLatency<wtl::SpscQueue<Item>>("SpscQueue", items / 20);
+    runLatency<wtl::MpmcQueue<Item>>("MpmcQueue", items / 20);
+    return 0;
+}
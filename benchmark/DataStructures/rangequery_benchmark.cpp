@@ -0,0 +1,235 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "CompactRMQ.h"
+#include "DisjointSparseTable.h"
+#include "FenwickTree.h"
+#include "RangeFenwickTree.h"
+#include "SegmentTree.h"
+#include "SparseTable.h"
+
+namespace {
+
+    using Value = std::int64_t;
+    using Range = std::pair<std::size_t, std::size_t>;
+
+    std::vector<Value> randomValues(std::size_t count) {
+        std::vector<std::uint64_t> keys = wtl_bench::randomKeys(count, 7);
+        std::vector<Value> values(count);
+        for (std::size_t i = 0; i < count; i++) {
+            values[i] = static_cast<Value>(keys[i] % 2000001) - 1000000;
+        }
+        return values;
+    }
+
+    std::vector<Range> randomRanges(std::size_t size, std::size_t count) {
+        std::vector<std::uint64_t> keys = wtl_bench::randomKeys(2 * count, 11);
+        std::vector<Range> ranges(count);
+        for (std::size_t i = 0; i < count; i++) {
+            std::size_t a = keys[2 * i] % size;
+            std::size_t b = keys[2 * i + 1] % size;
+            ranges[i] = a < b ? Range(a, b) : Range(b, a);
+        }
+        return ranges;
+    }
+
+    /**
+     * Build each structure over the same values, then answer the same random range queries one at a time and as
+     * a batch.
+     * @param size
+     * @param queries
+     */
+    void runSum(std::size_t size, std::size_t queries) {
+        std::vector<Value> values = randomValues(size);
+        std::vector<Range> ranges = randomRanges(size, queries);
+        std::string suffix = ", n = " + std::to_string(size);
+
+        wtl_bench::section("Range sum" + suffix);
+        std::vector<wtl::FenwickTree<Value>> fenwick;
+        std::vector<wtl::DisjointSparseTable<Value>> disjoint;
+        wtl_bench::measure("FenwickTree build", size, [&]() {
+            fenwick.emplace_back(values);
+        });
+        wtl_bench::measure("DisjointSparseTable build", size, [&]() {
+            disjoint.emplace_back(values.begin(), values.end());
+        });
+
+        wtl_bench::measure("FenwickTree::query(start, end)", queries, [&]() {
+            Value sum = 0;
+            for (const Range& range : ranges) {
+                sum += fenwick.front().query(range.first, range.second);
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+        wtl_bench::measure("DisjointSparseTable::query(start, end)", queries, [&]() {
+            Value sum = 0;
+            for (const Range& range : ranges) {
+                sum += disjoint.front().query(range.first, range.second);
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+        std::vector<Value> results(queries);
+        wtl_bench::measure("DisjointSparseTable::query(ranges)", queries, [&]() {
+            disjoint.front().query(ranges.begin(), ranges.end(), results.begin());
+            wtl_bench::doNotOptimize(results.back());
+        });
+    }
+
+    /**
+     * Like runSum, but for the minimum, which a Fenwick tree cannot answer over an arbitrary range. The memory used
+     * by each structure is printed after it is built.
+     * @param size
+     * @param queries
+     */
+    void runMin(std::size_t size, std::size_t queries) {
+        std::vector<Value> values = randomValues(size);
+        std::vector<Range> ranges = randomRanges(size, queries);
+        std::string suffix = ", n = " + std::to_string(size);
+
+        wtl_bench::section("Range minimum" + suffix);
+        std::vector<wtl::SparseTable<Value, wtl::RangeMin<Value>>> sparse;
+        std::vector<wtl::DisjointSparseTable<Value, wtl::RangeMin<Value>>> disjoint;
+        std::vector<wtl::CompactRMQ<Value>> compact;
+        wtl_bench::measure("SparseTable build", size, [&]() {
+            sparse.emplace_back(values.begin(), values.end());
+        });
+        wtl_bench::measure("DisjointSparseTable build", size, [&]() {
+            disjoint.emplace_back(values.begin(), values.end());
+        });
+        wtl_bench::measure("CompactRMQ build", size, [&]() {
+            compact.emplace_back(values.begin(), values.end());
+        });
+        std::printf("%-56s %12.2f bytes/element\n", "SparseTable memory",
+                    static_cast<double>(sparse.front().getMemoryUsage()) / size);
+        std::printf("%-56s %12.2f bytes/element\n", "DisjointSparseTable memory",
+                    static_cast<double>(disjoint.front().getMemoryUsage()) / size);
+        std::printf("%-56s %12.2f bytes/element\n", "CompactRMQ memory",
+                    static_cast<double>(compact.front().getMemoryUsage()) / size);
+
+        std::vector<Value> results(queries);
+        wtl_bench::measure("SparseTable::query(ranges)", queries, [&]() {
+            sparse.front().query(ranges.begin(), ranges.end(), results.begin());
+            wtl_bench::doNotOptimize(results.back());
+        });
+        wtl_bench::measure("DisjointSparseTable::query(ranges)", queries, [&]() {
+            disjoint.front().query(ranges.begin(), ranges.end(), results.begin());
+            wtl_bench::doNotOptimize(results.back());
+        });
+        wtl_bench::measure("CompactRMQ::query(ranges)", queries, [&]() {
+            compact.front().query(ranges.begin(), ranges.end(), results.begin());
+            wtl_bench::doNotOptimize(results.back());
+        });
+        wtl_bench::measure("CompactRMQ::query(start, end)", queries, [&]() {
+            Value minimum = 0;
+            for (const Range& range : ranges) {
+                minimum += compact.front().query(range.first, range.second);
+            }
+            wtl_bench::doNotOptimize(minimum);
+        });
+    }
+
+    /**
+     * Mix of updates and queries, comparing SegmentTree with the structures that support the same operations.
+     * Every other operation is an update.
+     * @param size
+     * @param operations
+     */
+    void runDynamic(std::size_t size, std::size_t operations) {
+        std::vector<Value> values = randomValues(size);
+        std::vector<Range> ranges = randomRanges(size, operations);
+        std::string suffix = ", n = " + std::to_string(size);
+
+        wtl_bench::section("Point update and range sum" + suffix);
+        wtl::FenwickTree<Value> fenwick(values);
+        wtl::SegmentTree<Value> segmentTree(values.begin(), values.end());
+        wtl_bench::measure("FenwickTree", operations, [&]() {
+            Value sum = 0;
+            for (std::size_t i = 0; i < operations; i++) {
+                if (i % 2 == 0) {
+                    fenwick.update(ranges[i].first, 1);
+                } else {
+                    sum += fenwick.query(ranges[i].first, ranges[i].second);
+                }
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+        wtl_bench::measure("SegmentTree", operations, [&]() {
+            Value sum = 0;
+            for (std::size_t i = 0; i < operations; i++) {
+                if (i % 2 == 0) {
+                    segmentTree.update(ranges[i].first, 1);
+                } else {
+                    sum += segmentTree.query(ranges[i].first, ranges[i].second);
+                }
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+
+        wtl_bench::section("Range add and range sum" + suffix);
+        wtl::RangeFenwickTree<Value> rangeFenwick(values);
+        wtl_bench::measure("RangeFenwickTree", operations, [&]() {
+            Value sum = 0;
+            for (std::size_t i = 0; i < operations; i++) {
+                if (i % 2 == 0) {
+                    rangeFenwick.update(ranges[i].first, ranges[i].second, 1);
+                } else {
+                    sum += rangeFenwick.query(ranges[i].first, ranges[i].second);
+                }
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+        wtl_bench::measure("SegmentTree", operations, [&]() {
+            Value sum = 0;
+            for (std::size_t i = 0; i < operations; i++) {
+                if (i % 2 == 0) {
+                    segmentTree.update(ranges[i].first, ranges[i].second, 1);
+                } else {
+                    sum += segmentTree.query(ranges[i].first, ranges[i].second);
+                }
+            }
+            wtl_bench::doNotOptimize(sum);
+        });
+
+        wtl_bench::section("Static range minimum" + suffix);
+        wtl::SparseTable<Value, wtl::RangeMin<Value>> sparse(values.begin(), values.end());
+        wtl::SegmentTree<Value, wtl::RangeMin<Value>> minTree(values.begin(), values.end());
+        wtl_bench::measure("SparseTable", operations, [&]() {
+            Value minimum = 0;
+            for (const Range& range : ranges) {
+                minimum += sparse.query(range.first, range.second);
+            }
+            wtl_bench::doNotOptimize(minimum);
+        });
+        wtl_bench::measure("SegmentTree", operations, [&]() {
+            Value minimum = 0;
+            for (const Range& range : ranges) {
+                minimum += minTree.query(range.first, range.second);
+            }
+            wtl_bench::doNotOptimize(minimum);
+        });
+    }
+
+}
+
+int main() {
+    constexpr std::size_t queries = 4000000;
+    for (std::size_t size : {std::size_t(1) << 12, std::size_t(1) << 20}) {
+        runSum(size, queries);
+    }
+    for (std::size_t size : {std::size_t(1) << 12, std::size_t(1) << 20}) {
+        runMin(size, queries);
+    }
+    for (std::size_t size : {std::size_t(1) << 12, std::size_t(1) << 20}) {
+        runDynamic(size, queries / 4);
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace wtl_bench {
+
+    /**
+     * Prevent the compiler from optimising away a computed value.
+     * @tparam T
+     * @param value
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * Run a function once and print the average time taken per operation.
+     * @tparam Func
+     * @param name Name printed alongside the result
+     * @param operations Number of operations done by the function, used to compute the average
+     * @param func
+     * @return Average time per operation in nanoseconds
+     */
+    template<typename Func>
+    double measure(const std::string& name, std::size_t operations, Func&& func) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count();
+        double perOperation = nanoseconds / static_cast<double>(operations);
+        std::printf("%-56s %12.2f ns/op %12.2f Mop/s\n", name.c_str(), perOperation, 1e3 / perOperation);
+        return perOperation;
+    }
+
+    /**
+     * Print a section header.
+     * @param title
+     */
+    inline void section(const std::string& title) {
+        std::printf("\n== %s ==\n", title.c_str());
+    }
+
+    /**
+     * Generate pseudo-random 64 bit keys using a fixed seed, so that runs can be compared.
+     * @param count
+     * @param seed
+     * @return
+     */
+    inline std::vector<std::uint64_t> randomKeys(std::size_t count, std::uint64_t seed = 42) {
+        std::mt19937_64 generator(seed);
+        std::vector<std::uint64_t> keys(count);
+        for (std::uint64_t& key : keys) {
+            key = generator();
+        }
+        return keys;
+    }
+
+}
@@ -0,0 +1,1243 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "impl/DataStructuresImpl.h"
+
+#if defined(__AVX2__)
+#define WTL_BTREEMAP_AVX2
+#include <immintrin.h>
+#endif
+
+namespace wtl {
+
+    template<typename K, typename V, typename Comparator>
+    class BTreeMap;
+
+    namespace impl {
+
+        /**
+         * Number of keys a node of a BTreeMap holds. The keys of a node fill 4 cache lines, so that a node is searched
+         * with a handful of cache misses that the hardware prefetcher can overlap. Always even, so that a full node
+         * splits into two halves that are both at least half full.
+         * @tparam K
+         * @return
+         */
+        template<typename K>
+        constexpr std::size_t bTreeCapacity() noexcept {
+            constexpr std::size_t bytes = 4 * 64;
+            constexpr std::size_t capacity = bytes / sizeof(K) < 8 ? 8 : bytes / sizeof(K);
+            return capacity - capacity % 2;
+        }
+
+        /**
+         * Base of the nodes of a BTreeMap
+         */
+        struct BTreeNode {
+
+            /// Number of keys
+            std::size_t m_Count = 0;
+
+        };
+
+        /**
+         * Leaf of a BTreeMap, holding the key-value pairs. Keys and values are kept in separate arrays, so that
+         * searching only touches the keys. There is room for one extra key-value pair, which is inserted before the
+         * leaf is split.
+         * @tparam K
+         * @tparam V
+         */
+        template<typename K, typename V>
+        struct BTreeLeaf : BTreeNode {
+
+            static constexpr std::size_t CAPACITY = bTreeCapacity<K>();
+
+            /// Previous leaf in ascending order of keys
+            BTreeLeaf<K, V>* m_Prev = nullptr;
+
+            /// Next leaf in ascending order of keys
+            BTreeLeaf<K, V>* m_Next = nullptr;
+
+            K m_Keys[CAPACITY + 1];
+
+            V m_Values[CAPACITY + 1];
+
+        };
+
+        /**
+         * Inner node of a BTreeMap. Child i holds the keys that are not less than key i - 1 and less than key i.
+         * There is room for one extra key and child, which is inserted before the node is split.
+         * @tparam K
+         */
+        template<typename K>
+        struct BTreeInner : BTreeNode {
+
+            static constexpr std::size_t CAPACITY = bTreeCapacity<K>();
+
+            K m_Keys[CAPACITY + 1];
+
+            BTreeNode* m_Children[CAPACITY + 2];
+
+        };
+
+        /**
+         * Whether the keys of a node are searched by counting the keys less than the key being searched for, which
+         * takes no branches and is done with vector compares. Otherwise, binary search is used.
+         * @tparam K
+         * @tparam Comparator
+         */
+        template<typename K, typename Comparator>
+        constexpr bool IS_COUNTING_SEARCH = std::is_same_v<Comparator, impl::ds::StandardComparator<K>> &&
+                                            std::is_integral_v<K> && (sizeof(K) == 4 || sizeof(K) == 8);
+
+        /**
+         * Count the keys less than the key, or not greater than the key if OrEqual is true.
+         * @tparam OrEqual
+         * @tparam K Integer of 4 or 8 bytes
+         * @param keys
+         * @param count
+         * @param key
+         * @return
+         */
+        template<bool OrEqual, typename K>
+        std::size_t countLess(const K* keys, std::size_t count, K key) noexcept {
+            std::size_t i = 0;
+            std::size_t result = 0;
+#ifdef WTL_BTREEMAP_AVX2
+            // Flipping the sign bit turns unsigned compares into the signed compares that AVX2 has.
+            if constexpr (sizeof(K) == 8) {
+                const __m256i flip = _mm256_set1_epi64x(std::is_signed_v<K> ? 0 : INT64_MIN);
+                const __m256i needle = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(key)), flip);
+                __m256i counts = _mm256_setzero_si256();
+                for (; i + 4 <= count; i += 4) {
+                    __m256i lane = _mm256_xor_si256(
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), flip);
+                    // Each lane of a compare is 0 or -1.
+                    counts = _mm256_sub_epi64(counts, OrEqual ? _mm256_cmpgt_epi64(lane, needle)
+                                                              : _mm256_cmpgt_epi64(needle, lane));
+                }
+                alignas(32) std::int64_t lanes[4];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), counts);
+                result = static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+            } else {
+                const __m256i flip = _mm256_set1_epi32(std::is_signed_v<K> ? 0 : INT32_MIN);
+                const __m256i needle = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(key)), flip);
+                __m256i counts = _mm256_setzero_si256();
+                for (; i + 8 <= count; i += 8) {
+                    __m256i lane = _mm256_xor_si256(
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), flip);
+                    counts = _mm256_sub_epi32(counts, OrEqual ? _mm256_cmpgt_epi32(lane, needle)
+                                                              : _mm256_cmpgt_epi32(needle, lane));
+                }
+                alignas(32) std::int32_t lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), counts);
+                for (std::int32_t lane : lanes) {
+                    result += static_cast<std::size_t>(lane);
+                }
+            }
+            if constexpr (OrEqual) {
+                // The vector loop counted the keys greater than the key.
+                result = i - result;
+            }
+#endif
+            // No early exit, so that the compiler can vectorize the loop when AVX2 is not enabled.
+            for (; i < count; i++) {
+                result += OrEqual ? !(key < keys[i]) : keys[i] < key;
+            }
+            return result;
+        }
+
+        /**
+         * Index of the first key of a node that is not less than the key.
+         * @tparam K
+         * @tparam Comparator
+         * @param keys
+         * @param count
+         * @param key
+         * @param comparator
+         * @return
+         */
+        template<typename K, typename Comparator>
+        std::size_t lowerBoundIndex(const K* keys, std::size_t count, const K& key, const Comparator& comparator) {
+            if constexpr (IS_COUNTING_SEARCH<K, Comparator>) {
+                return countLess<false>(keys, count, key);
+            } else {
+                return std::lower_bound(keys, keys + count, key, comparator) - keys;
+            }
+        }
+
+        /**
+         * Index of the first key of a node that is greater than the key.
+         * @tparam K
+         * @tparam Comparator
+         * @param keys
+         * @param count
+         * @param key
+         * @param comparator
+         * @return
+         */
+        template<typename K, typename Comparator>
+        std::size_t upperBoundIndex(const K* keys, std::size_t count, const K& key, const Comparator& comparator) {
+            if constexpr (IS_COUNTING_SEARCH<K, Comparator>) {
+                return countLess<true>(keys, count, key);
+            } else {
+                return std::upper_bound(keys, keys + count, key, comparator) - keys;
+            }
+        }
+
+        /**
+         * Bidirectional iterator over the key-value pairs of a BTreeMap, in ascending order of keys.
+         * Dereferencing gives a pair of references to the key and the value.
+         * @tparam K
+         * @tparam V
+         * @tparam IsConst Whether the values are accessed as const
+         */
+        template<typename K, typename V, bool IsConst>
+        class BTreeMapIterator {
+        private:
+
+            typedef BTreeLeaf<K, V> Leaf;
+
+            template<typename, typename, typename>
+            friend class wtl::BTreeMap;
+
+            friend class BTreeMapIterator<K, V, !IsConst>;
+
+            /// Current leaf, nullptr for the end
+            Leaf* m_Leaf = nullptr;
+
+            /// Index within the current leaf
+            std::size_t m_Index = 0;
+
+            /// Last leaf of the tree, needed to step back from the end
+            Leaf* const* m_Last = nullptr;
+
+            BTreeMapIterator(Leaf* leaf, std::size_t index, Leaf* const* last) noexcept
+                    : m_Leaf(leaf), m_Index(index), m_Last(last) {
+                if (m_Leaf != nullptr && m_Index == m_Leaf->m_Count) {
+                    m_Leaf = m_Leaf->m_Next;
+                    m_Index = 0;
+                }
+            }
+
+        public:
+
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef std::pair<const K&, std::conditional_t<IsConst, const V&, V&>> value_type;
+            typedef value_type reference;
+            typedef std::ptrdiff_t difference_type;
+
+            /**
+             * Gives operator-> something to point to, since the pair is created on the fly.
+             */
+            struct pointer {
+                value_type m_Pair;
+
+                value_type* operator->() noexcept {
+                    return &m_Pair;
+                }
+            };
+
+            BTreeMapIterator() = default;
+
+            /**
+             * Conversion from a non-const iterator to a const iterator
+             * @param other
+             */
+            template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+            BTreeMapIterator(const BTreeMapIterator<K, V, OtherConst>& other) noexcept
+                    : m_Leaf(other.m_Leaf), m_Index(other.m_Index), m_Last(other.m_Last) {}
+
+            reference operator*() const noexcept {
+                return {m_Leaf->m_Keys[m_Index], m_Leaf->m_Values[m_Index]};
+            }
+
+            pointer operator->() const noexcept {
+                return {{m_Leaf->m_Keys[m_Index], m_Leaf->m_Values[m_Index]}};
+            }
+
+            BTreeMapIterator& operator++() noexcept {
+                if (++m_Index == m_Leaf->m_Count) {
+                    m_Leaf = m_Leaf->m_Next;
+                    m_Index = 0;
+                }
+                return *this;
+            }
+
+            BTreeMapIterator operator++(int) noexcept {
+                BTreeMapIterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            BTreeMapIterator& operator--() noexcept {
+                if (m_Leaf == nullptr) {
+                    m_Leaf = *m_Last;
+                    m_Index = m_Leaf->m_Count;
+                } else if (m_Index == 0) {
+                    m_Leaf = m_Leaf->m_Prev;
+                    m_Index = m_Leaf->m_Count;
+                }
+                m_Index--;
+                return *this;
+            }
+
+            BTreeMapIterator operator--(int) noexcept {
+                BTreeMapIterator copy = *this;
+                --*this;
+                return copy;
+            }
+
+            bool operator==(const BTreeMapIterator& other) const noexcept {
+                return m_Leaf == other.m_Leaf && m_Index == other.m_Index;
+            }
+
+            bool operator!=(const BTreeMapIterator& other) const noexcept {
+                return !(*this == other);
+            }
+
+        };
+
+    }
+
+    /**
+     * An ordered map implemented as a B+ tree. Every node holds many keys, sized to a few cache lines, so that a
+     * search visits few nodes and scans the keys of each node in contiguous memory, instead of following a pointer
+     * per comparison as TreeMap does. Integer keys with the default ordering are searched with vector compares.
+     * Key-value pairs are only stored in the leaves, which are linked to each other, so iterating and range scans
+     * walk arrays from leaf to leaf.
+     * Insertion, searching and removal take O(log n) time. Inserting or erasing invalidates all iterators and
+     * references into the map, since key-value pairs move between and within leaves.
+     * Keys and values must be default constructible and move assignable.
+     * @tparam K
+     * @tparam V
+     * @tparam Comparator Strict weak ordering of the keys
+     */
+    template<typename K, typename V, typename Comparator = impl::ds::StandardComparator<K>>
+    class BTreeMap {
+    private:
+
+        typedef impl::BTreeNode Node;
+        typedef impl::BTreeLeaf<K, V> Leaf;
+        typedef impl::BTreeInner<K> Inner;
+
+        static constexpr std::size_t LEAF_CAPACITY = Leaf::CAPACITY;
+        static constexpr std::size_t INNER_CAPACITY = Inner::CAPACITY;
+
+        /// Every node but the root holds at least half as many keys as it can
+        static constexpr std::size_t LEAF_MINIMUM = LEAF_CAPACITY / 2;
+        static constexpr std::size_t INNER_MINIMUM = INNER_CAPACITY / 2;
+
+        /// Inner nodes hold at least 4 keys, so 32 levels are more than can be addressed
+        static constexpr std::size_t MAXIMUM_DEPTH = 32;
+
+        /**
+         * An inner node visited on the way down to a leaf, and the index of the child that was followed.
+         */
+        struct PathEntry {
+            Inner* m_Node;
+            std::size_t m_Index;
+        };
+
+    public:
+
+        typedef impl::BTreeMapIterator<K, V, false> Iterator;
+        typedef impl::BTreeMapIterator<K, V, true> ConstIterator;
+        typedef std::pair<std::reference_wrapper<const K>, std::reference_wrapper<V>> KeyValuePairResult;
+
+    private:
+
+        /// Number of key-value pairs
+        std::size_t m_Size = 0;
+
+        /// Number of levels of inner nodes above the leaves
+        std::size_t m_Depth = 0;
+
+        /// Root of the tree, a leaf if m_Depth is 0
+        Node* m_Root = nullptr;
+
+        /// Leaf with the smallest keys
+        Leaf* m_First = nullptr;
+
+        /// Leaf with the largest keys
+        Leaf* m_Last = nullptr;
+
+        /// Ordering of the keys
+        Comparator m_Comparator;
+
+        [[nodiscard]] bool equivalent(const K& a, const K& b) const {
+            return !m_Comparator(a, b) && !m_Comparator(b, a);
+        }
+
+        /**
+         * Descend to the leaf that holds the key, if it exists.
+         * @param key
+         * @param path If not nullptr, filled with the inner nodes visited
+         * @return
+         */
+        Leaf* findLeaf(const K& key, PathEntry* path = nullptr) const {
+            Node* node = m_Root;
+            for (std::size_t level = 0; level < m_Depth; level++) {
+                Inner* inner = static_cast<Inner*>(node);
+                std::size_t index = impl::upperBoundIndex(inner->m_Keys, inner->m_Count, key, m_Comparator);
+                if (path != nullptr) {
+                    path[level] = {inner, index};
+                }
+                node = inner->m_Children[index];
+            }
+            return static_cast<Leaf*>(node);
+        }
+
+        /**
+         * Find the position of a key.
+         * @param key
+         * @return The leaf and the index within it, or nullptr if the key does not exist.
+         */
+        [[nodiscard]] std::pair<Leaf*, std::size_t> findPosition(const K& key) const {
+            if (m_Root == nullptr) {
+                return {nullptr, 0};
+            }
+            Leaf* leaf = findLeaf(key);
+            std::size_t index = impl::lowerBoundIndex(leaf->m_Keys, leaf->m_Count, key, m_Comparator);
+            if (index == leaf->m_Count || m_Comparator(key, leaf->m_Keys[index])) {
+                return {nullptr, 0};
+            }
+            return {leaf, index};
+        }
+
+        /**
+         * Position of the first key not less than the key (or greater than the key, if Upper is true).
+         * @tparam Upper
+         * @param key
+         * @return
+         */
+        template<bool Upper>
+        [[nodiscard]] std::pair<Leaf*, std::size_t> boundPosition(const K& key) const {
+            if (m_Root == nullptr) {
+                return {nullptr, 0};
+            }
+            Leaf* leaf = findLeaf(key);
+            if constexpr (Upper) {
+                return {leaf, impl::upperBoundIndex(leaf->m_Keys, leaf->m_Count, key, m_Comparator)};
+            } else {
+                return {leaf, impl::lowerBoundIndex(leaf->m_Keys, leaf->m_Count, key, m_Comparator)};
+            }
+        }
+
+        /**
+         * Nodes allocated before an insertion that splits nodes modifies the tree, so that a failed allocation leaves
+         * the tree unchanged. Nodes that are not used are freed.
+         */
+        struct SplitNodes {
+
+            Leaf* m_Leaf = nullptr;
+
+            Inner* m_Inners[MAXIMUM_DEPTH + 1] = {};
+
+            std::size_t m_InnerCount = 0;
+
+            SplitNodes() = default;
+
+            SplitNodes(const SplitNodes&) = delete;
+
+            SplitNodes& operator=(const SplitNodes&) = delete;
+
+            Inner* takeInner() noexcept {
+                return std::exchange(m_Inners[--m_InnerCount], nullptr);
+            }
+
+            ~SplitNodes() {
+                delete m_Leaf;
+                for (std::size_t i = 0; i < m_InnerCount; i++) {
+                    delete m_Inners[i];
+                }
+            }
+
+        };
+
+        /**
+         * Insert a separator key and the node to its right into the parent of a node that was split, splitting
+         * parents in turn if they overflow.
+         * @param path
+         * @param level Number of inner nodes above the node that was split
+         * @param separator
+         * @param right
+         * @param nodes Inner nodes allocated for the parents that are split, and for a new root
+         */
+        void insertIntoParent(PathEntry* path, std::size_t level, K&& separator, Node* right, SplitNodes& nodes) {
+            if (level == 0) {
+                Inner* root = nodes.takeInner();
+                root->m_Keys[0] = std::move(separator);
+                root->m_Children[0] = m_Root;
+                root->m_Children[1] = right;
+                root->m_Count = 1;
+                m_Root = root;
+                m_Depth++;
+                return;
+            }
+            auto[inner, index] = path[level - 1];
+            std::move_backward(inner->m_Keys + index, inner->m_Keys + inner->m_Count,
+                               inner->m_Keys + inner->m_Count + 1);
+            std::move_backward(inner->m_Children + index + 1, inner->m_Children + inner->m_Count + 1,
+                               inner->m_Children + inner->m_Count + 2);
+            inner->m_Keys[index] = std::move(separator);
+            inner->m_Children[index + 1] = right;
+            if (++inner->m_Count <= INNER_CAPACITY) {
+                return;
+            }
+            // The middle key moves up, the keys after it move to a new node.
+            std::size_t middle = inner->m_Count / 2;
+            Inner* sibling = nodes.takeInner();
+            sibling->m_Count = inner->m_Count - middle - 1;
+            std::move(inner->m_Keys + middle + 1, inner->m_Keys + inner->m_Count, sibling->m_Keys);
+            std::copy(inner->m_Children + middle + 1, inner->m_Children + inner->m_Count + 1, sibling->m_Children);
+            inner->m_Count = middle;
+            insertIntoParent(path, level - 1, std::move(inner->m_Keys[middle]), sibling, nodes);
+        }
+
+        /**
+         * Find the key, or insert it along with a value constructed from the arguments.
+         * The key, the value, the separator of a split and every node the insertion needs are created before the tree
+         * is modified, so the tree is unchanged if any of them throws.
+         * @tparam Key
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return The leaf and index of the key, and true if insertion occurred.
+         */
+        template<typename Key, typename ... Ts>
+        std::pair<std::pair<Leaf*, std::size_t>, bool> findOrInsert(Key&& key, Ts&& ... args) {
+            PathEntry path[MAXIMUM_DEPTH];
+            Leaf* leaf = nullptr;
+            std::size_t index = 0;
+            if (m_Root != nullptr) {
+                leaf = findLeaf(key, path);
+                index = impl::lowerBoundIndex(leaf->m_Keys, leaf->m_Count, key, m_Comparator);
+                if (index < leaf->m_Count && !m_Comparator(key, leaf->m_Keys[index])) {
+                    return {{leaf, index}, false};
+                }
+            }
+            K newKey(std::forward<Key>(key));
+            V newValue(std::forward<Ts>(args)...);
+            if (leaf == nullptr) {
+                leaf = new Leaf;
+                m_Root = m_First = m_Last = leaf;
+            }
+            if (leaf->m_Count < LEAF_CAPACITY) {
+                std::move_backward(leaf->m_Keys + index, leaf->m_Keys + leaf->m_Count,
+                                   leaf->m_Keys + leaf->m_Count + 1);
+                std::move_backward(leaf->m_Values + index, leaf->m_Values + leaf->m_Count,
+                                   leaf->m_Values + leaf->m_Count + 1);
+                leaf->m_Keys[index] = std::move(newKey);
+                leaf->m_Values[index] = std::move(newValue);
+                leaf->m_Count++;
+                m_Size++;
+                return {{leaf, index}, true};
+            }
+
+            // The leaf splits, and so does every full inner node above it, up to a new root if they are all full.
+            SplitNodes nodes;
+            nodes.m_Leaf = new Leaf;
+            std::size_t level = m_Depth;
+            while (level > 0 && path[level - 1].m_Node->m_Count == INNER_CAPACITY) {
+                nodes.m_Inners[nodes.m_InnerCount++] = new Inner;
+                level--;
+            }
+            if (level == 0) {
+                nodes.m_Inners[nodes.m_InnerCount++] = new Inner;
+            }
+            // The second half moves to the new leaf, and its first key separates the two.
+            std::size_t middle = (LEAF_CAPACITY + 1) / 2;
+            K separator(index < middle ? leaf->m_Keys[middle - 1] : index == middle ? newKey : leaf->m_Keys[middle]);
+
+            std::move_backward(leaf->m_Keys + index, leaf->m_Keys + leaf->m_Count, leaf->m_Keys + leaf->m_Count + 1);
+            std::move_backward(leaf->m_Values + index, leaf->m_Values + leaf->m_Count,
+                               leaf->m_Values + leaf->m_Count + 1);
+            leaf->m_Keys[index] = std::move(newKey);
+            leaf->m_Values[index] = std::move(newValue);
+            leaf->m_Count++;
+            m_Size++;
+            Leaf* sibling = std::exchange(nodes.m_Leaf, nullptr);
+            sibling->m_Count = leaf->m_Count - middle;
+            std::move(leaf->m_Keys + middle, leaf->m_Keys + leaf->m_Count, sibling->m_Keys);
+            std::move(leaf->m_Values + middle, leaf->m_Values + leaf->m_Count, sibling->m_Values);
+            leaf->m_Count = middle;
+            linkAfter(leaf, sibling);
+            insertIntoParent(path, m_Depth, std::move(separator), sibling, nodes);
+            if (index >= middle) {
+                return {{sibling, index - middle}, true};
+            }
+            return {{leaf, index}, true};
+        }
+
+        void linkAfter(Leaf* leaf, Leaf* next) noexcept {
+            next->m_Prev = leaf;
+            next->m_Next = leaf->m_Next;
+            if (leaf->m_Next != nullptr) {
+                leaf->m_Next->m_Prev = next;
+            } else {
+                m_Last = next;
+            }
+            leaf->m_Next = next;
+        }
+
+        void unlink(Leaf* leaf) noexcept {
+            (leaf->m_Prev != nullptr ? leaf->m_Prev->m_Next : m_First) = leaf->m_Next;
+            (leaf->m_Next != nullptr ? leaf->m_Next->m_Prev : m_Last) = leaf->m_Prev;
+        }
+
+        /**
+         * Remove a key and the child to its right from an inner node.
+         * @param inner
+         * @param index
+         */
+        static void removeFromInner(Inner* inner, std::size_t index) noexcept {
+            std::move(inner->m_Keys + index + 1, inner->m_Keys + inner->m_Count, inner->m_Keys + index);
+            std::copy(inner->m_Children + index + 2, inner->m_Children + inner->m_Count + 1,
+                      inner->m_Children + index + 1);
+            inner->m_Count--;
+        }
+
+        /**
+         * Restore the minimum number of keys of a leaf after a removal, by borrowing from or merging with a sibling.
+         * @param path
+         * @param leaf
+         */
+        void rebalanceLeaf(PathEntry* path, Leaf* leaf) {
+            if (m_Depth == 0) {
+                if (leaf->m_Count == 0) {
+                    delete leaf;
+                    m_Root = nullptr;
+                    m_First = m_Last = nullptr;
+                }
+                return;
+            }
+            if (leaf->m_Count >= LEAF_MINIMUM) {
+                return;
+            }
+            auto[parent, index] = path[m_Depth - 1];
+            Leaf* left = index > 0 ? static_cast<Leaf*>(parent->m_Children[index - 1]) : nullptr;
+            Leaf* right = index < parent->m_Count ? static_cast<Leaf*>(parent->m_Children[index + 1]) : nullptr;
+            if (left != nullptr && left->m_Count > LEAF_MINIMUM) {
+                std::move_backward(leaf->m_Keys, leaf->m_Keys + leaf->m_Count, leaf->m_Keys + leaf->m_Count + 1);
+                std::move_backward(leaf->m_Values, leaf->m_Values + leaf->m_Count,
+                                   leaf->m_Values + leaf->m_Count + 1);
+                left->m_Count--;
+                leaf->m_Keys[0] = std::move(left->m_Keys[left->m_Count]);
+                leaf->m_Values[0] = std::move(left->m_Values[left->m_Count]);
+                leaf->m_Count++;
+                parent->m_Keys[index - 1] = leaf->m_Keys[0];
+            } else if (right != nullptr && right->m_Count > LEAF_MINIMUM) {
+                leaf->m_Keys[leaf->m_Count] = std::move(right->m_Keys[0]);
+                leaf->m_Values[leaf->m_Count] = std::move(right->m_Values[0]);
+                leaf->m_Count++;
+                std::move(right->m_Keys + 1, right->m_Keys + right->m_Count, right->m_Keys);
+                std::move(right->m_Values + 1, right->m_Values + right->m_Count, right->m_Values);
+                right->m_Count--;
+                parent->m_Keys[index] = right->m_Keys[0];
+            } else {
+                // Merge the right one of the two leaves into the left one.
+                if (left == nullptr) {
+                    left = leaf;
+                    index++;
+                } else {
+                    right = leaf;
+                }
+                std::move(right->m_Keys, right->m_Keys + right->m_Count, left->m_Keys + left->m_Count);
+                std::move(right->m_Values, right->m_Values + right->m_Count, left->m_Values + left->m_Count);
+                left->m_Count += right->m_Count;
+                unlink(right);
+                delete right;
+                removeFromInner(parent, index - 1);
+                rebalanceInner(path, m_Depth - 1);
+            }
+        }
+
+        /**
+         * Restore the minimum number of keys of an inner node after a removal, by borrowing from or merging with a
+         * sibling. Keys move through the parent, since the keys of inner nodes only separate their children.
+         * @param path
+         * @param level Number of inner nodes above the node
+         */
+        void rebalanceInner(PathEntry* path, std::size_t level) {
+            Inner* inner = path[level].m_Node;
+            if (level == 0) {
+                if (inner->m_Count == 0) {
+                    m_Root = inner->m_Children[0];
+                    m_Depth--;
+                    delete inner;
+                }
+                return;
+            }
+            if (inner->m_Count >= INNER_MINIMUM) {
+                return;
+            }
+            auto[parent, index] = path[level - 1];
+            Inner* left = index > 0 ? static_cast<Inner*>(parent->m_Children[index - 1]) : nullptr;
+            Inner* right = index < parent->m_Count ? static_cast<Inner*>(parent->m_Children[index + 1]) : nullptr;
+            if (left != nullptr && left->m_Count > INNER_MINIMUM) {
+                std::move_backward(inner->m_Keys, inner->m_Keys + inner->m_Count,
+                                   inner->m_Keys + inner->m_Count + 1);
+                std::copy_backward(inner->m_Children, inner->m_Children + inner->m_Count + 1,
+                                   inner->m_Children + inner->m_Count + 2);
+                inner->m_Keys[0] = std::move(parent->m_Keys[index - 1]);
+                inner->m_Children[0] = left->m_Children[left->m_Count];
+                inner->m_Count++;
+                parent->m_Keys[index - 1] = std::move(left->m_Keys[left->m_Count - 1]);
+                left->m_Count--;
+            } else if (right != nullptr && right->m_Count > INNER_MINIMUM) {
+                inner->m_Keys[inner->m_Count] = std::move(parent->m_Keys[index]);
+                inner->m_Children[inner->m_Count + 1] = right->m_Children[0];
+                inner->m_Count++;
+                parent->m_Keys[index] = std::move(right->m_Keys[0]);
+                std::move(right->m_Keys + 1, right->m_Keys + right->m_Count, right->m_Keys);
+                std::copy(right->m_Children + 1, right->m_Children + right->m_Count + 1, right->m_Children);
+                right->m_Count--;
+            } else {
+                if (left == nullptr) {
+                    left = inner;
+                    index++;
+                } else {
+                    right = inner;
+                }
+                left->m_Keys[left->m_Count] = std::move(parent->m_Keys[index - 1]);
+                std::move(right->m_Keys, right->m_Keys + right->m_Count, left->m_Keys + left->m_Count + 1);
+                std::copy(right->m_Children, right->m_Children + right->m_Count + 1,
+                          left->m_Children + left->m_Count + 1);
+                left->m_Count += right->m_Count + 1;
+                delete right;
+                removeFromInner(parent, index - 1);
+                rebalanceInner(path, level - 1);
+            }
+        }
+
+        void clearNodes(Node* node, std::size_t level) noexcept {
+            if (level == m_Depth) {
+                delete static_cast<Leaf*>(node);
+                return;
+            }
+            Inner* inner = static_cast<Inner*>(node);
+            for (std::size_t i = 0; i <= inner->m_Count; i++) {
+                clearNodes(inner->m_Children[i], level + 1);
+            }
+            delete inner;
+        }
+
+        /**
+         * Fill the map from key-value pairs in strictly ascending order of keys. If anything throws, the nodes built
+         * so far are deleted and the map is left empty.
+         * @tparam InputIterator
+         * @param first
+         * @param last
+         */
+        template<typename InputIterator>
+        void load(InputIterator first, InputIterator last) {
+            std::vector<Inner*> inners;
+            try {
+                loadNodes(first, last, inners);
+            } catch (...) {
+                for (Inner* inner : inners) {
+                    delete inner;
+                }
+                clearLeaves();
+                throw;
+            }
+        }
+
+        /**
+         * Build the leaves and inner nodes of load(). Leaves are kept linked from m_First as they are made, and inner
+         * nodes are recorded in inners, so that load() can delete them if anything throws.
+         * @tparam InputIterator
+         * @param first
+         * @param last
+         * @param inners
+         */
+        template<typename InputIterator>
+        void loadNodes(InputIterator first, InputIterator last, std::vector<Inner*>& inners) {
+            // Leaves are filled completely, except that the last two are evened out so that both are half full.
+            std::vector<Node*> level;
+            std::vector<K> separators;
+            for (; first != last; ++first) {
+                const auto& pair = *first;
+                if (m_Last != nullptr && m_Last->m_Count > 0 &&
+                    !m_Comparator(m_Last->m_Keys[m_Last->m_Count - 1], pair.first)) {
+                    throw std::invalid_argument("Keys are not in strictly ascending order");
+                }
+                if (m_Last == nullptr || m_Last->m_Count == LEAF_CAPACITY) {
+                    Leaf* leaf = new Leaf;
+                    if (m_Last == nullptr) {
+                        m_First = m_Last = leaf;
+                    } else {
+                        linkAfter(m_Last, leaf);
+                    }
+                    level.push_back(leaf);
+                }
+                m_Last->m_Keys[m_Last->m_Count] = pair.first;
+                m_Last->m_Values[m_Last->m_Count] = pair.second;
+                m_Last->m_Count++;
+                m_Size++;
+            }
+            if (level.empty()) {
+                return;
+            }
+            if (level.size() > 1 && m_Last->m_Count < LEAF_MINIMUM) {
+                Leaf* previous = m_Last->m_Prev;
+                std::size_t moved = (previous->m_Count - m_Last->m_Count) / 2;
+                std::move_backward(m_Last->m_Keys, m_Last->m_Keys + m_Last->m_Count,
+                                   m_Last->m_Keys + m_Last->m_Count + moved);
+                std::move_backward(m_Last->m_Values, m_Last->m_Values + m_Last->m_Count,
+                                   m_Last->m_Values + m_Last->m_Count + moved);
+                std::move(previous->m_Keys + previous->m_Count - moved, previous->m_Keys + previous->m_Count,
+                          m_Last->m_Keys);
+                std::move(previous->m_Values + previous->m_Count - moved, previous->m_Values + previous->m_Count,
+                          m_Last->m_Values);
+                previous->m_Count -= moved;
+                m_Last->m_Count += moved;
+            }
+            for (std::size_t i = 1; i < level.size(); i++) {
+                separators.push_back(static_cast<Leaf*>(level[i])->m_Keys[0]);
+            }
+            // Build each level of inner nodes from the one below, spreading the children evenly.
+            while (level.size() > 1) {
+                std::size_t nodes = (level.size() + INNER_CAPACITY) / (INNER_CAPACITY + 1);
+                std::vector<Node*> parents;
+                std::vector<K> parentSeparators;
+                std::size_t child = 0;
+                for (std::size_t i = 0; i < nodes; i++) {
+                    std::size_t children = level.size() / nodes + (i < level.size() % nodes ? 1 : 0);
+                    inners.push_back(nullptr);
+                    Inner* inner = new Inner;
+                    inners.back() = inner;
+                    inner->m_Count = children - 1;
+                    inner->m_Children[0] = level[child];
+                    for (std::size_t j = 1; j < children; j++) {
+                        inner->m_Keys[j - 1] = std::move(separators[child + j - 1]);
+                        inner->m_Children[j] = level[child + j];
+                    }
+                    child += children;
+                    if (i + 1 < nodes) {
+                        parentSeparators.push_back(std::move(separators[child - 1]));
+                    }
+                    parents.push_back(inner);
+                }
+                level = std::move(parents);
+                separators = std::move(parentSeparators);
+                m_Depth++;
+            }
+            m_Root = level.front();
+        }
+
+        /**
+         * Delete a chain of leaves that is not yet part of a tree.
+         */
+        void clearLeaves() noexcept {
+            while (m_First != nullptr) {
+                delete std::exchange(m_First, m_First->m_Next);
+            }
+            m_Root = nullptr;
+            m_Last = nullptr;
+            m_Size = 0;
+            m_Depth = 0;
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param comparator
+         */
+        explicit BTreeMap(Comparator comparator = Comparator()) : m_Comparator(std::move(comparator)) {}
+
+        /**
+         * Constructor, bulk loading key-value pairs that are sorted in strictly ascending order of keys.
+         * Building the tree bottom-up takes O(n) time and packs the leaves full.
+         * @tparam InputIterator Iterator to pairs with members first and second
+         * @param first
+         * @param last
+         * @param comparator
+         * @throws std::invalid_argument If the keys are not in strictly ascending order
+         */
+        template<typename InputIterator>
+        BTreeMap(InputIterator first, InputIterator last, Comparator comparator = Comparator())
+                : m_Comparator(std::move(comparator)) {
+            load(first, last);
+        }
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        BTreeMap(const BTreeMap& other) : m_Comparator(other.m_Comparator) {
+            load(other.begin(), other.end());
+        }
+
+        /**
+         * Copy assignment
+         * @param other
+         * @return
+         */
+        BTreeMap& operator=(const BTreeMap& other) {
+            if (this != &other) {
+                clear();
+                m_Comparator = other.m_Comparator;
+                load(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        /**
+         * Move constructor
+         * @param other
+         */
+        BTreeMap(BTreeMap&& other) noexcept
+                : m_Size(std::exchange(other.m_Size, 0)), m_Depth(std::exchange(other.m_Depth, 0)),
+                  m_Root(std::exchange(other.m_Root, nullptr)), m_First(std::exchange(other.m_First, nullptr)),
+                  m_Last(std::exchange(other.m_Last, nullptr)), m_Comparator(other.m_Comparator) {}
+
+        /**
+         * Move assignment
+         * @param other
+         * @return
+         */
+        BTreeMap& operator=(BTreeMap&& other) noexcept {
+            if (this != &other) {
+                clear();
+                m_Comparator = other.m_Comparator;
+                m_Size = std::exchange(other.m_Size, 0);
+                m_Depth = std::exchange(other.m_Depth, 0);
+                m_Root = std::exchange(other.m_Root, nullptr);
+                m_First = std::exchange(other.m_First, nullptr);
+                m_Last = std::exchange(other.m_Last, nullptr);
+            }
+            return *this;
+        }
+
+        /**
+         * Replace the contents of the map by bulk loading key-value pairs that are sorted in strictly ascending order
+         * of keys, in O(n) time. If the keys are not sorted, the map is left empty.
+         * @tparam InputIterator Iterator to pairs with members first and second
+         * @param first
+         * @param last
+         * @throws std::invalid_argument If the keys are not in strictly ascending order
+         */
+        template<typename InputIterator>
+        void bulkLoad(InputIterator first, InputIterator last) {
+            clear();
+            load(first, last);
+        }
+
+        /**
+         * Get the number of elements
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Check if container is empty
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return m_Size == 0;
+        }
+
+        /**
+         * Get the height of the tree, counting the leaves as one level.
+         * @return
+         */
+        [[nodiscard]] std::size_t getHeight() const noexcept {
+            return m_Root == nullptr ? 0 : m_Depth + 1;
+        }
+
+        /**
+         * Retrieve the value mapped to a key.
+         * @param key
+         * @return std::optional holding a reference to the value, or std::nullopt if the key does not exist.
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const K& key) {
+            auto[leaf, index] = findPosition(key);
+            if (leaf == nullptr) {
+                return std::nullopt;
+            }
+            return leaf->m_Values[index];
+        }
+
+        /**
+         * Retrieve the value mapped to a key.
+         * @param key
+         * @return std::optional holding a const reference to the value, or std::nullopt if the key does not exist.
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const K& key) const {
+            auto[leaf, index] = findPosition(key);
+            if (leaf == nullptr) {
+                return std::nullopt;
+            }
+            return leaf->m_Values[index];
+        }
+
+        /**
+         * Check if a key exists
+         * @param key
+         * @return
+         */
+        [[nodiscard]] bool contains(const K& key) const {
+            return findPosition(key).first != nullptr;
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, const V& value) {
+            auto[position, inserted] = findOrInsert(key, value);
+            return {{position.first->m_Keys[position.second], position.first->m_Values[position.second]}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, V&& value) {
+            auto[position, inserted] = findOrInsert(key, std::move(value));
+            return {{position.first->m_Keys[position.second], position.first->m_Values[position.second]}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the value is replaced.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, const V& value) {
+            auto[position, inserted] = findOrInsert(key, value);
+            auto[leaf, index] = position;
+            if (!inserted) {
+                leaf->m_Values[index] = value;
+            }
+            return {{leaf->m_Keys[index], leaf->m_Values[index]}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the value is replaced.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, V&& value) {
+            auto[leaf, index] = findPosition(key);
+            if (leaf != nullptr) {
+                leaf->m_Values[index] = std::move(value);
+                return {{leaf->m_Keys[index], leaf->m_Values[index]}, false};
+            }
+            return insert(key, std::move(value));
+        }
+
+        /**
+         * Construct value in-place. If key already exists, then nothing happens.
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        template<typename ... Ts>
+        std::pair<KeyValuePairResult, bool> emplace(const K& key, Ts&& ... args) {
+            auto[position, inserted] = findOrInsert(key, std::forward<Ts>(args)...);
+            return {{position.first->m_Keys[position.second], position.first->m_Values[position.second]}, inserted};
+        }
+
+        /**
+         * Construct value in-place, moving the key into the map. If key already exists, then nothing happens and the
+         * key is not moved from.
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        template<typename ... Ts>
+        std::pair<KeyValuePairResult, bool> emplace(K&& key, Ts&& ... args) {
+            auto[position, inserted] = findOrInsert(std::move(key), std::forward<Ts>(args)...);
+            return {{position.first->m_Keys[position.second], position.first->m_Values[position.second]}, inserted};
+        }
+
+        /**
+         * Remove the key-value pair with the key.
+         * @param key
+         * @return True if key was found and removed, false if not.
+         */
+        bool erase(const K& key) {
+            if (m_Root == nullptr) {
+                return false;
+            }
+            PathEntry path[MAXIMUM_DEPTH];
+            Leaf* leaf = findLeaf(key, path);
+            std::size_t index = impl::lowerBoundIndex(leaf->m_Keys, leaf->m_Count, key, m_Comparator);
+            if (index == leaf->m_Count || m_Comparator(key, leaf->m_Keys[index])) {
+                return false;
+            }
+            std::move(leaf->m_Keys + index + 1, leaf->m_Keys + leaf->m_Count, leaf->m_Keys + index);
+            std::move(leaf->m_Values + index + 1, leaf->m_Values + leaf->m_Count, leaf->m_Values + index);
+            leaf->m_Count--;
+            m_Size--;
+            rebalanceLeaf(path, leaf);
+            return true;
+        }
+
+        /**
+         * Remove the key-value pair an iterator points to.
+         * @param iterator Must not be the end
+         * @return Iterator to the next key-value pair
+         */
+        Iterator erase(Iterator iterator) {
+            K key = iterator->first;
+            erase(key);
+            return lowerBound(key);
+        }
+
+        [[nodiscard]] Iterator begin() noexcept {
+            return {m_First, 0, &m_Last};
+        }
+
+        [[nodiscard]] ConstIterator begin() const noexcept {
+            return {m_First, 0, &m_Last};
+        }
+
+        [[nodiscard]] Iterator end() noexcept {
+            return {nullptr, 0, &m_Last};
+        }
+
+        [[nodiscard]] ConstIterator end() const noexcept {
+            return {nullptr, 0, &m_Last};
+        }
+
+        /**
+         * Find the key-value pair with the key.
+         * @param key
+         * @return Iterator to the key-value pair, or end() if the key does not exist.
+         */
+        [[nodiscard]] Iterator find(const K& key) {
+            auto[leaf, index] = findPosition(key);
+            return {leaf, index, &m_Last};
+        }
+
+        [[nodiscard]] ConstIterator find(const K& key) const {
+            auto[leaf, index] = findPosition(key);
+            return {leaf, index, &m_Last};
+        }
+
+        /**
+         * Find the first key-value pair whose key is not less than the key.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] Iterator lowerBound(const K& key) {
+            auto[leaf, index] = boundPosition<false>(key);
+            return {leaf, index, &m_Last};
+        }
+
+        [[nodiscard]] ConstIterator lowerBound(const K& key) const {
+            auto[leaf, index] = boundPosition<false>(key);
+            return {leaf, index, &m_Last};
+        }
+
+        /**
+         * Find the first key-value pair whose key is greater than the key.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] Iterator upperBound(const K& key) {
+            auto[leaf, index] = boundPosition<true>(key);
+            return {leaf, index, &m_Last};
+        }
+
+        [[nodiscard]] ConstIterator upperBound(const K& key) const {
+            auto[leaf, index] = boundPosition<true>(key);
+            return {leaf, index, &m_Last};
+        }
+
+        /**
+         * The key-value pairs with keys from low, inclusive, to high, exclusive, for use in a range-based for loop.
+         * @param low
+         * @param high
+         * @return
+         */
+        [[nodiscard]] impl::ds::IteratorRange<Iterator> range(const K& low, const K& high) {
+            if (!m_Comparator(low, high)) {
+                return {end(), end()};
+            }
+            return {lowerBound(low), lowerBound(high)};
+        }
+
+        [[nodiscard]] impl::ds::IteratorRange<ConstIterator> range(const K& low, const K& high) const {
+            if (!m_Comparator(low, high)) {
+                return {end(), end()};
+            }
+            return {lowerBound(low), lowerBound(high)};
+        }
+
+        /**
+         * Call a function on each key-value pair with keys from low, inclusive, to high, exclusive, in ascending
+         * order of keys. Walks the leaves directly, comparing only the keys of the last leaf against high.
+         * @tparam Func Callable taking const K& and V&
+         * @param low
+         * @param high
+         * @param func
+         */
+        template<typename Func>
+        void forEachInRange(const K& low, const K& high, Func&& func) {
+            if (!m_Comparator(low, high)) {
+                return;
+            }
+            auto[leaf, index] = boundPosition<false>(low);
+            for (; leaf != nullptr; leaf = leaf->m_Next, index = 0) {
+                bool last = leaf->m_Count > 0 && !m_Comparator(leaf->m_Keys[leaf->m_Count - 1], high);
+                std::size_t end = last ? impl::lowerBoundIndex(leaf->m_Keys, leaf->m_Count, high, m_Comparator)
+                                       : leaf->m_Count;
+                for (; index < end; index++) {
+                    func(static_cast<const K&>(leaf->m_Keys[index]), leaf->m_Values[index]);
+                }
+                if (last) {
+                    return;
+                }
+            }
+        }
+
+        /**
+         * Remove all elements. Size reset to 0.
+         */
+        void clear() noexcept {
+            if (m_Root != nullptr) {
+                clearNodes(m_Root, 0);
+            }
+            m_Root = nullptr;
+            m_First = m_Last = nullptr;
+            m_Size = 0;
+            m_Depth = 0;
+        }
+
+        /**
+         * Destructor
+         */
+        ~BTreeMap() {
+            clear();
+        }
+
+    };
+
+}
@@ -7,7 +7,9 @@
 #include <cstddef>
 #include <map>
 #include <functional>
+#include <optional>
 #include <stdexcept>
+#include "impl/DataStructuresImpl.h"
 
 namespace wtl {
 
@@ -88,7 +90,7 @@ namespace wtl {
          * @return
          */
         [[nodiscard]] bool empty() const noexcept {
-            return m_LeftMap == 0;
+            return m_LeftMap.empty();
         }
 
         /**
@@ -130,9 +132,9 @@ namespace wtl {
             // Get pointer to the inserted element "a"
             const A* aPtr = &(leftIt->first);
             auto[rightIt, rightResult] = m_RightMap.insert({std::move(b), aPtr});
-            // Duplicate element "b" was found
+            // Duplicate element "b" was found. "a" has been moved from, so erase using the iterator.
             if (!rightResult) {
-                m_LeftMap.erase(a);
+                m_LeftMap.erase(leftIt);
                 return false;
             }
             leftIt->second = &(rightIt->first);
@@ -165,6 +167,38 @@ namespace wtl {
             return *(result->second);
         }
 
+        /**
+         * Heterogeneous lookup of B from a value comparable with A, only available if Comparator_A declares
+         * is_transparent (such as std::less<>). The tag is required, so that the call is never ambiguous.
+         * @tparam Q
+         * @param a
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Comparator_A, A, Q>>
+        [[nodiscard]] std::optional<ReferenceB> find(const Q& a, BiMap_Left_Tag) const {
+            auto result = m_LeftMap.find(a);
+            if (result == m_LeftMap.end()) {
+                return std::nullopt;
+            }
+            return *(result->second);
+        }
+
+        /**
+         * Heterogeneous lookup of A from a value comparable with B, only available if Comparator_B declares
+         * is_transparent (such as std::less<>).
+         * @tparam Q
+         * @param b
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Comparator_B, B, Q>>
+        [[nodiscard]] std::optional<ReferenceA> find(const Q& b, BiMap_Right_Tag) const {
+            auto result = m_RightMap.find(b);
+            if (result == m_RightMap.end()) {
+                return std::nullopt;
+            }
+            return *(result->second);
+        }
+
         /**
          * Check if element of type A exists.
          * @param a
@@ -183,6 +217,28 @@ namespace wtl {
             return find(b, bimap_right_tag) != std::nullopt;
         }
 
+        /**
+         * Heterogeneous version of contains(...) for elements of type A.
+         * @tparam Q
+         * @param a
+         * @return True if it exists, false if not
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Comparator_A, A, Q>>
+        [[nodiscard]] bool contains(const Q& a, BiMap_Left_Tag) const {
+            return m_LeftMap.find(a) != m_LeftMap.end();
+        }
+
+        /**
+         * Heterogeneous version of contains(...) for elements of type B.
+         * @tparam Q
+         * @param b
+         * @return True if it exists, false if not
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Comparator_B, B, Q>>
+        [[nodiscard]] bool contains(const Q& b, BiMap_Right_Tag) const {
+            return m_RightMap.find(b) != m_RightMap.end();
+        }
+
         /**
          * Erase (A,B) pair using element of type A
          * @param a
@@ -213,6 +269,40 @@ namespace wtl {
             return true;
         }
 
+        /**
+         * Heterogeneous version of erase(...) for elements of type A.
+         * @tparam Q
+         * @param a
+         * @return True if pair was removed from BiMap.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Comparator_A, A, Q>>
+        bool erase(const Q& a, BiMap_Left_Tag) {
+            auto result = m_LeftMap.find(a);
+            if (result == m_LeftMap.end()) {
+                return false;
+            }
+            m_RightMap.erase(*(result->second));
+            m_LeftMap.erase(result);
+            return true;
+        }
+
+        /**
+         * Heterogeneous version of erase(...) for elements of type B.
+         * @tparam Q
+         * @param b
+         * @return True if pair was removed from BiMap.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Comparator_B, B, Q>>
+        bool erase(const Q& b, BiMap_Right_Tag) {
+            auto result = m_RightMap.find(b);
+            if (result == m_RightMap.end()) {
+                return false;
+            }
+            m_LeftMap.erase(*(result->second));
+            m_RightMap.erase(result);
+            return true;
+        }
+
         /**
          * Clear the BiMap.
          */
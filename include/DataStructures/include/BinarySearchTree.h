@@ -10,6 +10,8 @@
 #include <functional>
 #include <list>
 #include <exception>
+#include <type_traits>
+#include "NodePool.h"
 
 namespace wtl {
 
@@ -82,8 +84,11 @@ namespace wtl {
      * Key values have to be unique, while elements of type V do not have to be.
      * @tparam K
      * @tparam V
+     * @tparam NodeAllocator HeapNodeAllocator to allocate each node on its own, or NodePool to carve nodes out of
+     * chunks. A NodePool keeps the memory of removed nodes until the container is destroyed, so a container that
+     * grows large and shrinks again keeps its peak memory.
      */
-    template<typename K, typename V>
+    template<typename K, typename V, template<typename> class NodeAllocator = wtl::HeapNodeAllocator>
     class BinarySearchTree {
     private:
 
@@ -95,8 +100,12 @@ namespace wtl {
         /// Pointer to the root node of the BST
         Node* m_Root = nullptr;
 
+        /// Allocator of the nodes
+        NodeAllocator<Node> m_Nodes;
+
         /**
-         * Recursive post-order traversal of BST and delete each node
+         * Recursive post-order traversal of BST and delete each node. Nodes from a NodePool are only destructed,
+         * since their memory is reclaimed all at once afterwards.
          * @param root Root node of sub tree
          */
         void clearNodes(Node* const root) noexcept {
@@ -105,8 +114,11 @@ namespace wtl {
             }
             clearNodes(root->m_leftChild);
             clearNodes(root->m_rightChild);
-            delete root;
-            m_Size--;
+            if constexpr (NodeAllocator<Node>::SUPPORTS_RELEASE) {
+                root->~Node();
+            } else {
+                m_Nodes.destroy(root);
+            }
         }
 
         /**
@@ -164,10 +176,10 @@ namespace wtl {
                 } else {
                     currNode->m_rightChild = nullptr;
                 }
-                delete currSub;
+                m_Nodes.destroy(currSub);
                 return;
             }
-            delete currNode;
+            m_Nodes.destroy(currNode);
         }
 
         /**
@@ -221,7 +233,7 @@ namespace wtl {
          */
         Node* insertPrivate(const K& key, const V& value) noexcept {
             if (isEmpty()) {
-                m_Root = new Node(key, value);
+                m_Root = m_Nodes.create(key, value);
                 m_Size++;
                 return nullptr;
             } else {
@@ -232,7 +244,7 @@ namespace wtl {
                     if (key < currNode->m_Key) {
                         // Current node has no left child node
                         if (currNode->m_leftChild == nullptr) {
-                            currNode->m_leftChild = new Node(key, value);
+                            currNode->m_leftChild = m_Nodes.create(key, value);
                             m_Size++;
                             return nullptr;
                         } else {
@@ -243,7 +255,7 @@ namespace wtl {
                     else if (key > currNode->m_Key) {
                         // Current node has no right child node
                         if (currNode->m_rightChild == nullptr) {
-                            currNode->m_rightChild = new Node(key, value);
+                            currNode->m_rightChild = m_Nodes.create(key, value);
                             m_Size++;
                             return nullptr;
                         } else {
@@ -267,7 +279,7 @@ namespace wtl {
          */
         Node* insertPrivate(const K& key, V&& value) noexcept {
             if (isEmpty()) {
-                m_Root = new Node(key, std::move(value));
+                m_Root = m_Nodes.create(key, std::move(value));
                 m_Size++;
                 return nullptr;
             } else {
@@ -278,7 +290,7 @@ namespace wtl {
                     if (key < currNode->m_Key) {
                         // Current node has no left child node
                         if (currNode->m_leftChild == nullptr) {
-                            currNode->m_leftChild = new Node(key, std::move(value));
+                            currNode->m_leftChild = m_Nodes.create(key, std::move(value));
                             m_Size++;
                             return nullptr;
                         } else {
@@ -289,7 +301,7 @@ namespace wtl {
                     else if (key > currNode->m_Key) {
                         // Current node has no right child node
                         if (currNode->m_rightChild == nullptr) {
-                            currNode->m_rightChild = new Node(key, std::move(value));
+                            currNode->m_rightChild = m_Nodes.create(key, std::move(value));
                             m_Size++;
                             return nullptr;
                         } else {
@@ -315,7 +327,7 @@ namespace wtl {
         template<typename ... Ts>
         std::pair<bool, Node*> emplacePrivate(const K& key, Ts&& ... args) noexcept {
             if (isEmpty()) {
-                m_Root = new Node(key, nullptr, nullptr, std::forward<Ts>(args)...);
+                m_Root = m_Nodes.create(key, nullptr, nullptr, std::forward<Ts>(args)...);
                 m_Size++;
                 return {true, m_Root};
             } else {
@@ -326,7 +338,7 @@ namespace wtl {
                     if (key < currNode->m_Key) {
                         // Current node has no left child node
                         if (currNode->m_leftChild == nullptr) {
-                            currNode->m_leftChild = new Node(key, nullptr, nullptr,
+                            currNode->m_leftChild = m_Nodes.create(key, nullptr, nullptr,
                                                              std::forward<Ts>(args)...);
                             m_Size++;
                             return {true, currNode->m_leftChild};
@@ -338,7 +350,7 @@ namespace wtl {
                     else if (key > currNode->m_Key) {
                         // Current node has no right child node
                         if (currNode->m_rightChild == nullptr) {
-                            currNode->m_rightChild = new Node(key, nullptr, nullptr,
+                            currNode->m_rightChild = m_Nodes.create(key, nullptr, nullptr,
                                                               std::forward<Ts>(args)...);
                             m_Size++;
                             return {true, currNode->m_rightChild};
@@ -368,7 +380,7 @@ namespace wtl {
          * Copy constructor
          * @param other
          */
-        BinarySearchTree(const BinarySearchTree<K, V>& other) noexcept {
+        BinarySearchTree(const BinarySearchTree& other) noexcept {
             // TODO
         }
 
@@ -377,7 +389,7 @@ namespace wtl {
         * @param other
         * @return
         */
-        BinarySearchTree<K, V>& operator=(const BinarySearchTree<K, V>& other) noexcept {
+        BinarySearchTree& operator=(const BinarySearchTree& other) noexcept {
             if (this != &other) {
                 clear();
                 // TODO
@@ -389,7 +401,7 @@ namespace wtl {
          * Move constructor
          * @param other
          */
-        BinarySearchTree(BinarySearchTree<K, V>&& other) noexcept {
+        BinarySearchTree(BinarySearchTree&& other) noexcept : m_Nodes(std::move(other.m_Nodes)) {
             m_Root = other.m_Root;
             other.m_Root = nullptr;
             m_Size = other.m_Size;
@@ -401,9 +413,10 @@ namespace wtl {
          * @param other
          * @return
          */
-        BinarySearchTree<K, V>& operator=(BinarySearchTree<K, V>&& other) noexcept {
+        BinarySearchTree& operator=(BinarySearchTree&& other) noexcept {
             if (this != &other) {
                 clear();
+                m_Nodes = std::move(other.m_Nodes);
                 m_Root = other.m_Root;
                 other.m_Root = nullptr;
                 m_Size = other.m_Size;
@@ -603,16 +616,27 @@ namespace wtl {
 
         /**
          * Clear the BST by deleting each element. Size reset to 0.
+         * If the nodes come from a NodePool, their memory is reclaimed all at once, and nodes are only visited if
+         * the keys or values have destructors to run.
          */
         void clear() noexcept {
-            clearNodes(m_Root);
+            if constexpr (NodeAllocator<Node>::SUPPORTS_RELEASE) {
+                if constexpr (!std::is_trivially_destructible_v<Node>) {
+                    clearNodes(m_Root);
+                }
+                m_Nodes.release();
+            } else {
+                clearNodes(m_Root);
+            }
+            m_Root = nullptr;
+            m_Size = 0;
         }
 
         /**
          * Destructor
          */
         ~BinarySearchTree() {
-            clearNodes(m_Root);
+            clear();
         }
 
     };
@@ -0,0 +1,342 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "impl/DataStructuresImpl.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#define WTL_BLOOMFILTER_AVX2
+#include <immintrin.h>
+#endif
+
+namespace wtl {
+
+    namespace impl {
+
+        /**
+         * A block of a BloomFilter: 8 words of 32 bits, 32 bytes in total, so that a block never straddles a cache
+         * line. Every key sets exactly 1 bit in each of the 8 words of its block.
+         */
+        struct alignas(32) BloomFilterBlock {
+
+            static constexpr std::size_t WORDS = 8;
+
+            std::uint32_t m_Words[WORDS];
+
+            /**
+             * Odd constants used to pick a different bit in each word from the same 32 bit hash.
+             */
+            static constexpr std::uint32_t SALTS[WORDS] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                          0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+            /**
+             * Set the bit of every word that the hash maps to.
+             * @param hash
+             */
+            void insert(std::uint32_t hash) noexcept {
+#ifdef WTL_BLOOMFILTER_AVX2
+                __m256i* words = reinterpret_cast<__m256i*>(m_Words);
+                _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), mask(hash)));
+#else
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    m_Words[i] |= 1u << ((hash * SALTS[i]) >> 27);
+                }
+#endif
+            }
+
+            /**
+             * Check if the bit of every word that the hash maps to is set.
+             * @param hash
+             * @return
+             */
+            [[nodiscard]] bool contains(std::uint32_t hash) const noexcept {
+#ifdef WTL_BLOOMFILTER_AVX2
+                return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(m_Words)), mask(hash));
+#else
+                // No early exit, so that the compiler can test all 8 words using vector instructions.
+                bool result = true;
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    result &= (m_Words[i] >> ((hash * SALTS[i]) >> 27)) & 1u;
+                }
+                return result;
+#endif
+            }
+
+#ifdef WTL_BLOOMFILTER_AVX2
+
+            /**
+             * The 8 bits of a hash, one in each 32 bit lane.
+             * @param hash
+             * @return
+             */
+            [[nodiscard]] static __m256i mask(std::uint32_t hash) noexcept {
+                const __m256i salts = _mm256_setr_epi32(
+                        static_cast<int>(SALTS[0]), static_cast<int>(SALTS[1]), static_cast<int>(SALTS[2]),
+                        static_cast<int>(SALTS[3]), static_cast<int>(SALTS[4]), static_cast<int>(SALTS[5]),
+                        static_cast<int>(SALTS[6]), static_cast<int>(SALTS[7]));
+                __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(
+                        _mm256_set1_epi32(static_cast<int>(hash)), salts), 27);
+                return _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+            }
+
+#endif
+        };
+
+    }
+
+    /**
+     * A Bloom filter answers whether a key may have been inserted, using a few bits per key. There are no false
+     * negatives: if mayContain(...) returns false, the key was never inserted. It can return true for keys that were
+     * never inserted, at a rate that is chosen when the filter is constructed.
+     * This is a blocked Bloom filter. A key only ever touches one 32 byte block, so each insertion and each query
+     * costs a single cache miss. Within the block, one bit is set in each of 8 words, which is tested using AVX2 if
+     * available, and otherwise using a loop the compiler can vectorise.
+     * Keys cannot be removed. Use a CuckooFilter if that is needed.
+     * @tparam K
+     * @tparam Hash
+     */
+    template<typename K, typename Hash = std::hash<K>>
+    class BloomFilter {
+    public:
+
+        typedef K KeyType;
+
+        /// Bloom filters cannot remove keys
+        static constexpr bool SUPPORTS_ERASE = false;
+
+    private:
+
+        typedef impl::BloomFilterBlock Block;
+
+        /// Number of keys inserted
+        std::size_t m_Size = 0;
+
+        /// Number of blocks
+        std::size_t m_BlockCount = 0;
+
+        /// Blocks
+        Block* m_Blocks = nullptr;
+
+        /// Hashing algorithm
+        Hash m_Hash;
+
+        /**
+         * Allocate zeroed blocks.
+         * @param blockCount
+         */
+        void allocate(std::size_t blockCount) {
+            m_BlockCount = blockCount;
+            m_Blocks = static_cast<Block*>(::operator new(blockCount * sizeof(Block), std::align_val_t(alignof(Block))));
+            std::memset(static_cast<void*>(m_Blocks), 0, blockCount * sizeof(Block));
+        }
+
+        /**
+         * Free the blocks.
+         */
+        void deallocate() noexcept {
+            ::operator delete(m_Blocks, m_BlockCount * sizeof(Block), std::align_val_t(alignof(Block)));
+            m_Blocks = nullptr;
+        }
+
+        /**
+         * Block that a hash belongs to. The upper 32 bits of the hash are scaled to the number of blocks, so the
+         * number of blocks does not have to be a power of 2 and the memory budget can be used fully.
+         * @param hash
+         * @return
+         */
+        [[nodiscard]] Block& blockOf(std::uint64_t hash) const noexcept {
+            return m_Blocks[((hash >> 32) * static_cast<std::uint64_t>(m_BlockCount)) >> 32];
+        }
+
+        /**
+         * Number of blocks needed to store a number of keys at a false positive rate.
+         * @param expectedElements
+         * @param falsePositiveRate
+         * @return
+         */
+        [[nodiscard]] static std::size_t blocksNeeded(std::size_t expectedElements, double falsePositiveRate) {
+            std::size_t high = expectedElements / 16 + 1;
+            while (falsePositiveRateOf(expectedElements, high) > falsePositiveRate) {
+                high *= 2;
+            }
+            std::size_t low = high / 2;
+            while (low + 1 < high) {
+                std::size_t middle = low + (high - low) / 2;
+                if (falsePositiveRateOf(expectedElements, middle) > falsePositiveRate) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+            return high;
+        }
+
+    public:
+
+        /**
+         * Expected false positive rate of a filter with a number of keys spread over a number of blocks.
+         * The number of keys in a block is roughly Poisson distributed. A block holding i keys gives a false positive
+         * if each of its 8 words has the queried bit set, which happens with probability (1 - (31/32)^i)^8.
+         * The Poisson probabilities are summed outward from the most likely number of keys, relative to it, and divided
+         * by their total at the end, so that e^-lambda, which underflows for large lambda, is never needed. Only the
+         * terms that are not negligible are summed, which is O(sqrt(lambda)) of them.
+         * @param elements
+         * @param blockCount
+         * @return
+         */
+        [[nodiscard]] static double falsePositiveRateOf(std::size_t elements, std::size_t blockCount) noexcept {
+            if (blockCount == 0) {
+                return 1;
+            }
+            double lambda = static_cast<double>(elements) / static_cast<double>(blockCount);
+            // With this many keys per block, fewer than 1100 keys in a block is vanishingly unlikely, and a block with
+            // 1100 keys has the queried bit set in every word to double precision.
+            if (lambda > 2000) {
+                return 1;
+            }
+            auto falsePositive = [](std::size_t keys) {
+                return std::pow(1 - std::pow(31.0 / 32.0, static_cast<double>(keys)), 8);
+            };
+            constexpr double NEGLIGIBLE = 1e-17;
+            auto mode = static_cast<std::size_t>(lambda);
+            double total = 0;
+            double rate = 0;
+            double probability = 1;
+            for (std::size_t i = mode; probability >= total * NEGLIGIBLE; i++) {
+                total += probability;
+                rate += probability * falsePositive(i);
+                probability *= lambda / static_cast<double>(i + 1);
+            }
+            probability = 1;
+            for (std::size_t i = mode; i > 0; i--) {
+                probability *= static_cast<double>(i) / lambda;
+                if (probability < total * NEGLIGIBLE) {
+                    break;
+                }
+                total += probability;
+                rate += probability * falsePositive(i - 1);
+            }
+            return rate / total;
+        }
+
+        /**
+         * Constructor
+         * @param expectedElements Number of keys the filter is sized for. More keys can be inserted, at the cost of a
+         * higher false positive rate.
+         * @param falsePositiveRate Target rate of false positives once expectedElements keys have been inserted
+         * @param memoryBudget Maximum number of bytes used. If the false positive rate needs more, the rate is not met.
+         */
+        explicit BloomFilter(std::size_t expectedElements, double falsePositiveRate = 0.01,
+                             std::size_t memoryBudget = std::numeric_limits<std::size_t>::max()) {
+            if (!(falsePositiveRate > 0 && falsePositiveRate < 1)) {
+                throw std::invalid_argument("False positive rate must be between 0 and 1!");
+            }
+            if (memoryBudget < sizeof(Block)) {
+                throw std::invalid_argument("Memory budget is smaller than a single block!");
+            }
+            std::size_t blockCount = blocksNeeded(expectedElements, falsePositiveRate);
+            if (blockCount > memoryBudget / sizeof(Block)) {
+                blockCount = memoryBudget / sizeof(Block);
+            }
+            allocate(blockCount);
+        }
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        BloomFilter(const BloomFilter& other) : m_Size(other.m_Size), m_Hash(other.m_Hash) {
+            allocate(other.m_BlockCount);
+            std::memcpy(static_cast<void*>(m_Blocks), other.m_Blocks, m_BlockCount * sizeof(Block));
+        }
+
+        /**
+         * Copy assignment
+         * @param other
+         * @return
+         */
+        BloomFilter& operator=(const BloomFilter& other) {
+            if (this != &other) {
+                deallocate();
+                m_Size = other.m_Size;
+                m_Hash = other.m_Hash;
+                allocate(other.m_BlockCount);
+                std::memcpy(static_cast<void*>(m_Blocks), other.m_Blocks, m_BlockCount * sizeof(Block));
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of keys inserted. Inserting the same key twice counts twice.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Get the number of bytes used by the bits of the filter.
+         * @return
+         */
+        [[nodiscard]] std::size_t getMemoryUsage() const noexcept {
+            return m_BlockCount * sizeof(Block);
+        }
+
+        /**
+         * Get the expected false positive rate with the keys inserted so far.
+         * @return
+         */
+        [[nodiscard]] double getFalsePositiveRate() const noexcept {
+            return falsePositiveRateOf(m_Size, m_BlockCount);
+        }
+
+        /**
+         * Insert a key.
+         * @param key
+         * @return Always true, since a Bloom filter cannot run out of space.
+         */
+        bool insert(const K& key) noexcept {
+            std::uint64_t hash = impl::ds::mixHash64(m_Hash(key));
+            blockOf(hash).insert(static_cast<std::uint32_t>(hash));
+            ++m_Size;
+            return true;
+        }
+
+        /**
+         * Check if a key may have been inserted.
+         * @param key
+         * @return False if the key was definitely never inserted, true if it probably was.
+         */
+        [[nodiscard]] bool mayContain(const K& key) const noexcept {
+            std::uint64_t hash = impl::ds::mixHash64(m_Hash(key));
+            return blockOf(hash).contains(static_cast<std::uint32_t>(hash));
+        }
+
+        /**
+         * Remove all keys.
+         */
+        void clear() noexcept {
+            std::memset(static_cast<void*>(m_Blocks), 0, m_BlockCount * sizeof(Block));
+            m_Size = 0;
+        }
+
+        /**
+         * Destructor
+         */
+        ~BloomFilter() {
+            deallocate();
+        }
+
+    };
+
+}
@@ -6,10 +6,11 @@
 
 #include <cstddef>
 #include <functional>
+#include <optional>
 #include <utility>
 #include <vector>
 #include <stdexcept>
-#include <cmath>
+#include "impl/DataStructuresImpl.h"
 
 namespace wtl {
 
@@ -66,12 +67,12 @@ namespace wtl {
             std::size_t m_BucketCount;
             std::size_t iteration = 0;
 
-            inline std::size_t modulo(int value, std::size_t m) {
-                int mod = value % static_cast<int>(m);
+            inline std::size_t modulo(long long value, std::size_t m) {
+                long long mod = value % static_cast<long long>(m);
                 if (mod < 0) {
-                    mod += m;
+                    mod += static_cast<long long>(m);
                 }
-                return mod;
+                return static_cast<std::size_t>(mod);
             }
 
         public:
@@ -79,14 +80,56 @@ namespace wtl {
                     : m_HashedIndex(hashedKey % bucketCount), m_BucketCount(bucketCount) {}
 
             std::size_t operator()() {
-                std::size_t r = modulo(static_cast<int>(m_HashedIndex) +
-                                       static_cast<int>(std::pow(-1, iteration + 1) * std::pow(iteration, 2)),
-                                       m_BucketCount);
+                long long offset = static_cast<long long>(iteration) * static_cast<long long>(iteration);
+                if (iteration % 2 == 0) {
+                    offset = -offset;
+                }
+                std::size_t r = modulo(static_cast<long long>(m_HashedIndex) + offset, m_BucketCount);
                 ++iteration;
                 return r;
             }
         };
 
+        /**
+         * Probe for the slot holding a key equal to the query. The query is either a K or, if the hash is
+         * transparent, any type that the hash accepts and that compares equal with K.
+         * @tparam Q
+         * @param key
+         * @return Index of the slot, or the number of buckets if the key was not found
+         */
+        template<typename Q>
+        [[nodiscard]] std::size_t findIndex(const Q& key) const noexcept {
+            QuadraticProbing quadraticProbing(m_Hash(key), m_BucketCount);
+            std::size_t index = quadraticProbing();
+            while (m_Status[index] != FREE) {
+                if (m_Status[index] == OCCUPIED) {
+                    if (m_Buckets[index].first == key) {
+                        return index;
+                    }
+                }
+                index = quadraticProbing();
+            }
+            return m_BucketCount;
+        }
+
+        /**
+         * Erase the key-value pair with a key equal to the query.
+         * @tparam Q
+         * @param key
+         * @return True if a key-value pair was removed
+         */
+        template<typename Q>
+        bool eraseIndex(const Q& key) noexcept {
+            std::size_t index = findIndex(key);
+            if (index == m_BucketCount) {
+                return false;
+            }
+            m_Status[index] = DELETED;
+            m_Buckets[index].~KeyValuePair();
+            --m_Size;
+            return true;
+        }
+
         /**
         * Double the number of buckets if the load factor exceeds the threshold. Rehashes the key-value pairs.
         */
@@ -209,23 +252,17 @@ namespace wtl {
         }
 
         /**
-      * Returns a reference to the value with the specified key, wrapped in a std::optional.
-      * If the key was not found, then std::nullopts is returned.
-      * @param key
-      * @return
-      */
+         * Returns a reference to the value with the specified key, wrapped in a std::optional.
+         * If the key was not found, then std::nullopts is returned.
+         * @param key
+         * @return
+         */
         [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const K& key) noexcept {
-            QuadraticProbing quadraticProbing(m_Hash(key), m_BucketCount);
-            std::size_t index = quadraticProbing();
-            while (m_Status[index] != FREE) {
-                if (m_Status[index] == OCCUPIED) {
-                    if (m_Buckets[index].first == key) {
-                        return m_Buckets[index].second;
-                    }
-                }
-                index = quadraticProbing();
+            std::size_t index = findIndex(key);
+            if (index == m_BucketCount) {
+                return std::nullopt;
             }
-            return std::nullopt;
+            return m_Buckets[index].second;
         }
 
         /**
@@ -235,29 +272,64 @@ namespace wtl {
          * @return
          */
         [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const K& key) const noexcept {
-            QuadraticProbing quadraticProbing(m_Hash(key), m_BucketCount);
-            std::size_t index = quadraticProbing();
-            while (m_Status[index] != FREE) {
-                if (m_Status[index] == OCCUPIED) {
-                    if (m_Buckets[index].first == key) {
-                        return m_Buckets[index].second;
-                    }
-                }
-                index = quadraticProbing();
+            std::size_t index = findIndex(key);
+            if (index == m_BucketCount) {
+                return std::nullopt;
             }
-            return std::nullopt;
+            return m_Buckets[index].second;
         }
 
         /**
-       * Check if a key exists in the container.
-       * @param key
-       * @return True if key exists, false if not.
-       */
-        bool contains(const K& key) const noexcept {
-            if (at(key) == std::nullopt) {
-                return false;
+         * Heterogeneous lookup, only available if Hash declares is_transparent. The key is never converted to K,
+         * so for example a std::string_view can be used to look up a std::string key without any allocation.
+         * Hash must give the same hash for the query as for an equal K.
+         * @tparam Q
+         * @param key
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const Q& key) noexcept {
+            std::size_t index = findIndex(key);
+            if (index == m_BucketCount) {
+                return std::nullopt;
             }
-            return true;
+            return m_Buckets[index].second;
+        }
+
+        /**
+         * Heterogeneous lookup, only available if Hash declares is_transparent.
+         * @see at(const Q&)
+         * @tparam Q
+         * @param key
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const Q& key) const noexcept {
+            std::size_t index = findIndex(key);
+            if (index == m_BucketCount) {
+                return std::nullopt;
+            }
+            return m_Buckets[index].second;
+        }
+
+        /**
+         * Check if a key exists in the container.
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        bool contains(const K& key) const noexcept {
+            return findIndex(key) != m_BucketCount;
+        }
+
+        /**
+         * Heterogeneous version of contains(...), only available if Hash declares is_transparent.
+         * @tparam Q
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        bool contains(const Q& key) const noexcept {
+            return findIndex(key) != m_BucketCount;
         }
 
         /**
@@ -273,7 +345,7 @@ namespace wtl {
             QuadraticProbing quadraticProbing(m_Hash(key), m_BucketCount);
             std::size_t index = quadraticProbing();
             while (true) {
-                if (m_Status[index] == FREE || m_Status == DELETED) {
+                if (m_Status[index] == FREE || m_Status[index] == DELETED) {
                     m_Status[index] = OCCUPIED;
                     ++m_Size;
                     new(&m_Buckets[index]) KeyValuePair(key, value);
@@ -343,20 +415,18 @@ namespace wtl {
          * @return True if key was found and key-value pair was removed, false if not.
          */
         bool erase(const K& key) noexcept {
-            QuadraticProbing quadraticProbing(m_Hash(key), m_BucketCount);
-            std::size_t index = quadraticProbing();
-            while (m_Status[index] != FREE) {
-                if (m_Status[index] == OCCUPIED) {
-                    if (m_Buckets[index].first == key) {
-                        m_Status[index] = DELETED;
-                        m_Buckets[index].~KeyValuePair();
-                        --m_Size;
-                        return true;
-                    }
-                }
-                index = quadraticProbing();
-            }
-            return false;
+            return eraseIndex(key);
+        }
+
+        /**
+         * Heterogeneous version of erase(...), only available if Hash declares is_transparent.
+         * @tparam Q
+         * @param key
+         * @return True if key was found and key-value pair was removed, false if not.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        bool erase(const Q& key) noexcept {
+            return eraseIndex(key);
         }
 
         /**
@@ -0,0 +1,220 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "impl/DataStructuresImpl.h"
+#include "SparseTable.h"
+
+namespace wtl {
+
+    namespace impl {
+
+        /**
+         * Operation of the sparse table over the blocks of a CompactRMQ, which picks the element with the highest
+         * priority.
+         * @tparam T
+         * @tparam Comparator
+         */
+        template<typename T, typename Comparator>
+        struct CompactRMQBest {
+
+            Comparator comparator;
+
+            T operator()(const T& lhs, const T& rhs) const {
+                return comparator(rhs, lhs) ? rhs : lhs;
+            }
+        };
+
+    }
+
+    /**
+     * Range minimum query over a static array using O(n) extra memory, where SparseTable uses O(nlogn).
+     * The array is split into blocks of 64 elements. A query that spans several blocks is answered using a sparse
+     * table over the minimum of each block, which has n / 64 entries, together with one query inside each of the
+     * two blocks at its ends. Queries inside a block use one 64 bit mask per element, which marks the elements of
+     * the block up to it that are not larger than any element after them up to it. The minimum of [l, r] is the
+     * lowest marked element at or after l in the mask of r, so each query takes O(1) time.
+     * Building takes O(n) time.
+     * By default, the comparison is done using operator<, so queries return the minimum. Use a comparator such as
+     * std::greater to query the maximum instead.
+     * @tparam T
+     * @tparam Comparator Type of binary predicate that returns true if lhs has higher priority than rhs
+     */
+    template<typename T, typename Comparator = impl::ds::StandardComparator<T>>
+    class CompactRMQ {
+    private:
+
+        using BlockTable = SparseTable<T, impl::CompactRMQBest<T, Comparator>>;
+
+        /// Number of elements in each block, one per bit of a mask
+        static constexpr std::size_t BLOCK_SIZE = 64;
+
+        /// Comparator object used for ordering
+        Comparator comparator;
+
+        /// The elements
+        std::vector<T> m_Values;
+
+        /// For each element, the elements of its block up to it that are not larger than any element after them
+        std::vector<std::uint64_t> m_Masks;
+
+        /// Sparse table over the minimum of each block
+        BlockTable m_BlockTable;
+
+        /**
+         * Compute the mask of every element once the elements are stored.
+         * @return Sparse table over the minimum of each block
+         */
+        BlockTable construct() {
+            std::size_t size = m_Values.size();
+            if (size == 0) {
+                throw std::invalid_argument("Cannot construct empty range minimum query");
+            }
+            m_Masks.resize(size);
+            std::size_t blockCount = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+            std::vector<T> blockMinimums;
+            blockMinimums.reserve(blockCount);
+            for (std::size_t blockStart = 0; blockStart < size; blockStart += BLOCK_SIZE) {
+                std::size_t blockEnd = std::min(blockStart + BLOCK_SIZE, size);
+                // The mask is a stack of offsets in the block, which is popped while the new element is smaller
+                std::uint64_t mask = 0;
+                for (std::size_t i = blockStart; i < blockEnd; i++) {
+                    while (mask != 0) {
+                        std::size_t top = blockStart + impl::ds::floorLog2(mask);
+                        if (!comparator(m_Values[i], m_Values[top])) {
+                            break;
+                        }
+                        mask ^= std::uint64_t(1) << (top - blockStart);
+                    }
+                    mask |= std::uint64_t(1) << (i - blockStart);
+                    m_Masks[i] = mask;
+                }
+                blockMinimums.push_back(m_Values[blockStart + impl::ds::countTrailingZeros(mask)]);
+            }
+            return BlockTable(blockMinimums.begin(), blockMinimums.end());
+        }
+
+        void checkRange(std::size_t startIndex, std::size_t endIndex) const {
+            if (startIndex >= m_Values.size() || endIndex >= m_Values.size() || startIndex > endIndex) {
+                throw std::invalid_argument("Index out of range");
+            }
+        }
+
+        /**
+         * Index of the minimum between two inclusive indexes in the same block.
+         * @param startIndex
+         * @param endIndex
+         * @return
+         */
+        [[nodiscard]] std::size_t blockQuery(std::size_t startIndex, std::size_t endIndex) const noexcept {
+            std::size_t offset = startIndex % BLOCK_SIZE;
+            std::uint64_t mask = m_Masks[endIndex] & (~std::uint64_t(0) << offset);
+            return startIndex - offset + impl::ds::countTrailingZeros(mask);
+        }
+
+        const T& best(const T& lhs, const T& rhs) const {
+            return comparator(rhs, lhs) ? rhs : lhs;
+        }
+
+        /**
+         * Query between two inclusive indexes, which must be valid.
+         * @param startIndex
+         * @param endIndex
+         * @return
+         */
+        T queryUnchecked(std::size_t startIndex, std::size_t endIndex) const {
+            std::size_t startBlock = startIndex / BLOCK_SIZE;
+            std::size_t endBlock = endIndex / BLOCK_SIZE;
+            if (startBlock == endBlock) {
+                return m_Values[blockQuery(startIndex, endIndex)];
+            }
+            const T& left = m_Values[blockQuery(startIndex, startBlock * BLOCK_SIZE + BLOCK_SIZE - 1)];
+            const T& right = m_Values[blockQuery(endBlock * BLOCK_SIZE, endIndex)];
+            if (startBlock + 1 == endBlock) {
+                return best(left, right);
+            }
+            T middle = m_BlockTable.query(startBlock + 1, endBlock - 1);
+            return best(best(left, middle), right);
+        }
+
+    public:
+
+        /**
+         * Constructor.
+         * Construct a range minimum query using the elements in a stl container.
+         * @tparam Iterator
+         * @param iteratorBegin Iterator pointing to the first element in the stl container
+         * @param iteratorEnd Iterator pointing to the past-the-end element of the stl container
+         */
+        template<typename Iterator>
+        CompactRMQ(Iterator iteratorBegin, Iterator iteratorEnd)
+                : m_Values(iteratorBegin, iteratorEnd), m_BlockTable(construct()) {}
+
+        /**
+         * Get the number of elements
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Values.size();
+        }
+
+        /**
+         * Get the number of bytes used, including the copy of the elements but excluding the object itself.
+         * @return
+         */
+        [[nodiscard]] std::size_t getMemoryUsage() const noexcept {
+            return m_Values.capacity() * sizeof(T) + m_Masks.capacity() * sizeof(std::uint64_t) +
+                   m_BlockTable.getMemoryUsage();
+        }
+
+        /**
+         * Query between two inclusive indexes.
+         * @param startIndex
+         * @param endIndex
+         * @return Minimum element between the indexes
+         */
+        [[nodiscard]] T query(std::size_t startIndex, std::size_t endIndex) const {
+            checkRange(startIndex, endIndex);
+            return queryUnchecked(startIndex, endIndex);
+        }
+
+        /**
+         * Answer a range of queries, each a pair of inclusive indexes, as impl::ds::batchRangeQuery does.
+         * @tparam RangeIterator Iterator over std::pair<std::size_t, std::size_t>, or similar
+         * @tparam OutputIterator
+         * @param first
+         * @param last
+         * @param out
+         * @return Output iterator past the last result written
+         */
+        template<typename RangeIterator, typename OutputIterator>
+        OutputIterator query(RangeIterator first, RangeIterator last, OutputIterator out) const {
+            return impl::ds::batchRangeQuery(first, last, out, [this](std::size_t startIndex, std::size_t endIndex) {
+                return query(startIndex, endIndex);
+            });
+        }
+
+        /**
+         * Answer a batch of queries, each a pair of inclusive indexes.
+         * @param ranges
+         * @return Results in the same order as the queries
+         */
+        [[nodiscard]] std::vector<T> query(const std::vector<std::pair<std::size_t, std::size_t>>& ranges) const {
+            return impl::ds::batchRangeQuery<T>(ranges, [this](std::size_t startIndex, std::size_t endIndex) {
+                return query(startIndex, endIndex);
+            });
+        }
+
+    };
+
+}
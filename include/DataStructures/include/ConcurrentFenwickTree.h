@@ -0,0 +1,253 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * A fenwick tree that can be updated and queried from several threads at once, such as a histogram of counters.
+     * Every cell is an atomic, so updates are wait-free: each one is O(logn) relaxed fetch-adds. Queries only read,
+     * and are lock-free too. They may miss updates that are still in progress, so a prefix sum may be slightly stale,
+     * but it always counts every update that completed before the query started, and is never made of half an
+     * update to a single cell.
+     * The cells near the root of the tree are shared by most updates, and become contended when many threads update
+     * at once. To avoid this, the tree can be given stripes: extra trees that updates go to instead, chosen by
+     * thread. Queries then add up every stripe and the main tree, and fold() moves the stripes into the main tree
+     * so that queries become cheap again. A fold adds an amount to the main tree before it takes it out of the
+     * stripe, so an amount is never in neither tree, and a query that overlaps a fold never waits for it. Such a
+     * query may instead count an amount that is being moved twice, so while a fold is in progress, a prefix sum can
+     * briefly be too large by at most the amounts it is moving.
+     * Fenwick tree is indexed [0, size - 1], like an original array.
+     * @tparam T Integral data type
+     */
+    template<typename T>
+    class ConcurrentFenwickTree {
+    private:
+
+        static_assert(std::is_integral_v<T>, "Concurrent Fenwick Tree only supports integral types");
+
+        using Cells = std::unique_ptr<std::atomic<T>[]>;
+
+        /// Number of elements
+        std::size_t m_Size = 0;
+
+        /// Main tree
+        Cells m_Tree;
+
+        /// Trees that updates go to instead of the main tree, one per group of threads. Their number is 0 or a
+        /// power of 2.
+        std::vector<Cells> m_Stripes;
+
+        [[nodiscard]] bool outOfBounds(std::size_t index) const noexcept {
+            return index >= m_Size;
+        }
+
+        [[nodiscard]] static std::size_t getFirstBit(std::size_t val) noexcept {
+            return val & (~val + 1);
+        }
+
+        [[nodiscard]] Cells makeCells() const {
+            Cells cells(new std::atomic<T>[m_Size]);
+            for (std::size_t i = 0; i < m_Size; i++) {
+                cells[i].store(0, std::memory_order_relaxed);
+            }
+            return cells;
+        }
+
+        /**
+         * Get the tree that the calling thread updates.
+         * @return
+         */
+        [[nodiscard]] std::atomic<T>* treeOfThread() const noexcept {
+            if (m_Stripes.empty()) {
+                return m_Tree.get();
+            }
+            std::size_t hash = impl::ds::mixHash(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            return m_Stripes[impl::ds::upperHalf(hash) & (m_Stripes.size() - 1)].get();
+        }
+
+        /**
+         * Sum of the cells of a tree from index zero to index (inclusive), which must be valid.
+         * @param tree
+         * @param index
+         * @param order
+         * @return
+         */
+        [[nodiscard]] static T prefixSum(const std::atomic<T>* tree, std::size_t index, std::memory_order order) {
+            T sum = 0;
+            for (index++; index > 0; index -= getFirstBit(index)) {
+                sum += tree[index - 1].load(order);
+            }
+            return sum;
+        }
+
+        /**
+         * Sum of all indexes from index zero to index (inclusive), which must be valid. The stripes are read before
+         * the main tree: if a cell of a stripe no longer holds an amount that a fold took out of it, the acquire load
+         * makes sure that the main tree is read after the fold added the amount to it.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] T prefixSum(std::size_t index) const noexcept {
+            T sum = 0;
+            for (const Cells& stripe : m_Stripes) {
+                sum += prefixSum(stripe.get(), index, std::memory_order_acquire);
+            }
+            return sum + prefixSum(m_Tree.get(), index, std::memory_order_relaxed);
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * Construct a tree of zeroes.
+         * @param size Number of elements
+         * @param stripeCount Number of stripes, rounded up to a power of 2. By default, there are none.
+         */
+        explicit ConcurrentFenwickTree(std::size_t size, std::size_t stripeCount = 0) : m_Size(size) {
+            m_Tree = makeCells();
+            std::size_t stripes = stripeCount == 0 ? 0 : 1;
+            while (stripes < stripeCount) {
+                stripes <<= 1;
+            }
+            for (std::size_t i = 0; i < stripes; i++) {
+                m_Stripes.push_back(makeCells());
+            }
+        }
+
+        /**
+         * Constructor
+         * Takes in a stl container and populates the Fenwick Tree with the elements, in the same order
+         * as they appear in the container as per the iterators.
+         * @tparam Container
+         * @param container
+         * @param stripeCount Number of stripes, rounded up to a power of 2. By default, there are none.
+         */
+        template<typename Container, typename = decltype(std::declval<const Container&>().begin())>
+        explicit ConcurrentFenwickTree(const Container& container, std::size_t stripeCount = 0)
+                : ConcurrentFenwickTree(static_cast<std::size_t>(std::distance(container.begin(), container.end())),
+                                        stripeCount) {
+            std::vector<T> cells(container.begin(), container.end());
+            for (std::size_t i = 0; i < m_Size; i++) {
+                std::size_t parent = i + getFirstBit(i + 1);
+                if (parent < m_Size) {
+                    cells[parent] += cells[i];
+                }
+                m_Tree[i].store(cells[i], std::memory_order_relaxed);
+            }
+        }
+
+        ConcurrentFenwickTree(const ConcurrentFenwickTree& other) = delete;
+
+        ConcurrentFenwickTree& operator=(const ConcurrentFenwickTree& other) = delete;
+
+        /**
+         * Number of elements in the Fenwick Tree.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Number of stripes.
+         * @return
+         */
+        [[nodiscard]] std::size_t getStripeCount() const noexcept {
+            return m_Stripes.size();
+        }
+
+        /**
+         * Query the fenwick tree from index startIndex (inclusive) to index zero (inclusive).
+         * @param startIndex
+         * @return
+         */
+        [[nodiscard]] T query(std::size_t startIndex) const {
+            if (outOfBounds(startIndex)) {
+                throw std::invalid_argument("Index out of range");
+            }
+            return prefixSum(startIndex);
+        }
+
+        /**
+         * Query the fenwick tree from index startIndex (inclusive) to endIndex (inclusive).
+         * StartIndex cannot be larger than endIndex.
+         * @param startIndex
+         * @param endIndex
+         * @return
+         */
+        [[nodiscard]] T query(std::size_t startIndex, std::size_t endIndex) const {
+            if (outOfBounds(startIndex) || outOfBounds(endIndex) || startIndex > endIndex) {
+                throw std::invalid_argument("Index out of range");
+            }
+            if (startIndex == 0) {
+                return prefixSum(endIndex);
+            }
+            return prefixSum(endIndex) - prefixSum(startIndex - 1);
+        }
+
+        /**
+         * Retrieve the value of a single index position of the array.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] T retrieve(std::size_t index) const {
+            return query(index, index);
+        }
+
+        /**
+         * Change the value of an index position of the array by an amount. Wait-free.
+         * @param index
+         * @param value
+         */
+        void update(std::size_t index, T value) {
+            if (outOfBounds(index)) {
+                throw std::invalid_argument("Index out of range");
+            }
+            std::atomic<T>* tree = treeOfThread();
+            for (index++; index <= m_Size; index += getFirstBit(index)) {
+                tree[index - 1].fetch_add(value, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * Move the contents of every stripe into the main tree. Lock-free. Since the tree is linear in its cells, this
+         * is done cell by cell, and can run at the same time as updates, queries and other folds. Each amount is
+         * added to the main tree before it is subtracted from its stripe, so queries that overlap a fold may briefly
+         * count it twice, but never miss it.
+         */
+        void fold() noexcept {
+            for (const Cells& stripe : m_Stripes) {
+                for (std::size_t i = 0; i < m_Size; i++) {
+                    T value = stripe[i].load(std::memory_order_relaxed);
+                    if (value != 0) {
+                        m_Tree[i].fetch_add(value, std::memory_order_relaxed);
+                        stripe[i].fetch_sub(value, std::memory_order_release);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Destructor
+         */
+        ~ConcurrentFenwickTree() = default;
+
+    };
+
+}
@@ -0,0 +1,254 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include "FlatMap.h"
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * A hashmap that can be used from several threads at once. The key space is split into a power of 2 number of
+     * shards, each of which is a FlatMap guarded by its own reader/writer lock. Threads that touch different shards
+     * never wait for each other, and any number of readers can share a shard.
+     * Since another thread may erase or rehash at any time, no references to the stored elements are handed out.
+     * Lookups return a copy of the value instead.
+     * @tparam K
+     * @tparam V
+     * @tparam Hash
+     */
+    template<typename K, typename V, typename Hash = std::hash<K>>
+    class ConcurrentMap {
+    private:
+
+        /**
+         * A shard is aligned to a cache line, so that locking one shard does not invalidate the lock of its
+         * neighbour in other cores' caches.
+         */
+        struct alignas(64) Shard {
+            mutable std::shared_mutex m_Mutex;
+            FlatMap<K, V, Hash> m_Map;
+        };
+
+        /// Number of shards, always a power of 2
+        std::size_t m_ShardCount = 0;
+
+        /// Shards
+        Shard* m_Shards = nullptr;
+
+        /// Hashing algorithm, used to pick the shard
+        Hash m_Hash;
+
+        /**
+         * Default number of shards. Having several shards per hardware thread keeps the chance of two threads
+         * wanting the same shard low.
+         * @return
+         */
+        [[nodiscard]] static std::size_t defaultShardCount() noexcept {
+            std::size_t threads = std::thread::hardware_concurrency();
+            return (threads == 0 ? 1 : threads) * 4;
+        }
+
+        /**
+         * Get the shard that a key belongs to. FlatMap takes its fingerprint and group index from the mixed hash,
+         * and with a 32-bit std::size_t its group bits reach into the upper half, so the mixed hash is mixed once
+         * more before picking the shard. Otherwise, the keys of a shard would all share some of their group bits,
+         * and crowd into a fraction of the groups of the shard's FlatMap.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] Shard& shardOf(const K& key) const noexcept {
+            std::size_t hash = impl::ds::mixHash(impl::ds::mixHash(m_Hash(key)));
+            return m_Shards[impl::ds::upperHalf(hash) & (m_ShardCount - 1)];
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param shardCount Number of shards, rounded up to a power of 2. By default, 4 shards per hardware thread.
+         */
+        explicit ConcurrentMap(std::size_t shardCount = defaultShardCount()) : m_ShardCount(1) {
+            while (m_ShardCount < shardCount) {
+                m_ShardCount *= 2;
+            }
+            m_Shards = new Shard[m_ShardCount];
+        }
+
+        ConcurrentMap(const ConcurrentMap& other) = delete;
+
+        ConcurrentMap& operator=(const ConcurrentMap& other) = delete;
+
+        /**
+         * Get the number of shards
+         * @return
+         */
+        [[nodiscard]] std::size_t getShardCount() const noexcept {
+            return m_ShardCount;
+        }
+
+        /**
+         * Get the number of elements. The shards are counted one after another, so if other threads are inserting
+         * or erasing at the same time, the result is only a snapshot.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const {
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < m_ShardCount; i++) {
+                std::shared_lock lock(m_Shards[i].m_Mutex);
+                size += m_Shards[i].m_Map.getSize();
+            }
+            return size;
+        }
+
+        /**
+         * Check if container is empty. Like getSize(), this is only a snapshot.
+         * @return
+         */
+        [[nodiscard]] bool empty() const {
+            return getSize() == 0;
+        }
+
+        /**
+         * Returns a copy of the value with the specified key, wrapped in a std::optional.
+         * If the key was not found, then std::nullopt is returned.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::optional<V> find(const K& key) const {
+            Shard& shard = shardOf(key);
+            std::shared_lock lock(shard.m_Mutex);
+            auto result = shard.m_Map.at(key);
+            if (result == std::nullopt) {
+                return std::nullopt;
+            }
+            return result.value().get();
+        }
+
+        /**
+         * Check if a key exists in the container.
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        [[nodiscard]] bool contains(const K& key) const {
+            Shard& shard = shardOf(key);
+            std::shared_lock lock(shard.m_Mutex);
+            return shard.m_Map.contains(key);
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @param key
+         * @param value
+         * @return True if insertion occurred, false if the key already exists
+         */
+        bool insert(const K& key, const V& value) {
+            Shard& shard = shardOf(key);
+            std::unique_lock lock(shard.m_Mutex);
+            return shard.m_Map.insert(key, value).second;
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @param key
+         * @param value
+         * @return True if insertion occurred, false if the key already exists
+         */
+        bool insert(const K& key, V&& value) {
+            Shard& shard = shardOf(key);
+            std::unique_lock lock(shard.m_Mutex);
+            return shard.m_Map.insert(key, std::move(value)).second;
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the existing value is replaced by the new value.
+         * @param key
+         * @param value
+         * @return True if insertion occurred, false if replacement occurred
+         */
+        bool insertOrReplace(const K& key, const V& value) {
+            Shard& shard = shardOf(key);
+            std::unique_lock lock(shard.m_Mutex);
+            return shard.m_Map.insertOrReplace(key, value).second;
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the existing value is replaced by the new value.
+         * @param key
+         * @param value
+         * @return True if insertion occurred, false if replacement occurred
+         */
+        bool insertOrReplace(const K& key, V&& value) {
+            Shard& shard = shardOf(key);
+            std::unique_lock lock(shard.m_Mutex);
+            return shard.m_Map.insertOrReplace(key, std::move(value)).second;
+        }
+
+        /**
+         * Get the value with the specified key, creating it if the key does not exist yet. The shared lock is tried
+         * first, so the common case where the key exists does not block other readers. If the key is missing, the
+         * factory is called under the exclusive lock of the shard, so it is called at most once per key even if
+         * several threads ask for the same missing key. The factory must not use this map.
+         * @tparam Factory Callable taking no arguments and returning something V can be constructed from
+         * @param key
+         * @param factory
+         * @return Copy of the existing or newly created value
+         */
+        template<typename Factory>
+        V computeIfAbsent(const K& key, Factory&& factory) {
+            Shard& shard = shardOf(key);
+            {
+                std::shared_lock lock(shard.m_Mutex);
+                auto result = shard.m_Map.at(key);
+                if (result != std::nullopt) {
+                    return result.value().get();
+                }
+            }
+            std::unique_lock lock(shard.m_Mutex);
+            auto result = shard.m_Map.at(key);
+            if (result != std::nullopt) {
+                return result.value().get();
+            }
+            return shard.m_Map.emplace(key, std::invoke(std::forward<Factory>(factory))).first.second.get();
+        }
+
+        /**
+         * Erase key-value pair with specified key.
+         * @param key
+         * @return True if key was found and key-value pair was removed, false if not.
+         */
+        bool erase(const K& key) {
+            Shard& shard = shardOf(key);
+            std::unique_lock lock(shard.m_Mutex);
+            return shard.m_Map.erase(key);
+        }
+
+        /**
+         * Remove all elements in the container. Shards are cleared one after another.
+         */
+        void clear() {
+            for (std::size_t i = 0; i < m_ShardCount; i++) {
+                std::unique_lock lock(m_Shards[i].m_Mutex);
+                m_Shards[i].m_Map.clear();
+            }
+        }
+
+        /**
+         * Destructor
+         */
+        ~ConcurrentMap() {
+            delete[] m_Shards;
+        }
+
+    };
+
+}
@@ -0,0 +1,196 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * Union find (dis-joint set) data structure that can be used from several threads at once, such as to find the
+     * connected components of a graph whose edges are split between threads.
+     * Every parent pointer is an atomic, and every operation is lock-free.
+     * Find does path halving: each node on the path is pointed to its grandparent with a compare and swap, which is
+     * simply skipped if another thread changed the node first, since either pointer is still on the path to the root.
+     * Join links one root under the other with a compare and swap that only succeeds if it is still a root, and tries
+     * again otherwise. Roots are linked by a randomized rank: a fixed hash of each node, ties broken by index, so that
+     * links are always made in the same direction of one total order, which rules out cycles, and the trees stay
+     * O(logn) tall in expectation without having to keep ranks up to date between threads.
+     */
+    class ConcurrentUnionFind {
+    private:
+
+        /// The value inside each index is the parent node of that index.
+        std::unique_ptr<std::atomic<std::size_t>[]> m_Graph;
+
+        /// Number of nodes
+        std::size_t m_Size = 0;
+
+        /// Number of disjoint sets.
+        std::atomic<std::size_t> m_NumberOfSets{0};
+
+        /**
+         * Check if an index is out of bounds.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] bool outOfBounds(std::size_t index) const noexcept {
+            return index >= m_Size;
+        }
+
+        /**
+         * Check if a root is linked under another root, rather than the other way around.
+         * @param root
+         * @param other
+         * @return
+         */
+        [[nodiscard]] static bool linkedUnder(std::size_t root, std::size_t other) noexcept {
+            std::size_t rootRank = impl::ds::mixHash(root);
+            std::size_t otherRank = impl::ds::mixHash(other);
+            return rootRank < otherRank || (rootRank == otherRank && root < other);
+        }
+
+        /**
+         * Find the root of a node, which must be valid, halving the path on the way.
+         * @param node
+         * @return
+         */
+        [[nodiscard]] std::size_t findUnchecked(std::size_t node) noexcept {
+            while (true) {
+                std::size_t parent = m_Graph[node].load(std::memory_order_acquire);
+                std::size_t grandparent = m_Graph[parent].load(std::memory_order_acquire);
+                if (parent == grandparent) {
+                    return parent;
+                }
+                m_Graph[node].compare_exchange_weak(parent, grandparent, std::memory_order_release,
+                                                    std::memory_order_relaxed);
+                node = grandparent;
+            }
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param size Number of nodes in the ConcurrentUnionFind
+         */
+        explicit ConcurrentUnionFind(std::size_t size) {
+            if (size <= 0) {
+                throw std::invalid_argument("Size of union find cannot be less than 1");
+            }
+            m_Size = size;
+            m_NumberOfSets.store(size, std::memory_order_relaxed);
+            m_Graph.reset(new std::atomic<std::size_t>[size]);
+            for (std::size_t i = 0; i < size; i++) {
+                m_Graph[i].store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ConcurrentUnionFind(const ConcurrentUnionFind& other) = delete;
+
+        ConcurrentUnionFind& operator=(const ConcurrentUnionFind& other) = delete;
+
+        /**
+         * Get the number of nodes.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Get the number of disjoint sets. The range of values are [1, size]. While joins are in progress, this may
+         * not yet count the latest ones.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSets() const noexcept {
+            return m_NumberOfSets.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Find which set a node belongs to. While joins are in progress, the root returned may already have been
+         * linked under another root.
+         * @param node
+         * @return Root node of the specified node
+         */
+        [[nodiscard]] std::size_t find(std::size_t node) {
+            if (outOfBounds(node)) {
+                throw std::invalid_argument("Invalid node");
+            }
+            return findUnchecked(node);
+        }
+
+        /**
+         * Union two nodes' group together.
+         * Union does not occur if both nodes have the same root node. Otherwise, the root with the lower randomized
+         * rank is linked under the other.
+         * @param node1
+         * @param node2
+         * @return True if this call joined the groups, false if they were already joined
+         */
+        bool join(std::size_t node1, std::size_t node2) {
+            if (outOfBounds(node1) || outOfBounds(node2)) {
+                throw std::invalid_argument("Invalid node");
+            }
+            while (true) {
+                std::size_t root1 = findUnchecked(node1);
+                std::size_t root2 = findUnchecked(node2);
+                if (root1 == root2) {
+                    return false;
+                }
+                if (linkedUnder(root2, root1)) {
+                    std::swap(root1, root2);
+                }
+                // Only link root1 if no other thread has linked it in the meantime
+                std::size_t expected = root1;
+                if (m_Graph[root1].compare_exchange_strong(expected, root2, std::memory_order_acq_rel,
+                                                           std::memory_order_acquire)) {
+                    m_NumberOfSets.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+                node1 = root1;
+                node2 = root2;
+            }
+        }
+
+        /**
+         * Check if 2 nodes are connected. The roots of the two nodes may differ because one of them was linked after
+         * it was found, so the answer is only false once the first root is seen to still be a root.
+         * @param node1
+         * @param node2
+         * @return True if they are connected
+         */
+        [[nodiscard]] bool connected(std::size_t node1, std::size_t node2) {
+            if (outOfBounds(node1) || outOfBounds(node2)) {
+                throw std::invalid_argument("Invalid node");
+            }
+            while (true) {
+                std::size_t root1 = findUnchecked(node1);
+                std::size_t root2 = findUnchecked(node2);
+                if (root1 == root2) {
+                    return true;
+                }
+                if (m_Graph[root1].load(std::memory_order_acquire) == root1) {
+                    return false;
+                }
+                node1 = root1;
+                node2 = root2;
+            }
+        }
+
+        /**
+         * Destructor
+         */
+        ~ConcurrentUnionFind() = default;
+
+    };
+
+}
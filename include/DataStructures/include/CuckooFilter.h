@@ -0,0 +1,332 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "impl/DataStructuresImpl.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace wtl {
+
+    /**
+     * A cuckoo filter answers whether a key may have been inserted, like a BloomFilter, but also supports removing
+     * keys. It stores a small fingerprint of each key in one of two buckets of 4 slots. If both buckets are full, a
+     * fingerprint is moved to its other bucket to make space, as in cuckoo hashing.
+     * The false positive rate is at most 8 / 2^bits of the fingerprint: about 3% with 8 bit fingerprints, and
+     * about 0.01% with the default 16 bit fingerprints.
+     * Only keys that were inserted may be erased. Erasing a key that was never inserted can remove the fingerprint of
+     * a different key and cause a false negative.
+     * @tparam K
+     * @tparam Hash
+     * @tparam Fingerprint Unsigned integer type storing the fingerprints
+     */
+    template<typename K, typename Hash = std::hash<K>, typename Fingerprint = std::uint16_t>
+    class CuckooFilter {
+    public:
+
+        static_assert(std::is_unsigned_v<Fingerprint>, "Fingerprint must be an unsigned integer type!");
+
+        typedef K KeyType;
+
+        /// Cuckoo filters can remove keys
+        static constexpr bool SUPPORTS_ERASE = true;
+
+    private:
+
+        static constexpr std::size_t BUCKET_SIZE = 4;
+        static constexpr std::size_t MAXIMUM_KICKS = 500;
+        static constexpr double MAXIMUM_LOAD_FACTOR = 0.95;
+
+        /// Fingerprint of an empty slot
+        static constexpr Fingerprint EMPTY = 0;
+
+        /// Number of fingerprints stored, including the victim
+        std::size_t m_Size = 0;
+
+        /// Number of buckets, always a power of 2
+        std::size_t m_BucketCount = 0;
+
+        /// Fingerprints, BUCKET_SIZE per bucket
+        Fingerprint* m_Table = nullptr;
+
+        /// Fingerprint that could not be placed after MAXIMUM_KICKS moves, or EMPTY
+        Fingerprint m_Victim = EMPTY;
+
+        /// Bucket of the victim
+        std::size_t m_VictimIndex = 0;
+
+        /// State of the xorshift generator used to pick which fingerprint to move
+        std::uint64_t m_Random = 0x2545F4914F6CDD1Dull;
+
+        /// Hashing algorithm
+        Hash m_Hash;
+
+        /**
+         * Non-zero fingerprint taken from the upper bits of the hash, which are not used for the bucket index.
+         * @param hash
+         * @return
+         */
+        [[nodiscard]] static Fingerprint fingerprintOf(std::uint64_t hash) noexcept {
+            auto fingerprint = static_cast<Fingerprint>(hash >> (64 - std::numeric_limits<Fingerprint>::digits));
+            return fingerprint == EMPTY ? 1 : fingerprint;
+        }
+
+        /**
+         * The other bucket a fingerprint can be stored in. Only the fingerprint and the current bucket are needed,
+         * and applying this twice gives back the original bucket.
+         * @param index
+         * @param fingerprint
+         * @return
+         */
+        [[nodiscard]] std::size_t alternateIndex(std::size_t index, Fingerprint fingerprint) const noexcept {
+            return (index ^ impl::ds::mixHash(fingerprint)) & (m_BucketCount - 1);
+        }
+
+        /**
+         * Store a fingerprint in a free slot of a bucket.
+         * @param index
+         * @param fingerprint
+         * @return False if the bucket is full
+         */
+        bool insertIntoBucket(std::size_t index, Fingerprint fingerprint) noexcept {
+            Fingerprint* bucket = m_Table + index * BUCKET_SIZE;
+            for (std::size_t i = 0; i < BUCKET_SIZE; i++) {
+                if (bucket[i] == EMPTY) {
+                    bucket[i] = fingerprint;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Check if a bucket holds a fingerprint.
+         * @param index
+         * @param fingerprint
+         * @return
+         */
+        [[nodiscard]] bool bucketContains(std::size_t index, Fingerprint fingerprint) const noexcept {
+            const Fingerprint* bucket = m_Table + index * BUCKET_SIZE;
+            bool result = false;
+            for (std::size_t i = 0; i < BUCKET_SIZE; i++) {
+                result |= bucket[i] == fingerprint;
+            }
+            return result;
+        }
+
+        /**
+         * Remove one copy of a fingerprint from a bucket.
+         * @param index
+         * @param fingerprint
+         * @return False if the bucket does not hold the fingerprint
+         */
+        bool eraseFromBucket(std::size_t index, Fingerprint fingerprint) noexcept {
+            Fingerprint* bucket = m_Table + index * BUCKET_SIZE;
+            for (std::size_t i = 0; i < BUCKET_SIZE; i++) {
+                if (bucket[i] == fingerprint) {
+                    bucket[i] = EMPTY;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Next pseudo-random number.
+         * @return
+         */
+        std::uint64_t nextRandom() noexcept {
+            m_Random ^= m_Random << 13;
+            m_Random ^= m_Random >> 7;
+            m_Random ^= m_Random << 17;
+            return m_Random;
+        }
+
+        /**
+         * Store a fingerprint in one of its two buckets. If both are full, a random fingerprint of the bucket is
+         * swapped out and moved to its own other bucket, up to MAXIMUM_KICKS times. The fingerprint that is left
+         * over after that becomes the victim.
+         * @param index One of the two buckets of the fingerprint
+         * @param fingerprint
+         */
+        void place(std::size_t index, Fingerprint fingerprint) noexcept {
+            if (insertIntoBucket(index, fingerprint)) {
+                return;
+            }
+            index = alternateIndex(index, fingerprint);
+            if (insertIntoBucket(index, fingerprint)) {
+                return;
+            }
+            for (std::size_t kick = 0; kick < MAXIMUM_KICKS; kick++) {
+                std::size_t slot = index * BUCKET_SIZE + nextRandom() % BUCKET_SIZE;
+                std::swap(fingerprint, m_Table[slot]);
+                index = alternateIndex(index, fingerprint);
+                if (insertIntoBucket(index, fingerprint)) {
+                    return;
+                }
+            }
+            m_Victim = fingerprint;
+            m_VictimIndex = index;
+        }
+
+        /**
+         * Compute the bucket index and fingerprint of a key.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::pair<std::size_t, Fingerprint> locate(const K& key) const noexcept {
+            std::uint64_t hash = impl::ds::mixHash64(m_Hash(key));
+            return {static_cast<std::size_t>(hash) & (m_BucketCount - 1), fingerprintOf(hash)};
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param capacity Number of keys the filter must be able to hold
+         */
+        explicit CuckooFilter(std::size_t capacity) : m_BucketCount(1) {
+            while (static_cast<double>(m_BucketCount * BUCKET_SIZE) * MAXIMUM_LOAD_FACTOR <
+                   static_cast<double>(capacity)) {
+                m_BucketCount *= 2;
+            }
+            m_Table = new Fingerprint[m_BucketCount * BUCKET_SIZE]();
+        }
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        CuckooFilter(const CuckooFilter& other)
+                : m_Size(other.m_Size), m_BucketCount(other.m_BucketCount), m_Victim(other.m_Victim),
+                  m_VictimIndex(other.m_VictimIndex), m_Random(other.m_Random), m_Hash(other.m_Hash) {
+            m_Table = new Fingerprint[m_BucketCount * BUCKET_SIZE];
+            std::memcpy(m_Table, other.m_Table, m_BucketCount * BUCKET_SIZE * sizeof(Fingerprint));
+        }
+
+        /**
+         * Copy assignment
+         * @param other
+         * @return
+         */
+        CuckooFilter& operator=(const CuckooFilter& other) {
+            if (this != &other) {
+                delete[] m_Table;
+                m_Size = other.m_Size;
+                m_BucketCount = other.m_BucketCount;
+                m_Victim = other.m_Victim;
+                m_VictimIndex = other.m_VictimIndex;
+                m_Random = other.m_Random;
+                m_Hash = other.m_Hash;
+                m_Table = new Fingerprint[m_BucketCount * BUCKET_SIZE];
+                std::memcpy(m_Table, other.m_Table, m_BucketCount * BUCKET_SIZE * sizeof(Fingerprint));
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of keys stored. Inserting the same key twice counts twice.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Get the fraction of slots in use.
+         * @return
+         */
+        [[nodiscard]] double getLoadFactor() const noexcept {
+            return static_cast<double>(m_Size) / static_cast<double>(m_BucketCount * BUCKET_SIZE);
+        }
+
+        /**
+         * Get the number of bytes used by the fingerprints.
+         * @return
+         */
+        [[nodiscard]] std::size_t getMemoryUsage() const noexcept {
+            return m_BucketCount * BUCKET_SIZE * sizeof(Fingerprint);
+        }
+
+        /**
+         * Insert a key. Once the table is so full that a fingerprint cannot be placed, that fingerprint is held aside
+         * as the victim, and further insertions fail until a key is erased. No inserted key is ever lost.
+         * @param key
+         * @return True if the key was inserted, false if the filter is full
+         */
+        bool insert(const K& key) noexcept {
+            if (m_Victim != EMPTY) {
+                return false;
+            }
+            auto[index, fingerprint] = locate(key);
+            place(index, fingerprint);
+            ++m_Size;
+            return true;
+        }
+
+        /**
+         * Check if a key may have been inserted.
+         * @param key
+         * @return False if the key was definitely never inserted, true if it probably was.
+         */
+        [[nodiscard]] bool mayContain(const K& key) const noexcept {
+            auto[index, fingerprint] = locate(key);
+            std::size_t alternate = alternateIndex(index, fingerprint);
+            if (m_Victim == fingerprint && (m_VictimIndex == index || m_VictimIndex == alternate)) {
+                return true;
+            }
+            return bucketContains(index, fingerprint) || bucketContains(alternate, fingerprint);
+        }
+
+        /**
+         * Erase a key that was inserted.
+         * @param key
+         * @return True if a fingerprint of the key was found and removed
+         */
+        bool erase(const K& key) noexcept {
+            auto[index, fingerprint] = locate(key);
+            std::size_t alternate = alternateIndex(index, fingerprint);
+            if (eraseFromBucket(index, fingerprint) || eraseFromBucket(alternate, fingerprint)) {
+                --m_Size;
+                // A slot is free now, so try to place the victim again.
+                if (m_Victim != EMPTY) {
+                    Fingerprint victim = m_Victim;
+                    m_Victim = EMPTY;
+                    place(m_VictimIndex, victim);
+                }
+                return true;
+            }
+            if (m_Victim == fingerprint && (m_VictimIndex == index || m_VictimIndex == alternate)) {
+                m_Victim = EMPTY;
+                --m_Size;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Remove all keys.
+         */
+        void clear() noexcept {
+            std::memset(m_Table, 0, m_BucketCount * BUCKET_SIZE * sizeof(Fingerprint));
+            m_Victim = EMPTY;
+            m_Size = 0;
+        }
+
+        /**
+         * Destructor
+         */
+        ~CuckooFilter() {
+            delete[] m_Table;
+        }
+
+    };
+
+}
@@ -0,0 +1,370 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * Indexed priority queue whose keys are the integers in [0, capacity), such as the vertices of a graph. Unlike
+     * IndexedPriorityQueue, keys are not mapped to key-indexes through a BiMap: the key is the index, and the
+     * position and inverse maps are flat arrays allocated once at construction. Checking if a key exists and finding
+     * its element take O(1) time.
+     * The heap is d-ary and elements are sifted by moving them into a hole, not by swapping.
+     * By default, the comparison is done using operator<, hence the largest value has the highest priority.
+     * @tparam V Type of value to be sorted in the priority queue
+     * @tparam Comparator Type of binary predicate used to compare values to determine their priorities
+     * @tparam Arity Number of children of each node of the heap, at least 2
+     */
+    template<typename V, typename Comparator = impl::ds::StandardComparator<V>, std::size_t Arity = 2>
+    class DenseIndexedPriorityQueue {
+    private:
+
+        static_assert(Arity >= 2, "A heap node must have at least 2 children");
+
+        using Const_Result = std::pair<std::size_t, std::reference_wrapper<const V>>;
+
+        /// Position of a key that is not in the priority queue
+        static constexpr std::size_t NOT_PRESENT = std::numeric_limits<std::size_t>::max();
+
+        /// Comparator object used for ordering
+        impl::ds::ComparatorHelper<V, Comparator> comparator;
+
+        /// Values in heap order
+        std::vector<V> m_Heap;
+
+        /// Maps from position in the heap to key
+        std::vector<std::size_t> m_InverseMap;
+
+        /// Maps from key to position in the heap, or NOT_PRESENT
+        std::vector<std::size_t> m_PositionMap;
+
+        void checkKey(std::size_t key) const {
+            if (key >= m_PositionMap.size()) {
+                throw std::out_of_range("Key out of range");
+            }
+        }
+
+        std::size_t positionOf(std::size_t key) const {
+            checkKey(key);
+            std::size_t position = m_PositionMap[key];
+            if (position == NOT_PRESENT) {
+                throw std::invalid_argument("Key not found");
+            }
+            return position;
+        }
+
+        /**
+         * Move the element at a position, and its key, into another position.
+         * @param from
+         * @param to
+         */
+        void moveTo(std::size_t from, std::size_t to) noexcept {
+            m_Heap[to] = std::move(m_Heap[from]);
+            m_InverseMap[to] = m_InverseMap[from];
+            m_PositionMap[m_InverseMap[to]] = to;
+        }
+
+        /**
+         * Move an element up towards the root until its parent does not have lower priority.
+         * @param position
+         * @return Position of the element afterwards
+         */
+        std::size_t siftUp(std::size_t position) noexcept {
+            V value = std::move(m_Heap[position]);
+            std::size_t key = m_InverseMap[position];
+            while (position > 0) {
+                std::size_t parent = (position - 1) / Arity;
+                if (!comparator(m_Heap[parent], value)) {
+                    break;
+                }
+                moveTo(parent, position);
+                position = parent;
+            }
+            m_Heap[position] = std::move(value);
+            m_InverseMap[position] = key;
+            m_PositionMap[key] = position;
+            return position;
+        }
+
+        /**
+         * Move an element down towards the leaves until none of its children has higher priority.
+         * @param position
+         */
+        void siftDown(std::size_t position) noexcept {
+            std::size_t size = m_Heap.size();
+            V value = std::move(m_Heap[position]);
+            std::size_t key = m_InverseMap[position];
+            while (true) {
+                std::size_t first = position * Arity + 1;
+                if (first >= size) {
+                    break;
+                }
+                std::size_t last = first + Arity < size ? first + Arity : size;
+                std::size_t largest = first;
+                for (std::size_t child = first + 1; child < last; child++) {
+                    if (comparator(m_Heap[largest], m_Heap[child])) {
+                        largest = child;
+                    }
+                }
+                if (!comparator(value, m_Heap[largest])) {
+                    break;
+                }
+                moveTo(largest, position);
+                position = largest;
+            }
+            m_Heap[position] = std::move(value);
+            m_InverseMap[position] = key;
+            m_PositionMap[key] = position;
+        }
+
+        /**
+         * Restore the heap order after the element at a position changed.
+         * @param position
+         */
+        void fix(std::size_t position) noexcept {
+            if (siftUp(position) == position) {
+                siftDown(position);
+            }
+        }
+
+        /**
+         * Remove the element at a position, moving the last element into its place.
+         * @param position
+         */
+        void removeAt(std::size_t position) noexcept {
+            m_PositionMap[m_InverseMap[position]] = NOT_PRESENT;
+            std::size_t last = m_Heap.size() - 1;
+            if (position != last) {
+                moveTo(last, position);
+            }
+            m_Heap.pop_back();
+            m_InverseMap.pop_back();
+            if (position != last) {
+                fix(position);
+            }
+        }
+
+        template<typename ... Ts>
+        bool push(std::size_t key, Ts&& ... args) {
+            checkKey(key);
+            if (m_PositionMap[key] != NOT_PRESENT) {
+                return false;
+            }
+            m_Heap.emplace_back(std::forward<Ts>(args)...);
+            m_InverseMap.push_back(key);
+            siftUp(m_Heap.size() - 1);
+            return true;
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param capacity Keys are the integers in [0, capacity)
+         */
+        explicit DenseIndexedPriorityQueue(std::size_t capacity) : m_PositionMap(capacity, NOT_PRESENT) {
+            m_Heap.reserve(capacity);
+            m_InverseMap.reserve(capacity);
+        }
+
+        /**
+         * Constructor
+         * Construct the priority queue using a range of priorities, where the key of each element is its index in
+         * the range, in O(n) time.
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        DenseIndexedPriorityQueue(Iterator first, Iterator last)
+                : DenseIndexedPriorityQueue(static_cast<std::size_t>(std::distance(first, last))) {
+            build(first, last);
+        }
+
+        /**
+         * Get the number of keys the priority queue can hold.
+         * @return
+         */
+        [[nodiscard]] std::size_t getCapacity() const noexcept {
+            return m_PositionMap.size();
+        }
+
+        /**
+         * Return number of elements in the IPQ.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Heap.size();
+        }
+
+        /**
+         * Check if the IPQ is empty.
+         * @return True if empty, false if not.
+         */
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return m_Heap.empty();
+        }
+
+        /**
+         * Get the element with the highest priority, and its key.
+         * @return
+         */
+        [[nodiscard]] Const_Result peek() const {
+            if (isEmpty()) {
+                throw std::runtime_error("Indexed Priority Queue is empty");
+            }
+            return {m_InverseMap[0], m_Heap[0]};
+        }
+
+        /**
+         * Checks if a key exists in the IPQ.
+         * @param key
+         * @return True if it exists, false if not
+         */
+        [[nodiscard]] bool exists(std::size_t key) const noexcept {
+            return key < m_PositionMap.size() && m_PositionMap[key] != NOT_PRESENT;
+        }
+
+        /**
+         * Find an element in the IPQ using its key.
+         * @param key
+         * @return const reference to the element
+         */
+        [[nodiscard]] const V& find(std::size_t key) const {
+            return m_Heap[positionOf(key)];
+        }
+
+        /**
+         * Get the position of an element in the heap. If the value is 0, then it is head of the queue.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::size_t position(std::size_t key) const {
+            return positionOf(key);
+        }
+
+        /**
+         * Replace the contents of the IPQ using a range of priorities, where the key of each element is its index in
+         * the range. The heap is built bottom-up in O(n) time.
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void build(Iterator first, Iterator last) {
+            if (static_cast<std::size_t>(std::distance(first, last)) > getCapacity()) {
+                throw std::out_of_range("More priorities than the capacity");
+            }
+            clear();
+            for (std::size_t key = 0; first != last; ++first, key++) {
+                m_Heap.push_back(*first);
+                m_InverseMap.push_back(key);
+                m_PositionMap[key] = key;
+            }
+            if (m_Heap.size() < 2) {
+                return;
+            }
+            for (std::size_t i = (m_Heap.size() - 2) / Arity + 1; i > 0; i--) {
+                siftDown(i - 1);
+            }
+        }
+
+        /**
+         * Insert key-value pair into the IPQ. If duplicate key is found, then no change is made.
+         * @param key
+         * @param value
+         * @return True if key-value was inserted, false if duplicate key was found
+         */
+        bool insert(std::size_t key, const V& value) {
+            return push(key, value);
+        }
+
+        /**
+         * Insert key-value pair into the IPQ. If duplicate key is found, then no change is made.
+         * @param key
+         * @param value
+         * @return True if key-value was inserted, false if duplicate key was found
+         */
+        bool insert(std::size_t key, V&& value) {
+            return push(key, std::move(value));
+        }
+
+        /**
+         * Insert key-value pair into the IPQ, with constructing the value in-place. If duplicate key is found,
+         * then no change is made.
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return True if key-value was inserted, false if duplicate key was found
+         */
+        template<typename ... Ts>
+        bool emplace(std::size_t key, Ts&& ... args) {
+            return push(key, std::forward<Ts>(args)...);
+        }
+
+        /**
+         * Remove the element with the highest priority from the IPQ.
+         */
+        void poll() {
+            if (isEmpty()) {
+                throw std::runtime_error("IPQ is empty");
+            }
+            removeAt(0);
+        }
+
+        /**
+         * Update an element in the priority queue using its key. The priority queue ordering is maintained.
+         * @param key
+         * @param value
+         */
+        void update(std::size_t key, const V& value) {
+            std::size_t position = positionOf(key);
+            m_Heap[position] = value;
+            fix(position);
+        }
+
+        /**
+         * Update an element in the priority queue using its key. The priority queue ordering is maintained.
+         * @param key
+         * @param value
+         */
+        void update(std::size_t key, V&& value) {
+            std::size_t position = positionOf(key);
+            m_Heap[position] = std::move(value);
+            fix(position);
+        }
+
+        /**
+         * Remove an element from the IPQ using its key
+         * @param key
+         */
+        void remove(std::size_t key) {
+            removeAt(positionOf(key));
+        }
+
+        /**
+         * Clear the IPQ in O(size) time. The capacity is kept.
+         */
+        void clear() noexcept {
+            for (std::size_t key : m_InverseMap) {
+                m_PositionMap[key] = NOT_PRESENT;
+            }
+            m_Heap.clear();
+            m_InverseMap.clear();
+        }
+
+    };
+
+}
@@ -0,0 +1,208 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "impl/DataStructuresImpl.h"
+#include "RangeOperations.h"
+
+namespace wtl {
+
+    /**
+     * A disjoint sparse table allows for O(1) range query of a static array for any associative function, such as
+     * sum, product, matrix multiplication or combining string hashes. Unlike SparseTable, the function does not have
+     * to be idempotent or commutative, and unlike FenwickTree it does not have to be invertible.
+     * Level h splits the array into blocks of 2^(h + 1) elements. Within each block, the left half stores the result
+     * of the operation from each element to the middle of the block, and the right half stores the result from the
+     * middle of the block to each element. A query [l, r] with l != r uses the level of the highest bit in which l
+     * and r differ, where l and r are in the same block but on either side of its middle, so it is answered by one
+     * combine of two entries.
+     * Building takes O(nlogn) time and space.
+     * @tparam T
+     * @tparam Combine Type of associative binary operation
+     */
+    template<typename T, typename Combine = RangeSum<T>>
+    class DisjointSparseTable {
+    private:
+
+        /// Number of elements in the table
+        std::size_t m_Size = 0;
+
+        /// Number of levels
+        std::size_t m_Levels = 0;
+
+        /// The elements, followed by each level, which has m_Size entries
+        std::vector<T> m_Table;
+
+        /// Operation done by the table
+        Combine m_Combine;
+
+        template<typename Iterator>
+        void constructTable(Iterator iteratorBegin, Iterator iteratorEnd) {
+            m_Size = static_cast<std::size_t>(std::distance(iteratorBegin, iteratorEnd));
+            if (m_Size == 0) {
+                throw std::invalid_argument("Cannot construct empty disjoint sparse table");
+            }
+            m_Levels = m_Size > 1 ? impl::ds::floorLog2(m_Size - 1) + 1 : 0;
+            m_Table.reserve(m_Size * (m_Levels + 1));
+            m_Table.insert(m_Table.end(), iteratorBegin, iteratorEnd);
+            m_Table.resize(m_Size * (m_Levels + 1));
+
+            const T* values = m_Table.data();
+            for (std::size_t level = 0; level < m_Levels; level++) {
+                T* row = m_Table.data() + (level + 1) * m_Size;
+                std::size_t half = std::size_t(1) << level;
+                for (std::size_t middle = half; middle < m_Size; middle += half << 1) {
+                    // Left half, from each element up to the middle
+                    std::size_t start = middle - half;
+                    row[middle - 1] = values[middle - 1];
+                    for (std::size_t i = middle - 1; i > start; i--) {
+                        row[i - 1] = m_Combine(values[i - 1], row[i]);
+                    }
+                    // Right half, from the middle up to each element
+                    std::size_t end = std::min(middle + half, m_Size);
+                    row[middle] = values[middle];
+                    for (std::size_t i = middle + 1; i < end; i++) {
+                        row[i] = m_Combine(row[i - 1], values[i]);
+                    }
+                }
+            }
+        }
+
+        void checkRange(std::size_t startIndex, std::size_t endIndex) const {
+            if (startIndex >= m_Size || endIndex >= m_Size || startIndex > endIndex) {
+                throw std::invalid_argument("Index out of range");
+            }
+        }
+
+        /**
+         * Query between two inclusive indexes, which must be valid.
+         * @param startIndex
+         * @param endIndex
+         * @return
+         */
+        T queryUnchecked(std::size_t startIndex, std::size_t endIndex) const {
+            if (startIndex == endIndex) {
+                return m_Table[startIndex];
+            }
+            const T* row = m_Table.data() + (impl::ds::floorLog2(startIndex ^ endIndex) + 1) * m_Size;
+            return m_Combine(row[startIndex], row[endIndex]);
+        }
+
+    public:
+
+        /**
+         * Constructor.
+         * Construct a disjoint sparse table using the elements in a stl container.
+         * @tparam Iterator
+         * @param iteratorBegin Iterator pointing to the first element in the stl container
+         * @param iteratorEnd Iterator pointing to the past-the-end element of the stl container
+         * @param combine Operation object
+         */
+        template<typename Iterator>
+        DisjointSparseTable(Iterator iteratorBegin, Iterator iteratorEnd, Combine combine = Combine())
+                : m_Combine(std::move(combine)) {
+            constructTable(iteratorBegin, iteratorEnd);
+        }
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        DisjointSparseTable(const DisjointSparseTable& other) = default;
+
+        /**
+         * Copy assignment
+         */
+        DisjointSparseTable& operator=(const DisjointSparseTable& other) = default;
+
+        /**
+         * Move constructor
+         * @param other
+         */
+        DisjointSparseTable(DisjointSparseTable&& other) noexcept
+                : m_Size(std::exchange(other.m_Size, 0)), m_Levels(std::exchange(other.m_Levels, 0)),
+                  m_Table(std::move(other.m_Table)), m_Combine(std::move(other.m_Combine)) {}
+
+        /**
+         * Move assignment
+         */
+        DisjointSparseTable& operator=(DisjointSparseTable&& other) noexcept {
+            if (this != &other) {
+                m_Size = std::exchange(other.m_Size, 0);
+                m_Levels = std::exchange(other.m_Levels, 0);
+                m_Table = std::move(other.m_Table);
+                m_Combine = std::move(other.m_Combine);
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of elements in the table
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Get the number of bytes used by the table, excluding the object itself.
+         * @return
+         */
+        [[nodiscard]] std::size_t getMemoryUsage() const noexcept {
+            return m_Table.capacity() * sizeof(T);
+        }
+
+        /**
+         * Query between two inclusive indexes.
+         * @param startIndex
+         * @param endIndex
+         * @return Result of the operation over the elements from startIndex to endIndex, in order
+         */
+        [[nodiscard]] T query(std::size_t startIndex, std::size_t endIndex) const {
+            checkRange(startIndex, endIndex);
+            return queryUnchecked(startIndex, endIndex);
+        }
+
+        /**
+         * Answer a range of queries, each a pair of inclusive indexes, as impl::ds::batchRangeQuery does.
+         * @tparam RangeIterator Iterator over std::pair<std::size_t, std::size_t>, or similar
+         * @tparam OutputIterator
+         * @param first
+         * @param last
+         * @param out
+         * @return Output iterator past the last result written
+         */
+        template<typename RangeIterator, typename OutputIterator>
+        OutputIterator query(RangeIterator first, RangeIterator last, OutputIterator out) const {
+            return impl::ds::batchRangeQuery(first, last, out, [this](std::size_t startIndex, std::size_t endIndex) {
+                return query(startIndex, endIndex);
+            });
+        }
+
+        /**
+         * Answer a batch of queries, each a pair of inclusive indexes.
+         * @param ranges
+         * @return Results in the same order as the queries
+         */
+        [[nodiscard]] std::vector<T> query(const std::vector<std::pair<std::size_t, std::size_t>>& ranges) const {
+            return impl::ds::batchRangeQuery<T>(ranges, [this](std::size_t startIndex, std::size_t endIndex) {
+                return query(startIndex, endIndex);
+            });
+        }
+
+        /**
+         * Destructor
+         */
+        ~DisjointSparseTable() = default;
+    };
+
+}
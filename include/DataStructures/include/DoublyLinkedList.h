@@ -9,6 +9,8 @@
 #include <functional>
 #include <utility>
 #include <initializer_list>
+#include <type_traits>
+#include "NodePool.h"
 
 namespace wtl {
 
@@ -58,8 +60,11 @@ namespace wtl {
     /**
      * Doubly linked list
      * @tparam T Type of element stored
+     * @tparam NodeAllocator HeapNodeAllocator to allocate each node on its own, or NodePool to carve nodes out of
+     * chunks. A NodePool keeps the memory of removed nodes until the container is destroyed, so a container that
+     * grows large and shrinks again keeps its peak memory.
      */
-    template<typename T>
+    template<typename T, template<typename> class NodeAllocator = wtl::HeapNodeAllocator>
     class DoublyLinkedList {
     private:
 
@@ -75,6 +80,9 @@ namespace wtl {
         /// Pointer to the back of the linked list
         DLLNode* m_Tail = nullptr;
 
+        /// Allocator of the nodes
+        NodeAllocator<DLLNode> m_Nodes;
+
         /**
          * Check if index is out of bounds
          * @param index
@@ -97,12 +105,12 @@ namespace wtl {
             DLLNode* ptr = nullptr;
             if (index <= (m_Size - 1) / 2) {
                 ptr = m_Head;
-                for (int i = 0; i < index; i++) {
+                for (std::size_t i = 0; i < index; i++) {
                     ptr = ptr->m_Next;
                 }
             } else {
                 ptr = m_Tail;
-                for (int i = m_Size - 1; i != index; i--) {
+                for (std::size_t i = m_Size - 1; i != index; i--) {
                     ptr = ptr->m_Prev;
                 }
             }
@@ -114,7 +122,7 @@ namespace wtl {
          * @param data Element to be inserted
          */
         void insertToEmptyList(const T& data) noexcept {
-            auto* node = new DLLNode(data);
+            auto* node = m_Nodes.create(data);
             m_Head = node;
             m_Tail = node;
             m_Size++;
@@ -125,7 +133,7 @@ namespace wtl {
          * @param data Element to be inserted
          */
         void insertToEmptyList(T&& data) noexcept {
-            auto* node = new DLLNode(std::move(data));
+            auto* node = m_Nodes.create(std::move(data));
             m_Head = node;
             m_Tail = node;
             m_Size++;
@@ -133,7 +141,7 @@ namespace wtl {
 
         template<typename ... Ts>
         void insertToEmptyList(Ts&& ... args) noexcept {
-            auto* node = new DLLNode(nullptr, nullptr, std::forward<Ts>(args)...);
+            auto* node = m_Nodes.create(nullptr, nullptr, std::forward<Ts>(args)...);
             m_Head = node;
             m_Tail = node;
             m_Size++;
@@ -146,7 +154,7 @@ namespace wtl {
         void removeMiddle(DLLNode* nodeToRemove) noexcept {
             (nodeToRemove->m_Prev)->m_Next = nodeToRemove->m_Next;
             (nodeToRemove->m_Next)->m_Prev = nodeToRemove->m_Prev;
-            delete nodeToRemove;
+            m_Nodes.destroy(nodeToRemove);
             m_Size--;
         }
 
@@ -167,7 +175,7 @@ namespace wtl {
          * Copy constructor
          * @param other
          */
-        DoublyLinkedList(const DoublyLinkedList<T>& other) noexcept {
+        DoublyLinkedList(const DoublyLinkedList& other) noexcept {
             DLLNode* ptr = other.m_Head;
             while (ptr != nullptr) {
                 appendBack(ptr->m_Data);
@@ -180,7 +188,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        DoublyLinkedList<T>& operator=(const DoublyLinkedList<T>& other) noexcept {
+        DoublyLinkedList& operator=(const DoublyLinkedList& other) noexcept {
             if (this != &other) {
                 clear();
                 DLLNode* ptr = other.m_Head;
@@ -196,7 +204,7 @@ namespace wtl {
          * Move constructor
          * @param other
          */
-        DoublyLinkedList(DoublyLinkedList<T>&& other) noexcept {
+        DoublyLinkedList(DoublyLinkedList&& other) noexcept : m_Nodes(std::move(other.m_Nodes)) {
             m_Head = other.m_Head;
             other.m_Head = nullptr;
             m_Tail = other.m_Tail;
@@ -210,9 +218,10 @@ namespace wtl {
          * @param other
          * @return
          */
-        DoublyLinkedList<T>& operator=(DoublyLinkedList<T>&& other) noexcept {
+        DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept {
             if (this != &other) {
                 clear();
+                m_Nodes = std::move(other.m_Nodes);
                 m_Head = other.m_Head;
                 other.m_Head = nullptr;
                 m_Tail = other.m_Tail;
@@ -345,7 +354,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool equals(const DoublyLinkedList<T>& other) const noexcept {
+        bool equals(const DoublyLinkedList& other) const noexcept {
             return (*this) == other;
         }
 
@@ -354,7 +363,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool notEquals(const DoublyLinkedList<T>& other) const noexcept {
+        bool notEquals(const DoublyLinkedList& other) const noexcept {
             return !((*this) == other);
         }
 
@@ -363,7 +372,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator==(const DoublyLinkedList<T>& other) const noexcept {
+        bool operator==(const DoublyLinkedList& other) const noexcept {
             if (m_Size != other.m_Size) {
                 return false;
             }
@@ -384,7 +393,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator!=(const DoublyLinkedList<T>& other) const noexcept {
+        bool operator!=(const DoublyLinkedList& other) const noexcept {
             return !(*this == other);
         }
 
@@ -420,7 +429,7 @@ namespace wtl {
             if (isEmpty()) {
                 insertToEmptyList(data);
             } else {
-                auto* newHead = new DLLNode(data, nullptr, m_Head);
+                auto* newHead = m_Nodes.create(data, nullptr, m_Head);
                 m_Head->m_Prev = newHead;
                 m_Head = newHead;
                 m_Size++;
@@ -435,7 +444,7 @@ namespace wtl {
             if (isEmpty()) {
                 insertToEmptyList(std::move(data));
             } else {
-                auto* newHead = new DLLNode(std::move(data), nullptr, m_Head);
+                auto* newHead = m_Nodes.create(std::move(data), nullptr, m_Head);
                 m_Head->m_Prev = newHead;
                 m_Head = newHead;
                 m_Size++;
@@ -453,7 +462,7 @@ namespace wtl {
             if (isEmpty()) {
                 insertToEmptyList(std::forward<Ts>(args)...);
             } else {
-                auto* newHead = new DLLNode(nullptr, m_Head, std::forward<Ts>(args)...);
+                auto* newHead = m_Nodes.create(nullptr, m_Head, std::forward<Ts>(args)...);
                 m_Head->m_Prev = newHead;
                 m_Head = newHead;
                 m_Size++;
@@ -469,7 +478,7 @@ namespace wtl {
             if (isEmpty()) {
                 insertToEmptyList(data);
             } else {
-                auto* newTail = new DLLNode(data, m_Tail, nullptr);
+                auto* newTail = m_Nodes.create(data, m_Tail, nullptr);
                 m_Tail->m_Next = newTail;
                 m_Tail = newTail;
                 m_Size++;
@@ -484,7 +493,7 @@ namespace wtl {
             if (isEmpty()) {
                 insertToEmptyList(std::move(data));
             } else {
-                auto* newTail = new DLLNode(std::move(data), m_Tail, nullptr);
+                auto* newTail = m_Nodes.create(std::move(data), m_Tail, nullptr);
                 m_Tail->m_Next = newTail;
                 m_Tail = newTail;
                 m_Size++;
@@ -502,7 +511,7 @@ namespace wtl {
             if (isEmpty()) {
                 insertToEmptyList(std::forward<Ts>(args)...);
             } else {
-                auto* newTail = new DLLNode(m_Tail, nullptr, std::forward<Ts>(args)...);
+                auto* newTail = m_Nodes.create(m_Tail, nullptr, std::forward<Ts>(args)...);
                 m_Tail->m_Next = newTail;
                 m_Tail = newTail;
                 m_Size++;
@@ -530,7 +539,7 @@ namespace wtl {
             } else if (index == m_Size) {
                 appendBack(data);
             } else {
-                auto* newNode = new DLLNode(data);
+                auto* newNode = m_Nodes.create(data);
                 DLLNode* currNode = ptrTo(index);
                 (currNode->m_Prev)->m_Next = newNode;
                 newNode->m_Prev = currNode->m_Prev;
@@ -560,7 +569,7 @@ namespace wtl {
             } else if (index == m_Size) {
                 appendBack(std::move(data));
             } else {
-                auto* newNode = new DLLNode(std::move(data));
+                auto* newNode = m_Nodes.create(std::move(data));
                 DLLNode* currNode = ptrTo(index);
                 (currNode->m_Prev)->m_Next = newNode;
                 newNode->m_Prev = currNode->m_Prev;
@@ -594,7 +603,7 @@ namespace wtl {
                 emplaceBack(std::forward<Ts>(args)...);
                 return m_Tail->m_Data;
             } else {
-                auto* newNode = new DLLNode(nullptr, nullptr, std::forward<Ts>(args)...);
+                auto* newNode = m_Nodes.create(nullptr, nullptr, std::forward<Ts>(args)...);
                 DLLNode* currNode = ptrTo(index);
                 (currNode->m_Prev)->m_Next = newNode;
                 newNode->m_Prev = currNode->m_Prev;
@@ -618,7 +627,7 @@ namespace wtl {
                 } else {
                     m_Head->m_Prev = nullptr;
                 }
-                delete tempPtr;
+                m_Nodes.destroy(tempPtr);
             }
         }
 
@@ -635,7 +644,7 @@ namespace wtl {
                 } else {
                     m_Tail->m_Next = nullptr;
                 }
-                delete tempPtr;
+                m_Nodes.destroy(tempPtr);
             }
         }
 
@@ -653,7 +662,7 @@ namespace wtl {
                 return detachBack();
             } else {
                 DLLNode* tempPtr = m_Head;
-                for (int i = 0; i < index - 1; i++) {
+                for (std::size_t i = 0; i < index - 1; i++) {
                     tempPtr = tempPtr->m_Next;
                 }
                 removeMiddle(ptrTo(index));
@@ -691,15 +700,28 @@ namespace wtl {
         }
 
         /**
-         * Removes all elements in O(n). Size returns to 0.
+         * Removes all elements. Size returns to 0.
+         * If the nodes come from a NodePool, their memory is reclaimed all at once, and nodes are only visited if
+         * the elements have destructors to run.
          */
         void clear() noexcept {
-            DLLNode* tempPtr = m_Head;
-            DLLNode* nextPtr = nullptr;
-            while (tempPtr != nullptr) {
-                nextPtr = tempPtr->m_Next;
-                delete tempPtr;
-                tempPtr = nextPtr;
+            if constexpr (NodeAllocator<DLLNode>::SUPPORTS_RELEASE) {
+                if constexpr (!std::is_trivially_destructible_v<T>) {
+                    DLLNode* tempPtr = m_Head;
+                    while (tempPtr != nullptr) {
+                        DLLNode* nextPtr = tempPtr->m_Next;
+                        tempPtr->~DLLNode();
+                        tempPtr = nextPtr;
+                    }
+                }
+                m_Nodes.release();
+            } else {
+                DLLNode* tempPtr = m_Head;
+                while (tempPtr != nullptr) {
+                    DLLNode* nextPtr = tempPtr->m_Next;
+                    m_Nodes.destroy(tempPtr);
+                    tempPtr = nextPtr;
+                }
             }
             m_Size = 0;
             m_Head = nullptr;
@@ -46,7 +46,9 @@ namespace wtl {
         void construct() {
             for (std::size_t i = 0; i < m_Vector.size(); i++) {
                 std::size_t index = i + getFirstBit(i + 1);
-                m_Vector[index] += m_Vector[i];
+                if (index < m_Vector.size()) {
+                    m_Vector[index] += m_Vector[i];
+                }
             }
         }
 
@@ -82,7 +84,17 @@ namespace wtl {
             if (outOfBounds(index)) {
                 throw std::invalid_argument("Index out of range");
             }
-            return query(index, index);
+            // Cell index covers (index + 1 - getFirstBit(index + 1), index + 1], so subtract the cells that cover
+            // the part of it before index, which are reached by walking down from index.
+            index++;
+            T value = m_Vector[index - 1];
+            std::size_t stop = index - getFirstBit(index);
+            index--;
+            while (index != stop) {
+                value -= m_Vector[index - 1];
+                index -= getFirstBit(index);
+            }
+            return value;
         }
 
         /// Query the fenwick tree from index startIndex (inclusive) to index zero (inclusive).
@@ -145,13 +157,71 @@ namespace wtl {
             if (outOfBounds(index)) {
                 throw std::invalid_argument("Index out of range");
             }
-            T originalVal = retrieve(index);
-            index++;
-            while (index <= m_Vector.size()) {
-                m_Vector[index - 1] -= originalVal;
-                m_Vector[index - 1] += value;
-                index += getFirstBit(index);
+            update(index, value - retrieve(index));
+        }
+
+        /**
+         * Apply a range of (index, delta) pairs, changing the value of each index position by its delta. If there are
+         * enough deltas, they are gathered into an array and pushed up the tree in one O(n) pass, instead of walking
+         * up the tree once per delta. If an index is out of range, no change is made.
+         * @tparam Iterator Iterator over std::pair<std::size_t, T>, or similar
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void batchUpdate(Iterator first, Iterator last) {
+            std::size_t count = 0;
+            for (Iterator it = first; it != last; ++it, count++) {
+                if (outOfBounds(it->first)) {
+                    throw std::invalid_argument("Index out of range");
+                }
+            }
+            std::size_t size = m_Vector.size();
+            std::size_t depth = 1;
+            while ((std::size_t(1) << depth) < size) {
+                depth++;
+            }
+            if (count * depth < size) {
+                for (; first != last; ++first) {
+                    update(first->first, first->second);
+                }
+                return;
+            }
+            std::vector<T> deltas(size, T());
+            for (; first != last; ++first) {
+                deltas[first->first] += first->second;
+            }
+            for (std::size_t i = 0; i < size; i++) {
+                m_Vector[i] += deltas[i];
+                std::size_t parent = i + getFirstBit(i + 1);
+                if (parent < size) {
+                    deltas[parent] += deltas[i];
+                }
+            }
+        }
+
+        /**
+         * Find the first index position whose prefix sum, from index zero, is at least a value, by descending the
+         * tree from its highest power of two in O(logn) time. All the elements must be non-negative, such as the
+         * weights used for weighted sampling or the counts used for k-th element queries.
+         * @param prefixSum
+         * @return Index position, or the number of elements if the total sum is smaller than prefixSum
+         */
+        [[nodiscard]] std::size_t lowerBound(T prefixSum) const noexcept {
+            std::size_t size = m_Vector.size();
+            std::size_t step = 1;
+            while ((step << 1) <= size) {
+                step <<= 1;
+            }
+            std::size_t position = 0;
+            for (; step > 0; step >>= 1) {
+                std::size_t next = position + step;
+                if (next <= size && m_Vector[next - 1] < prefixSum) {
+                    position = next;
+                    prefixSum -= m_Vector[next - 1];
+                }
             }
+            return position;
         }
 
         /**
@@ -0,0 +1,218 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace wtl {
+
+    /**
+     * A two-dimensional fenwick tree over a grid, such as a grid of counters. Updating a cell and querying the sum of
+     * a rectangle both take O(logm * logn) time complexity.
+     * The grid is stored row by row in a single vector, and is indexed [0, rows - 1] x [0, columns - 1].
+     * @tparam T Numeric data type
+     */
+    template<typename T>
+    class FenwickTree2D {
+    private:
+
+        /// Number of rows
+        std::size_t m_Rows;
+
+        /// Number of columns
+        std::size_t m_Columns;
+
+        /// Underlying vector data structure, row by row
+        std::vector<T> m_Vector;
+
+        [[nodiscard]] bool outOfBounds(std::size_t row, std::size_t column) const noexcept {
+            return row >= m_Rows || column >= m_Columns;
+        }
+
+        [[nodiscard]] static std::size_t getFirstBit(std::size_t val) noexcept {
+            return val & (~val + 1);
+        }
+
+        [[nodiscard]] T& cell(std::size_t row, std::size_t column) noexcept {
+            return m_Vector[row * m_Columns + column];
+        }
+
+        /**
+         * Sum of the rectangle from (0, 0) to (row, column), inclusive, which must be valid.
+         * @param row
+         * @param column
+         * @return
+         */
+        [[nodiscard]] T prefixSum(std::size_t row, std::size_t column) const noexcept {
+            T sum = 0;
+            for (std::size_t i = row + 1; i > 0; i -= getFirstBit(i)) {
+                const T* cells = m_Vector.data() + (i - 1) * m_Columns;
+                for (std::size_t j = column + 1; j > 0; j -= getFirstBit(j)) {
+                    sum += cells[j - 1];
+                }
+            }
+            return sum;
+        }
+
+        /**
+         * Construct the fenwick tree from the original grid in O(mn) time, by constructing every row and then every
+         * column as a one-dimensional fenwick tree.
+         */
+        void construct() {
+            for (std::size_t row = 0; row < m_Rows; row++) {
+                for (std::size_t column = 0; column < m_Columns; column++) {
+                    std::size_t parent = column + getFirstBit(column + 1);
+                    if (parent < m_Columns) {
+                        cell(row, parent) += cell(row, column);
+                    }
+                }
+            }
+            for (std::size_t row = 0; row < m_Rows; row++) {
+                std::size_t parent = row + getFirstBit(row + 1);
+                if (parent < m_Rows) {
+                    for (std::size_t column = 0; column < m_Columns; column++) {
+                        cell(parent, column) += cell(row, column);
+                    }
+                }
+            }
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * Construct a grid of zeroes.
+         * @param rows
+         * @param columns
+         */
+        FenwickTree2D(std::size_t rows, std::size_t columns)
+                : m_Rows(rows), m_Columns(columns), m_Vector(rows * columns, T()) {
+            static_assert(std::is_arithmetic_v<T>, "Fenwick Tree only supports arithmetic types");
+        }
+
+        /**
+         * Constructor
+         * Construct the tree from a grid given as a vector of rows, which must all have the same length.
+         * @param grid
+         */
+        explicit FenwickTree2D(const std::vector<std::vector<T>>& grid)
+                : FenwickTree2D(grid.size(), grid.empty() ? 0 : grid.front().size()) {
+            for (std::size_t row = 0; row < m_Rows; row++) {
+                if (grid[row].size() != m_Columns) {
+                    throw std::invalid_argument("Rows of the grid have different lengths");
+                }
+                for (std::size_t column = 0; column < m_Columns; column++) {
+                    cell(row, column) = grid[row][column];
+                }
+            }
+            construct();
+        }
+
+        /**
+         * Number of rows in the grid.
+         * @return
+         */
+        [[nodiscard]] std::size_t getRows() const noexcept {
+            return m_Rows;
+        }
+
+        /**
+         * Number of columns in the grid.
+         * @return
+         */
+        [[nodiscard]] std::size_t getColumns() const noexcept {
+            return m_Columns;
+        }
+
+        /**
+         * Retrieve the value of a single cell of the grid.
+         * @param row
+         * @param column
+         * @return
+         */
+        [[nodiscard]] T retrieve(std::size_t row, std::size_t column) const {
+            return query(row, column, row, column);
+        }
+
+        /**
+         * Query the sum of the rectangle from (0, 0) to (row, column), inclusive.
+         * @param row
+         * @param column
+         * @return
+         */
+        [[nodiscard]] T query(std::size_t row, std::size_t column) const {
+            if (outOfBounds(row, column)) {
+                throw std::invalid_argument("Index out of range");
+            }
+            return prefixSum(row, column);
+        }
+
+        /**
+         * Query the sum of the rectangle from (startRow, startColumn) to (endRow, endColumn), inclusive.
+         * The start cannot be after the end in either dimension.
+         * @param startRow
+         * @param startColumn
+         * @param endRow
+         * @param endColumn
+         * @return
+         */
+        [[nodiscard]] T query(std::size_t startRow, std::size_t startColumn, std::size_t endRow,
+                              std::size_t endColumn) const {
+            if (outOfBounds(startRow, startColumn) || outOfBounds(endRow, endColumn) || startRow > endRow ||
+                startColumn > endColumn) {
+                throw std::invalid_argument("Index out of range");
+            }
+            T sum = prefixSum(endRow, endColumn);
+            if (startRow > 0) {
+                sum -= prefixSum(startRow - 1, endColumn);
+            }
+            if (startColumn > 0) {
+                sum -= prefixSum(endRow, startColumn - 1);
+            }
+            if (startRow > 0 && startColumn > 0) {
+                sum += prefixSum(startRow - 1, startColumn - 1);
+            }
+            return sum;
+        }
+
+        /**
+         * Change the value of a cell of the grid by an amount.
+         * @param row
+         * @param column
+         * @param value
+         */
+        void update(std::size_t row, std::size_t column, T value) {
+            if (outOfBounds(row, column)) {
+                throw std::invalid_argument("Index out of range");
+            }
+            for (std::size_t i = row + 1; i <= m_Rows; i += getFirstBit(i)) {
+                T* cells = m_Vector.data() + (i - 1) * m_Columns;
+                for (std::size_t j = column + 1; j <= m_Columns; j += getFirstBit(j)) {
+                    cells[j - 1] += value;
+                }
+            }
+        }
+
+        /**
+         * Replace the value of a cell of the grid.
+         * @param row
+         * @param column
+         * @param value
+         */
+        void replace(std::size_t row, std::size_t column, T value) {
+            update(row, column, value - retrieve(row, column));
+        }
+
+        /**
+         * Destructor
+         */
+        ~FenwickTree2D() = default;
+
+    };
+
+}
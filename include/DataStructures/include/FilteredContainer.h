@@ -0,0 +1,220 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace wtl {
+
+    /**
+     * Puts a filter, such as a BloomFilter or a CuckooFilter, in front of a hash container such as an UnorderedSet
+     * or an UnorderedMap. Every key inserted into the container is also inserted into the filter, and lookups ask
+     * the filter first. If the filter says a key was never inserted, the container is not touched at all, so
+     * lookups that miss cost one filter probe instead of a walk through a bucket.
+     * Keys erased from the container are also erased from the filter if the filter supports it. Otherwise, the
+     * filter keeps them, which only raises its false positive rate.
+     * If the filter runs out of space, it is bypassed from then on and every lookup goes to the container.
+     * @tparam Container UnorderedSet, UnorderedMap or any container with the same interface
+     * @tparam Filter BloomFilter, CuckooFilter or any filter with the same interface
+     */
+    template<typename Container, typename Filter>
+    class FilteredContainer {
+    private:
+
+        typedef typename Filter::KeyType K;
+
+        /// Container holding the elements
+        Container m_Container;
+
+        /// Filter holding every key of the container
+        Filter m_Filter;
+
+        /// Whether the filter could not take a key, so that it may give false negatives
+        bool m_FilterBypassed = false;
+
+        /**
+         * Check the filter for a key.
+         * @param key
+         * @return False if the key is definitely not in the container
+         */
+        [[nodiscard]] bool mayContain(const K& key) const noexcept {
+            return m_FilterBypassed || m_Filter.mayContain(key);
+        }
+
+        /**
+         * Record a key in the filter after it was inserted into the container.
+         * @param key
+         */
+        void addToFilter(const K& key) noexcept {
+            if (!m_FilterBypassed && !m_Filter.insert(key)) {
+                m_FilterBypassed = true;
+            }
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param filter Empty filter sized for the expected number of keys
+         */
+        explicit FilteredContainer(Filter filter) : m_Filter(std::move(filter)) {}
+
+        /**
+         * Get the underlying container. It is only available as const, since inserting into it directly would
+         * bypass the filter.
+         * @return
+         */
+        [[nodiscard]] const Container& getContainer() const noexcept {
+            return m_Container;
+        }
+
+        /**
+         * Get the filter.
+         * @return
+         */
+        [[nodiscard]] const Filter& getFilter() const noexcept {
+            return m_Filter;
+        }
+
+        /**
+         * Check if the filter has been bypassed because it ran out of space.
+         * @return
+         */
+        [[nodiscard]] bool isFilterBypassed() const noexcept {
+            return m_FilterBypassed;
+        }
+
+        /**
+         * Get the number of elements
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Container.getSize();
+        }
+
+        /**
+         * Check if container is empty
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return m_Container.empty();
+        }
+
+        /**
+         * Check if a key exists in the container.
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        [[nodiscard]] bool contains(const K& key) const noexcept {
+            return mayContain(key) && m_Container.contains(key);
+        }
+
+        /**
+         * Look up a value in a map, as UnorderedMap::at(...).
+         * @tparam C Only there so that the method is not instantiated for sets
+         * @param key
+         * @return
+         */
+        template<typename C = Container>
+        [[nodiscard]] auto at(const K& key) noexcept -> decltype(std::declval<C&>().at(key)) {
+            if (!mayContain(key)) {
+                return std::nullopt;
+            }
+            return m_Container.at(key);
+        }
+
+        /**
+         * Look up an element in a set, as UnorderedSet::find(...).
+         * @tparam C Only there so that the method is not instantiated for maps
+         * @param key
+         * @return
+         */
+        template<typename C = Container>
+        [[nodiscard]] auto find(const K& key) const noexcept -> decltype(std::declval<const C&>().find(key)) {
+            if (!mayContain(key)) {
+                return std::nullopt;
+            }
+            return m_Container.find(key);
+        }
+
+        /**
+         * Insert into the container, as its insert(...). The key is added to the filter if it was inserted.
+         * @tparam Ts
+         * @param key
+         * @param args Value to insert, for a map
+         * @return Result of the insert(...) of the container
+         */
+        template<typename ... Ts>
+        auto insert(const K& key, Ts&& ... args) {
+            auto result = m_Container.insert(key, std::forward<Ts>(args)...);
+            if (result.second) {
+                addToFilter(key);
+            }
+            return result;
+        }
+
+        /**
+         * Insert into the container, as its insertOrReplace(...). The key is added to the filter if it was inserted.
+         * @tparam Ts
+         * @param key
+         * @param args Value to insert
+         * @return Result of the insertOrReplace(...) of the container
+         */
+        template<typename ... Ts>
+        auto insertOrReplace(const K& key, Ts&& ... args) {
+            auto result = m_Container.insertOrReplace(key, std::forward<Ts>(args)...);
+            if (result.second) {
+                addToFilter(key);
+            }
+            return result;
+        }
+
+        /**
+         * Construct in the container, as its emplace(...). The key is added to the filter if it was inserted.
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return Result of the emplace(...) of the container
+         */
+        template<typename ... Ts>
+        auto emplace(const K& key, Ts&& ... args) {
+            auto result = m_Container.emplace(key, std::forward<Ts>(args)...);
+            if (result.second) {
+                addToFilter(key);
+            }
+            return result;
+        }
+
+        /**
+         * Erase a key. Keys the filter rules out are not looked up in the container.
+         * @param key
+         * @return True if key was found and removed, false if not.
+         */
+        bool erase(const K& key) noexcept {
+            if (!mayContain(key) || !m_Container.erase(key)) {
+                return false;
+            }
+            if constexpr (Filter::SUPPORTS_ERASE) {
+                if (!m_FilterBypassed) {
+                    m_Filter.erase(key);
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Remove all elements, and all keys of the filter.
+         */
+        void clear() noexcept {
+            m_Container.clear();
+            m_Filter.clear();
+            m_FilterBypassed = false;
+        }
+
+    };
+
+}
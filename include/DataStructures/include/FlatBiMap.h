@@ -0,0 +1,578 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "impl/DataStructuresImpl.h"
+#include "BiMap.h"
+
+namespace wtl {
+
+    namespace impl {
+
+        /**
+         * Hash index of a FlatBiMap, mapping the hash of one side of each pair to the slot number of the pair.
+         * Uses open addressing with Robin Hood linear probing and backward shift deletion. Each entry keeps 32 bits
+         * of the hash, which both locate the home bucket of the entry and rule out most non-matching entries without
+         * touching the pairs.
+         */
+        class FlatBiMapIndex {
+        public:
+
+            static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+            struct Entry {
+
+                /// 32 bits of the hash, whose lower bits give the home bucket
+                std::uint32_t m_Hash = 0;
+
+                /// Slot number of the pair plus 1, or 0 if the bucket is empty
+                std::uint32_t m_Slot = 0;
+            };
+
+        private:
+
+            std::vector<Entry> m_Entries;
+
+            std::size_t m_Mask = 0;
+
+            [[nodiscard]] std::size_t distanceOf(std::size_t index) const noexcept {
+                return (index - (m_Entries[index].m_Hash & m_Mask)) & m_Mask;
+            }
+
+        public:
+
+            /**
+             * Constructor
+             * @param bucketCount Must be a power of 2
+             */
+            explicit FlatBiMapIndex(std::size_t bucketCount) : m_Entries(bucketCount), m_Mask(bucketCount - 1) {}
+
+            [[nodiscard]] std::size_t getBucketCount() const noexcept {
+                return m_Entries.size();
+            }
+
+            /**
+             * Find the entry with the hash whose slot satisfies a predicate.
+             * @tparam Predicate
+             * @param hash
+             * @param predicate Takes the slot number of a candidate pair
+             * @return Index of the entry, or NOT_FOUND
+             */
+            template<typename Predicate>
+            [[nodiscard]] std::size_t find(std::uint32_t hash, Predicate&& predicate) const {
+                std::size_t index = hash & m_Mask;
+                for (std::size_t distance = 0;; distance++) {
+                    const Entry& entry = m_Entries[index];
+                    // An entry closer to its home bucket means that the hash would have been placed before it
+                    if (entry.m_Slot == 0 || distanceOf(index) < distance) {
+                        return NOT_FOUND;
+                    }
+                    if (entry.m_Hash == hash && predicate(entry.m_Slot - 1)) {
+                        return index;
+                    }
+                    index = (index + 1) & m_Mask;
+                }
+            }
+
+            /**
+             * Find the entry pointing at a slot.
+             * @param hash
+             * @param slot
+             * @return Index of the entry
+             */
+            [[nodiscard]] std::size_t findSlot(std::uint32_t hash, std::size_t slot) const noexcept {
+                return find(hash, [slot](std::size_t candidate) {
+                    return candidate == slot;
+                });
+            }
+
+            [[nodiscard]] std::size_t slotAt(std::size_t index) const noexcept {
+                return m_Entries[index].m_Slot - 1;
+            }
+
+            void setSlot(std::size_t index, std::size_t slot) noexcept {
+                m_Entries[index].m_Slot = static_cast<std::uint32_t>(slot + 1);
+            }
+
+            /**
+             * Add an entry, displacing entries that are closer to their home bucket. There must be an empty bucket.
+             * @param hash
+             * @param slot
+             */
+            void insert(std::uint32_t hash, std::size_t slot) noexcept {
+                Entry entry{hash, static_cast<std::uint32_t>(slot + 1)};
+                std::size_t index = hash & m_Mask;
+                for (std::size_t distance = 0;; distance++) {
+                    if (m_Entries[index].m_Slot == 0) {
+                        m_Entries[index] = entry;
+                        return;
+                    }
+                    std::size_t existingDistance = distanceOf(index);
+                    if (existingDistance < distance) {
+                        std::swap(entry, m_Entries[index]);
+                        distance = existingDistance;
+                    }
+                    index = (index + 1) & m_Mask;
+                }
+            }
+
+            /**
+             * Remove an entry, shifting the following entries one bucket backwards until an empty bucket or an entry
+             * in its home bucket is reached.
+             * @param index
+             */
+            void eraseAt(std::size_t index) noexcept {
+                std::size_t next = (index + 1) & m_Mask;
+                while (m_Entries[next].m_Slot != 0 && distanceOf(next) != 0) {
+                    m_Entries[index] = m_Entries[next];
+                    index = next;
+                    next = (next + 1) & m_Mask;
+                }
+                m_Entries[index] = Entry();
+            }
+
+            /**
+             * Move every entry into a new table with the specified number of buckets, without rehashing any pair.
+             * @param bucketCount Must be a power of 2
+             */
+            void rehash(std::size_t bucketCount) {
+                std::vector<Entry> oldEntries(bucketCount);
+                oldEntries.swap(m_Entries);
+                m_Mask = bucketCount - 1;
+                for (const Entry& entry : oldEntries) {
+                    if (entry.m_Slot != 0) {
+                        insert(entry.m_Hash, entry.m_Slot - 1);
+                    }
+                }
+            }
+
+            void clear() noexcept {
+                std::fill(m_Entries.begin(), m_Entries.end(), Entry());
+            }
+
+        };
+
+    }
+
+    /**
+     * A bidirectional map like BiMap, backed by hash tables instead of two std::maps. The pairs are stored
+     * contiguously in insertion order, except that erasing a pair moves the last pair into its place. Two hash
+     * indexes, one per side, map to the slot number of each pair. Lookups in both directions take O(1) expected
+     * time, and inserting a pair allocates nothing except when the pairs or indexes grow.
+     * Both indexes have the same number of buckets, which is a power of 2 and grows when the load factor would
+     * exceed 7/8. Slot numbers and hashes are kept in 32 bits, so that an index entry takes 8 bytes, which limits
+     * the map to 7/8 of 2^32 pairs.
+     * Elements of type A and B are both immutable after they have been inserted. References returned by find are
+     * invalidated by any insertion or removal.
+     * @tparam A
+     * @tparam B
+     * @tparam Hash_A
+     * @tparam Hash_B
+     */
+    template<typename A, typename B, typename Hash_A = std::hash<A>, typename Hash_B = std::hash<B>>
+    class FlatBiMap {
+    private:
+
+        using ReferenceA = std::reference_wrapper<const A>;
+        using ReferenceB = std::reference_wrapper<const B>;
+        using Index = impl::FlatBiMapIndex;
+        using Pair = std::pair<A, B>;
+
+        static constexpr std::size_t MINIMUM_BUCKET_COUNT = 8;
+        static constexpr std::size_t MAXIMUM_SIZE =
+                (static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max()) + 1) / 8 * 7;
+        static constexpr std::size_t NOT_FOUND = Index::NOT_FOUND;
+
+        /// Pairs, stored contiguously
+        std::vector<Pair> m_Pairs;
+
+        /// Index from the hash of A to the slot of the pair
+        Index m_LeftIndex;
+
+        /// Index from the hash of B to the slot of the pair
+        Index m_RightIndex;
+
+        Hash_A m_HashA;
+
+        Hash_B m_HashB;
+
+        [[nodiscard]] static bool overloaded(std::size_t size, std::size_t bucketCount) noexcept {
+            return size * 8 > bucketCount * 7;
+        }
+
+        [[nodiscard]] static std::size_t bucketCountFor(std::size_t size) noexcept {
+            std::size_t bucketCount = MINIMUM_BUCKET_COUNT;
+            while (overloaded(size, bucketCount)) {
+                bucketCount *= 2;
+            }
+            return bucketCount;
+        }
+
+        template<typename Q>
+        [[nodiscard]] std::uint32_t hashA(const Q& a) const noexcept {
+            return static_cast<std::uint32_t>(impl::ds::mixHash(m_HashA(a)));
+        }
+
+        template<typename Q>
+        [[nodiscard]] std::uint32_t hashB(const Q& b) const noexcept {
+            return static_cast<std::uint32_t>(impl::ds::mixHash(m_HashB(b)));
+        }
+
+        /**
+         * Find the slot of the pair with an element of type A equal to a.
+         * @tparam Q
+         * @param a
+         * @return
+         */
+        template<typename Q>
+        [[nodiscard]] std::size_t findLeft(const Q& a) const {
+            std::size_t index = m_LeftIndex.find(hashA(a), [this, &a](std::size_t slot) {
+                return m_Pairs[slot].first == a;
+            });
+            return index == NOT_FOUND ? NOT_FOUND : m_LeftIndex.slotAt(index);
+        }
+
+        /**
+         * Find the slot of the pair with an element of type B equal to b.
+         * @tparam Q
+         * @param b
+         * @return
+         */
+        template<typename Q>
+        [[nodiscard]] std::size_t findRight(const Q& b) const {
+            std::size_t index = m_RightIndex.find(hashB(b), [this, &b](std::size_t slot) {
+                return m_Pairs[slot].second == b;
+            });
+            return index == NOT_FOUND ? NOT_FOUND : m_RightIndex.slotAt(index);
+        }
+
+        void rehash(std::size_t bucketCount) {
+            m_LeftIndex.rehash(bucketCount);
+            m_RightIndex.rehash(bucketCount);
+        }
+
+        template<typename TA, typename TB>
+        bool insertPair(TA&& a, TB&& b) {
+            std::uint32_t leftHash = hashA(a);
+            std::uint32_t rightHash = hashB(b);
+            if (findLeft(a) != NOT_FOUND || findRight(b) != NOT_FOUND) {
+                return false;
+            }
+            if (m_Pairs.size() == MAXIMUM_SIZE) {
+                throw std::length_error("FlatBiMap is full");
+            }
+            if (overloaded(m_Pairs.size() + 1, m_LeftIndex.getBucketCount())) {
+                rehash(m_LeftIndex.getBucketCount() * 2);
+            }
+            std::size_t slot = m_Pairs.size();
+            m_Pairs.emplace_back(std::forward<TA>(a), std::forward<TB>(b));
+            m_LeftIndex.insert(leftHash, slot);
+            m_RightIndex.insert(rightHash, slot);
+            return true;
+        }
+
+        /**
+         * Remove the pair in a slot, moving the last pair into its place.
+         * @param slot
+         */
+        void eraseSlot(std::size_t slot) {
+            m_LeftIndex.eraseAt(m_LeftIndex.findSlot(hashA(m_Pairs[slot].first), slot));
+            m_RightIndex.eraseAt(m_RightIndex.findSlot(hashB(m_Pairs[slot].second), slot));
+            std::size_t last = m_Pairs.size() - 1;
+            if (slot != last) {
+                Pair& moved = m_Pairs[last];
+                m_LeftIndex.setSlot(m_LeftIndex.findSlot(hashA(moved.first), last), slot);
+                m_RightIndex.setSlot(m_RightIndex.findSlot(hashB(moved.second), last), slot);
+                m_Pairs[slot] = std::move(moved);
+            }
+            m_Pairs.pop_back();
+        }
+
+    public:
+
+        typedef typename std::vector<Pair>::const_iterator ConstIterator;
+
+        /**
+         * Default constructor
+         */
+        FlatBiMap() : m_LeftIndex(MINIMUM_BUCKET_COUNT), m_RightIndex(MINIMUM_BUCKET_COUNT) {}
+
+        /**
+         * Get the number of elements
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Pairs.size();
+        }
+
+        /**
+         * Check if container is empty
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return m_Pairs.empty();
+        }
+
+        /**
+         * Get the number of buckets of each index
+         * @return
+         */
+        [[nodiscard]] std::size_t getBucketCount() const noexcept {
+            return m_LeftIndex.getBucketCount();
+        }
+
+        /**
+         * Get the number of bytes allocated for the pairs and both indexes. Memory owned by the elements themselves,
+         * such as the characters of long strings, is not included.
+         * @return
+         */
+        [[nodiscard]] std::size_t getMemoryUsage() const noexcept {
+            return m_Pairs.capacity() * sizeof(Pair) + 2 * getBucketCount() * sizeof(Index::Entry);
+        }
+
+        /**
+         * Get the number of bytes allocated per pair stored, as reported by getMemoryUsage().
+         * @return
+         */
+        [[nodiscard]] double getMemoryPerEntry() const noexcept {
+            return m_Pairs.empty() ? 0.0 : static_cast<double>(getMemoryUsage()) / static_cast<double>(m_Pairs.size());
+        }
+
+        /**
+         * Iterate through the pairs, in insertion order until a pair is erased.
+         * @return
+         */
+        [[nodiscard]] ConstIterator begin() const noexcept {
+            return m_Pairs.begin();
+        }
+
+        [[nodiscard]] ConstIterator end() const noexcept {
+            return m_Pairs.end();
+        }
+
+        /**
+         * Insert A and B into Bimap. If either element a or b already exists in the BiMap, then no insertion happens.
+         * @param a
+         * @param b
+         * @return True if insertion occurred, false if duplicate was found
+         */
+        bool insert(const A& a, const B& b) {
+            return insertPair(a, b);
+        }
+
+        /**
+         * Insert A and B into Bimap. If either element a or b already exists in the BiMap, then no insertion happens.
+         * @param a
+         * @param b
+         * @return True if insertion occurred, false if duplicate was found
+         */
+        bool insert(A&& a, B&& b) {
+            return insertPair(std::move(a), std::move(b));
+        }
+
+        /**
+         * Get A from element of type B.
+         * @param b
+         * @return
+         */
+        [[nodiscard]] std::optional<ReferenceA> find(const B& b, BiMap_Right_Tag = bimap_right_tag) const {
+            std::size_t slot = findRight(b);
+            if (slot == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Pairs[slot].first;
+        }
+
+        /**
+         * Get B from element of type A
+         * @param a
+         * @return
+         */
+        [[nodiscard]] std::optional<ReferenceB> find(const A& a, BiMap_Left_Tag = bimap_left_tag) const {
+            std::size_t slot = findLeft(a);
+            if (slot == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Pairs[slot].second;
+        }
+
+        /**
+         * Heterogeneous lookup of B from a value comparable with A, only available if Hash_A declares is_transparent
+         * (such as StringHash). The tag is required, so that the call is never ambiguous.
+         * @tparam Q
+         * @param a
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash_A, A, Q>>
+        [[nodiscard]] std::optional<ReferenceB> find(const Q& a, BiMap_Left_Tag) const {
+            std::size_t slot = findLeft(a);
+            if (slot == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Pairs[slot].second;
+        }
+
+        /**
+         * Heterogeneous lookup of A from a value comparable with B, only available if Hash_B declares is_transparent.
+         * @tparam Q
+         * @param b
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash_B, B, Q>>
+        [[nodiscard]] std::optional<ReferenceA> find(const Q& b, BiMap_Right_Tag) const {
+            std::size_t slot = findRight(b);
+            if (slot == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Pairs[slot].first;
+        }
+
+        /**
+         * Check if element of type A exists.
+         * @param a
+         * @return True if it exists, false if not
+         */
+        [[nodiscard]] bool contains(const A& a, BiMap_Left_Tag = bimap_left_tag) const {
+            return findLeft(a) != NOT_FOUND;
+        }
+
+        /**
+         * Check if element of type B exists.
+         * @param b
+         * @return True if it exists, false if not
+         */
+        [[nodiscard]] bool contains(const B& b, BiMap_Right_Tag = bimap_right_tag) const {
+            return findRight(b) != NOT_FOUND;
+        }
+
+        /**
+         * Heterogeneous version of contains(...) for elements of type A.
+         * @tparam Q
+         * @param a
+         * @return True if it exists, false if not
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash_A, A, Q>>
+        [[nodiscard]] bool contains(const Q& a, BiMap_Left_Tag) const {
+            return findLeft(a) != NOT_FOUND;
+        }
+
+        /**
+         * Heterogeneous version of contains(...) for elements of type B.
+         * @tparam Q
+         * @param b
+         * @return True if it exists, false if not
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash_B, B, Q>>
+        [[nodiscard]] bool contains(const Q& b, BiMap_Right_Tag) const {
+            return findRight(b) != NOT_FOUND;
+        }
+
+        /**
+         * Erase (A,B) pair using element of type A
+         * @param a
+         * @return True if pair was removed from BiMap.
+         */
+        bool erase(const A& a, BiMap_Left_Tag = bimap_left_tag) {
+            std::size_t slot = findLeft(a);
+            if (slot == NOT_FOUND) {
+                return false;
+            }
+            eraseSlot(slot);
+            return true;
+        }
+
+        /**
+         * Erase (A,B) pair using element of type B
+         * @param b
+         * @return True if pair was removed from BiMap.
+         */
+        bool erase(const B& b, BiMap_Right_Tag = bimap_right_tag) {
+            std::size_t slot = findRight(b);
+            if (slot == NOT_FOUND) {
+                return false;
+            }
+            eraseSlot(slot);
+            return true;
+        }
+
+        /**
+         * Heterogeneous version of erase(...) for elements of type A.
+         * @tparam Q
+         * @param a
+         * @return True if pair was removed from BiMap.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash_A, A, Q>>
+        bool erase(const Q& a, BiMap_Left_Tag) {
+            std::size_t slot = findLeft(a);
+            if (slot == NOT_FOUND) {
+                return false;
+            }
+            eraseSlot(slot);
+            return true;
+        }
+
+        /**
+         * Heterogeneous version of erase(...) for elements of type B.
+         * @tparam Q
+         * @param b
+         * @return True if pair was removed from BiMap.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash_B, B, Q>>
+        bool erase(const Q& b, BiMap_Right_Tag) {
+            std::size_t slot = findRight(b);
+            if (slot == NOT_FOUND) {
+                return false;
+            }
+            eraseSlot(slot);
+            return true;
+        }
+
+        /**
+         * Make sure that the specified number of pairs can be stored without reallocating the pairs or rehashing.
+         * @param size
+         */
+        void reserve(std::size_t size) {
+            m_Pairs.reserve(size);
+            std::size_t bucketCount = bucketCountFor(size);
+            if (bucketCount > getBucketCount()) {
+                rehash(bucketCount);
+            }
+        }
+
+        /**
+         * Shrink the pairs and indexes to fit the current number of pairs.
+         * @return True if the indexes were rehashed, false if not
+         */
+        bool shrinkToFit() {
+            m_Pairs.shrink_to_fit();
+            std::size_t bucketCount = bucketCountFor(m_Pairs.size());
+            if (bucketCount < getBucketCount()) {
+                rehash(bucketCount);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Clear the BiMap. The memory of the pairs and indexes is kept.
+         */
+        void clear() noexcept {
+            m_Pairs.clear();
+            m_LeftIndex.clear();
+            m_RightIndex.clear();
+        }
+
+    };
+
+}
@@ -0,0 +1,651 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "impl/DataStructuresImpl.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WTL_FLATMAP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace wtl {
+
+    namespace impl {
+
+        /**
+         * Values of a control byte. A full slot stores the lower 7 bits of its hash, so the control byte of a full
+         * slot is never negative, while empty and deleted slots always have their sign bit set.
+         */
+        enum FlatMapControl : std::int8_t {
+            FLATMAP_EMPTY = -128, FLATMAP_DELETED = -2
+        };
+
+        /**
+         * Slot in a FlatMap. Key and value are kept together so that a successful lookup touches one cache line
+         * after the control bytes.
+         * @tparam K
+         * @tparam V
+         */
+        template<typename K, typename V>
+        struct FlatMapSlot {
+
+            K m_Key;
+
+            V m_Value;
+        };
+
+        /**
+         * Index of the lowest set bit. Mask must not be 0.
+         * @param mask
+         * @return
+         */
+        inline std::size_t lowestSetBit(std::uint32_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+            std::size_t index = 0;
+            while ((mask & 1u) == 0) {
+                mask >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        /**
+         * A group of 16 consecutive control bytes which are matched against in one go.
+         * With SSE2 (and therefore also AVX2 builds), the whole group is compared using a single vector compare.
+         * Otherwise a scalar loop builds the same bit mask.
+         * Bit i of a returned mask is set if the i-th control byte of the group matches.
+         */
+        class FlatMapGroup {
+        public:
+
+            static constexpr std::size_t WIDTH = 16;
+
+        private:
+
+#ifdef WTL_FLATMAP_SSE2
+            __m128i m_Control;
+#else
+            const std::int8_t* m_Control;
+#endif
+
+        public:
+
+            /**
+             * Constructor
+             * @param control Pointer to the first control byte of the group
+             */
+            explicit FlatMapGroup(const std::int8_t* control) noexcept
+#ifdef WTL_FLATMAP_SSE2
+                    : m_Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+#else
+                    : m_Control(control) {}
+#endif
+
+            /**
+             * Find the slots whose control byte is equal to the specified value.
+             * @param value
+             * @return
+             */
+            [[nodiscard]] std::uint32_t match(std::int8_t value) const noexcept {
+#ifdef WTL_FLATMAP_SSE2
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), m_Control)));
+#else
+                std::uint32_t mask = 0;
+                for (std::size_t i = 0; i < WIDTH; i++) {
+                    mask |= static_cast<std::uint32_t>(m_Control[i] == value) << i;
+                }
+                return mask;
+#endif
+            }
+
+            /**
+             * Find the empty slots.
+             * @return
+             */
+            [[nodiscard]] std::uint32_t matchEmpty() const noexcept {
+                return match(FLATMAP_EMPTY);
+            }
+
+            /**
+             * Find the slots that are either empty or deleted, i.e. the control bytes with the sign bit set.
+             * @return
+             */
+            [[nodiscard]] std::uint32_t matchEmptyOrDeleted() const noexcept {
+#ifdef WTL_FLATMAP_SSE2
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(m_Control));
+#else
+                std::uint32_t mask = 0;
+                for (std::size_t i = 0; i < WIDTH; i++) {
+                    mask |= static_cast<std::uint32_t>(m_Control[i] < 0) << i;
+                }
+                return mask;
+#endif
+            }
+        };
+
+    }
+
+    /**
+     * A FlatMap is a hashmap using open addressing, where key-value pairs are stored in a contiguous array instead of
+     * individually allocated nodes. A separate array of 1 byte per slot holds 7 bits of each key's hash, which allows
+     * 16 slots to be checked at a time before any key is compared.
+     * Slots are probed in groups of 16 using quadratic probing over the groups.
+     * Supports average O(1) time insertion, searching and removing, with no allocation except when rehashing.
+     * The number of buckets is always a power of 2 and expands when the load factor would exceed 7/8.
+     * @tparam K
+     * @tparam V
+     * @tparam Hash
+     */
+    template<typename K, typename V, typename Hash = std::hash<K>>
+    class FlatMap {
+    private:
+
+        using Group = impl::FlatMapGroup;
+        using Slot = impl::FlatMapSlot<K, V>;
+        typedef std::pair<std::reference_wrapper<const K>, std::reference_wrapper<V>> KeyValuePairResult;
+
+        static constexpr std::size_t MINIMUM_BUCKET_COUNT = Group::WIDTH;
+        static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+        /// Number of elements
+        std::size_t m_Size = 0;
+
+        /// Number of buckets. Always a power of 2, and a multiple of the group width.
+        std::size_t m_BucketCount = 0;
+
+        /// Number of empty slots that can still be filled before the table has to be rehashed
+        std::size_t m_GrowthLeft = 0;
+
+        /// Control bytes, one per bucket
+        std::int8_t* m_Control = nullptr;
+
+        /// Key-value pairs, stored contiguously
+        Slot* m_Slots = nullptr;
+
+        /// Hashing algorithm
+        Hash m_Hash;
+
+        /**
+         * Maximum number of elements that can be stored in a specified number of buckets.
+         * @param bucketCount
+         * @return
+         */
+        [[nodiscard]] static constexpr std::size_t maximumLoad(std::size_t bucketCount) noexcept {
+            return bucketCount - bucketCount / 8;
+        }
+
+        /**
+         * Hash of the key, mixed so that both the group index and the 7-bit fingerprint are well distributed.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::size_t hashOf(const K& key) const noexcept {
+            return impl::ds::mixHash(m_Hash(key));
+        }
+
+        /**
+         * Lower 7 bits of the hash, stored in the control byte of a full slot.
+         * @param hash
+         * @return
+         */
+        [[nodiscard]] static std::int8_t fingerprint(std::size_t hash) noexcept {
+            return static_cast<std::int8_t>(hash & 0x7F);
+        }
+
+        /**
+         * Allocate uninitialised storage for the specified number of buckets, with every slot empty.
+         * @param bucketCount
+         */
+        void allocate(std::size_t bucketCount) {
+            m_BucketCount = bucketCount;
+            m_Control = new std::int8_t[bucketCount];
+            std::memset(m_Control, impl::FLATMAP_EMPTY, bucketCount);
+            m_Slots = (Slot*) ::operator new(bucketCount * sizeof(Slot));
+            m_GrowthLeft = maximumLoad(bucketCount) - m_Size;
+        }
+
+        /**
+         * Destroy all elements and free the storage.
+         */
+        void deallocate() noexcept {
+            for (std::size_t i = 0; i < m_BucketCount; i++) {
+                if (m_Control[i] >= 0) {
+                    m_Slots[i].~Slot();
+                }
+            }
+            delete[] m_Control;
+            ::operator delete(m_Slots, m_BucketCount * sizeof(Slot));
+            m_Control = nullptr;
+            m_Slots = nullptr;
+        }
+
+        /**
+         * Copy the elements of another FlatMap with the same number of buckets into freshly allocated storage.
+         * Each slot is marked as full once its element is constructed, so if a copy throws, the elements copied so
+         * far are destroyed and the storage is freed.
+         * @param other
+         */
+        void copyFrom(const FlatMap& other) {
+            m_Size = other.m_Size;
+            allocate(other.m_BucketCount);
+            m_GrowthLeft = other.m_GrowthLeft;
+            try {
+                for (std::size_t i = 0; i < m_BucketCount; i++) {
+                    if (other.m_Control[i] >= 0) {
+                        new(&m_Slots[i]) Slot(other.m_Slots[i]);
+                    }
+                    m_Control[i] = other.m_Control[i];
+                }
+            } catch (...) {
+                deallocate();
+                throw;
+            }
+        }
+
+        /**
+         * Find the index of the slot holding the key.
+         * @param key
+         * @param hash
+         * @return Index of the slot, or NOT_FOUND if the key does not exist
+         */
+        [[nodiscard]] std::size_t findIndex(const K& key, std::size_t hash) const noexcept {
+            std::size_t groupMask = m_BucketCount / Group::WIDTH - 1;
+            std::size_t group = (hash >> 7) & groupMask;
+            std::int8_t h2 = fingerprint(hash);
+            for (std::size_t probe = 1;; probe++) {
+                std::size_t offset = group * Group::WIDTH;
+                Group g(m_Control + offset);
+                for (std::uint32_t mask = g.match(h2); mask != 0; mask &= mask - 1) {
+                    std::size_t index = offset + impl::lowestSetBit(mask);
+                    if (m_Slots[index].m_Key == key) {
+                        return index;
+                    }
+                }
+                // A lookup never continues past a group that still has an empty slot
+                if (g.matchEmpty() != 0) {
+                    return NOT_FOUND;
+                }
+                group = (group + probe) & groupMask;
+            }
+        }
+
+        /**
+         * Find the first empty or deleted slot along the probe sequence of the hash.
+         * @param hash
+         * @return
+         */
+        [[nodiscard]] std::size_t findInsertIndex(std::size_t hash) const noexcept {
+            std::size_t groupMask = m_BucketCount / Group::WIDTH - 1;
+            std::size_t group = (hash >> 7) & groupMask;
+            for (std::size_t probe = 1;; probe++) {
+                std::size_t offset = group * Group::WIDTH;
+                std::uint32_t mask = Group(m_Control + offset).matchEmptyOrDeleted();
+                if (mask != 0) {
+                    return offset + impl::lowestSetBit(mask);
+                }
+                group = (group + probe) & groupMask;
+            }
+        }
+
+        /**
+         * Move every element into a new table with the specified number of buckets. Deleted slots are dropped.
+         * @param bucketCount
+         */
+        void rehash(std::size_t bucketCount) {
+            std::int8_t* oldControl = m_Control;
+            Slot* oldSlots = m_Slots;
+            std::size_t oldBucketCount = m_BucketCount;
+            allocate(bucketCount);
+            for (std::size_t i = 0; i < oldBucketCount; i++) {
+                if (oldControl[i] >= 0) {
+                    std::size_t hash = hashOf(oldSlots[i].m_Key);
+                    std::size_t index = findInsertIndex(hash);
+                    m_Control[index] = fingerprint(hash);
+                    new(&m_Slots[index]) Slot(std::move(oldSlots[i]));
+                    oldSlots[i].~Slot();
+                }
+            }
+            delete[] oldControl;
+            ::operator delete(oldSlots, oldBucketCount * sizeof(Slot));
+        }
+
+        /**
+         * Find a slot for a new element with the specified hash, rehashing first if the table is full. The slot is
+         * not marked as full, which is left to the caller once the element has been constructed.
+         * If at most half of the maximum load is live elements, the table is full of deleted slots, so the rehash
+         * is done in place without growing.
+         * @param hash
+         * @return Index of the slot
+         */
+        std::size_t prepareInsert(std::size_t hash) {
+            std::size_t index = findInsertIndex(hash);
+            if (m_GrowthLeft == 0 && m_Control[index] != impl::FLATMAP_DELETED) {
+                rehash(m_Size <= maximumLoad(m_BucketCount) / 2 ? m_BucketCount : m_BucketCount * 2);
+                index = findInsertIndex(hash);
+            }
+            return index;
+        }
+
+        /**
+         * Find the slot of the key, or construct the key and a new value in a free slot if the key does not exist.
+         * The slot is only marked as full once both have been constructed, so if either constructor throws, the
+         * elements of the map are left unchanged.
+         * @tparam Construct
+         * @param key
+         * @param construct Function constructing the value at the address passed to it
+         * @return Index of the slot and whether it was newly filled
+         */
+        template<typename Construct>
+        std::pair<std::size_t, bool> findOrInsert(const K& key, Construct&& construct) {
+            std::size_t hash = hashOf(key);
+            std::size_t index = findIndex(key, hash);
+            if (index != NOT_FOUND) {
+                return {index, false};
+            }
+            index = prepareInsert(hash);
+            new(&m_Slots[index].m_Key) K(key);
+            try {
+                construct(&m_Slots[index].m_Value);
+            } catch (...) {
+                m_Slots[index].m_Key.~K();
+                throw;
+            }
+            if (m_Control[index] == impl::FLATMAP_EMPTY) {
+                --m_GrowthLeft;
+            }
+            m_Control[index] = fingerprint(hash);
+            ++m_Size;
+            return {index, true};
+        }
+
+        /**
+         * Smallest number of buckets that can hold the specified number of elements.
+         * @param size
+         * @return
+         */
+        [[nodiscard]] static std::size_t bucketCountFor(std::size_t size) noexcept {
+            std::size_t bucketCount = MINIMUM_BUCKET_COUNT;
+            while (maximumLoad(bucketCount) < size) {
+                bucketCount *= 2;
+            }
+            return bucketCount;
+        }
+
+    public:
+
+        /**
+         * Constructor
+         */
+        FlatMap() {
+            allocate(MINIMUM_BUCKET_COUNT);
+        }
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        FlatMap(const FlatMap& other) {
+            copyFrom(other);
+        }
+
+        /**
+         * Copy assignment
+         * @param other
+         * @return
+         */
+        FlatMap& operator=(const FlatMap& other) {
+            if (this != &other) {
+                FlatMap copy(other);
+                std::swap(m_Size, copy.m_Size);
+                std::swap(m_BucketCount, copy.m_BucketCount);
+                std::swap(m_GrowthLeft, copy.m_GrowthLeft);
+                std::swap(m_Control, copy.m_Control);
+                std::swap(m_Slots, copy.m_Slots);
+                std::swap(m_Hash, copy.m_Hash);
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of elements
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Check if container is empty
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return m_Size == 0;
+        }
+
+        /**
+         * Get the number of buckets
+         * @return
+         */
+        [[nodiscard]] std::size_t getBucketCount() const noexcept {
+            return m_BucketCount;
+        }
+
+        /**
+         * Get the average load factor.
+         * @return
+         */
+        [[nodiscard]] double getLoadFactor() const noexcept {
+            return static_cast<double>(m_Size) / static_cast<double>(m_BucketCount);
+        }
+
+        /**
+         * Returns a reference to the value with the specified key, wrapped in a std::optional.
+         * If the key was not found, then std::nullopt is returned.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const K& key) noexcept {
+            std::size_t index = findIndex(key, hashOf(key));
+            if (index == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Slots[index].m_Value;
+        }
+
+        /**
+         * Returns a const reference to the value with the specified key, wrapped in a std::optional.
+         * If the key was not found, then std::nullopt is returned.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const K& key) const noexcept {
+            std::size_t index = findIndex(key, hashOf(key));
+            if (index == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Slots[index].m_Value;
+        }
+
+        /**
+         * Check if a key exists in the container.
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        [[nodiscard]] bool contains(const K& key) const noexcept {
+            return findIndex(key, hashOf(key)) != NOT_FOUND;
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens. The return value is a pair which consists
+         * of KeyValuePairResult and bool. The bool is true if insertion occurred, false if not.
+         * If insertion occurred, then the KeyValuePairResult is a pair with const reference to the key and reference
+         * to the inserted value.
+         * If no insertion occurred, then the KeyValuePairResult is a pair with const reference to the key and reference
+         * to the already existing element preventing the insertion.
+         * References are invalidated by any subsequent insertion.
+         * @param key
+         * @param value
+         * @return stl pair consisting of KeyValuePairResult and bool.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, const V& value) {
+            auto[index, inserted] = findOrInsert(key, [&value](V* slot) { new(slot) V(value); });
+            return {{m_Slots[index].m_Key, m_Slots[index].m_Value}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @see insert(const K&, const V&)
+         * @param key
+         * @param value
+         * @return stl pair consisting of KeyValuePairResult and bool.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, V&& value) {
+            auto[index, inserted] = findOrInsert(key, [&value](V* slot) { new(slot) V(std::move(value)); });
+            return {{m_Slots[index].m_Key, m_Slots[index].m_Value}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the existing value is replaced by the new value, else it is
+         * simply inserted as per normal.
+         * The return value is a pair of KeyValuePairResult and bool. The bool is true if insertion occurred, false if
+         * replacement occurred. The KeyValuePairResult is a pair with const reference to the key and reference
+         * to the value.
+         * @param key
+         * @param value
+         * @return
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, const V& value) {
+            auto[index, inserted] = findOrInsert(key, [&value](V* slot) { new(slot) V(value); });
+            if (!inserted) {
+                m_Slots[index].m_Value = value;
+            }
+            return {{m_Slots[index].m_Key, m_Slots[index].m_Value}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the existing value is replaced by the new value.
+         * @see insertOrReplace(const K&, const V&)
+         * @param key
+         * @param value
+         * @return
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, V&& value) {
+            auto[index, inserted] = findOrInsert(key, [&value](V* slot) { new(slot) V(std::move(value)); });
+            if (!inserted) {
+                m_Slots[index].m_Value = std::move(value);
+            }
+            return {{m_Slots[index].m_Key, m_Slots[index].m_Value}, inserted};
+        }
+
+        /**
+         * Construct a value in-place if the key does not already exist. If it does, nothing occurs. This method
+         * is similar to insert(...).
+         * @see insert(...)
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return
+         */
+        template<typename ... Ts>
+        std::pair<KeyValuePairResult, bool> emplace(const K& key, Ts&& ... args) {
+            auto[index, inserted] = findOrInsert(key, [&args...](V* slot) { new(slot) V(std::forward<Ts>(args)...); });
+            return {{m_Slots[index].m_Key, m_Slots[index].m_Value}, inserted};
+        }
+
+        /**
+         * Construct a value in-place if the key does not already exist. If it does, the value is replaced. This method
+         * is similar to insertOrReplace(...).
+         * @see insertOrReplace(...)
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return
+         */
+        template<typename ... Ts>
+        std::pair<KeyValuePairResult, bool> emplaceOrReplace(const K& key, Ts&& ... args) {
+            auto[index, inserted] = findOrInsert(key, [&args...](V* slot) { new(slot) V(std::forward<Ts>(args)...); });
+            if (!inserted) {
+                m_Slots[index].m_Value = V(std::forward<Ts>(args)...);
+            }
+            return {{m_Slots[index].m_Key, m_Slots[index].m_Value}, inserted};
+        }
+
+        /**
+         * Erase key-value pair with specified key.
+         * If the slot's group still has an empty slot, the slot is emptied, otherwise it is marked as deleted so that
+         * lookups keep probing past it.
+         * @param key
+         * @return True if key was found and key-value pair was removed, false if not.
+         */
+        bool erase(const K& key) noexcept {
+            std::size_t index = findIndex(key, hashOf(key));
+            if (index == NOT_FOUND) {
+                return false;
+            }
+            m_Slots[index].~Slot();
+            --m_Size;
+            std::size_t offset = index & ~(Group::WIDTH - 1);
+            if (Group(m_Control + offset).matchEmpty() != 0) {
+                m_Control[index] = impl::FLATMAP_EMPTY;
+                ++m_GrowthLeft;
+            } else {
+                m_Control[index] = impl::FLATMAP_DELETED;
+            }
+            return true;
+        }
+
+        /**
+         * Make sure that the specified number of elements can be stored without rehashing.
+         * @param size
+         */
+        void reserve(std::size_t size) {
+            std::size_t bucketCount = bucketCountFor(size);
+            if (bucketCount > m_BucketCount) {
+                rehash(bucketCount);
+            }
+        }
+
+        /**
+         * Shrink the container.
+         * @return True if rehashing was done, false if not
+         */
+        bool shrinkToFit() {
+            std::size_t bucketCount = bucketCountFor(m_Size);
+            if (bucketCount < m_BucketCount) {
+                rehash(bucketCount);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Remove all elements in the container. Sets size back to 0.
+         */
+        void clear() noexcept {
+            deallocate();
+            m_Size = 0;
+            allocate(MINIMUM_BUCKET_COUNT);
+        }
+
+        /**
+         * Destructor
+         */
+        ~FlatMap() {
+            deallocate();
+        }
+
+    };
+
+}
@@ -5,7 +5,9 @@
 #pragma once
 
 #include "impl/DataStructuresImpl.h"
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <utility>
 #include <stdexcept>
 #include <vector>
@@ -14,17 +16,128 @@
 
 namespace wtl {
 
+    namespace impl::heap {
+
+        /**
+         * Move a value up from a hole towards the root of a d-ary max heap, moving each smaller ancestor down into
+         * the hole instead of swapping, and place the value where it stops.
+         * @tparam Arity Number of children of each node
+         * @tparam T
+         * @tparam Comparator
+         * @param arr
+         * @param hole Index of the hole
+         * @param value
+         * @param comparator
+         */
+        template<std::size_t Arity, typename T, typename Comparator>
+        void siftUp(T* arr, std::size_t hole, T&& value, const Comparator& comparator) {
+            while (hole > 0) {
+                std::size_t parent = (hole - 1) / Arity;
+                if (!comparator(arr[parent], value)) {
+                    break;
+                }
+                arr[hole] = std::move(arr[parent]);
+                hole = parent;
+            }
+            arr[hole] = std::move(value);
+        }
+
+        /**
+         * Move a value down from a hole towards the leaves of a d-ary max heap, moving the largest child up into the
+         * hole each time, and place the value where it stops.
+         * @tparam Arity Number of children of each node
+         * @tparam T
+         * @tparam Comparator
+         * @param arr
+         * @param hole Index of the hole
+         * @param size Number of elements in the heap
+         * @param value
+         * @param comparator
+         */
+        template<std::size_t Arity, typename T, typename Comparator>
+        void siftDown(T* arr, std::size_t hole, std::size_t size, T&& value, const Comparator& comparator) {
+            while (true) {
+                std::size_t first = hole * Arity + 1;
+                if (first >= size) {
+                    break;
+                }
+                std::size_t last = std::min(first + Arity, size);
+                std::size_t largest = first;
+                for (std::size_t child = first + 1; child < last; child++) {
+                    if (comparator(arr[largest], arr[child])) {
+                        largest = child;
+                    }
+                }
+                if (!comparator(value, arr[largest])) {
+                    break;
+                }
+                arr[hole] = std::move(arr[largest]);
+                hole = largest;
+            }
+            arr[hole] = std::move(value);
+        }
+
+        /**
+         * Arrange elements into a d-ary max heap in O(n) time, using Floyd's method: every node that has children is
+         * sifted down, starting from the last one.
+         * @tparam Arity Number of children of each node
+         * @tparam T
+         * @tparam Comparator
+         * @param arr
+         * @param size
+         * @param comparator
+         */
+        template<std::size_t Arity, typename T, typename Comparator>
+        void build(T* arr, std::size_t size, const Comparator& comparator) {
+            if (size < 2) {
+                return;
+            }
+            for (std::size_t i = (size - 2) / Arity + 1; i > 0; i--) {
+                T value = std::move(arr[i - 1]);
+                siftDown<Arity>(arr, i - 1, size, std::move(value), comparator);
+            }
+        }
+
+        /**
+         * Remove the root of a d-ary max heap by moving the last element into its place. The root is left moved
+         * from at index size - 1.
+         * @tparam Arity Number of children of each node
+         * @tparam T
+         * @tparam Comparator
+         * @param arr
+         * @param size Number of elements before the removal
+         * @param comparator
+         */
+        template<std::size_t Arity, typename T, typename Comparator>
+        void popRoot(T* arr, std::size_t size, const Comparator& comparator) {
+            if (size < 2) {
+                return;
+            }
+            T value = std::move(arr[size - 1]);
+            arr[size - 1] = std::move(arr[0]);
+            siftDown<Arity>(arr, 0, size - 1, std::move(value), comparator);
+        }
+
+    }
+
     /**
-     * Complete binary heap implemented using a dynamic array as the underlying data structure.
+     * Complete d-ary heap implemented using a dynamic array as the underlying data structure.
      * By default, the comparison is done using operator<.
      * A custom binary predicate can be provided for custom ordering.
+     * Each node has Arity children, so a 4-ary or 8-ary heap is shallower than a binary heap and its children share
+     * cache lines, at the cost of more comparisons per level when removing the root.
+     * Elements are sifted by moving them into a hole, not by swapping, and building a heap from many elements at
+     * once takes O(n) time.
      * @tparam T
      * @tparam Comparator
+     * @tparam Arity Number of children of each node, at least 2
      */
-    template<typename T, typename Comparator = impl::ds::StandardComparator<T>>
+    template<typename T, typename Comparator = impl::ds::StandardComparator<T>, std::size_t Arity = 2>
     class Heap {
     private:
 
+        static_assert(Arity >= 2, "A heap node must have at least 2 children");
+
         /// Comparator object used for ordering
         impl::ds::ComparatorHelper<T, Comparator> comparator;
 
@@ -32,64 +145,17 @@ namespace wtl {
         std::vector<T> m_Arr;
 
         void constructHeap() noexcept {
-            heapify(1);
-        }
-
-        void heapify(std::size_t root) noexcept {
-            std::size_t size = m_Arr.size();
-            if (root * 2 > size) {
-                return;
-            }
-            std::size_t leftNode = 2 * root;
-            std::size_t rightNode = leftNode + 1;
-            heapify(leftNode);
-            bool hasRightChild = rightNode <= size;
-            if (hasRightChild) {
-                heapify(rightNode);
-            }
-            fixHeap(root);
+            impl::heap::build<Arity>(m_Arr.data(), m_Arr.size(), comparator);
         }
 
-        void fixHeap(std::size_t root) noexcept {
-            std::size_t size = m_Arr.size();
-            std::vector<T>& vector = m_Arr;
-            if (root * 2 > size) {
-                return;
-            }
-            // Get the index of the left and right child nodes
-            std::size_t leftNode = 2 * root;
-            std::size_t rightNode = leftNode + 1;
-            bool hasRightChild = rightNode <= size;
-            // Max Heap
-            std::size_t largerChildIndex = -1;
-
-            if (hasRightChild) {
-                // vector[leftNode - 1] >= vector[rightNode - 1]
-                largerChildIndex = comparator.dualCompare(vector[rightNode - 1], vector[leftNode - 1]) ? leftNode : rightNode;
-            } else {
-                largerChildIndex = leftNode;
-            }
-            //vector[root - 1] < vector[largerChildIndex - 1]
-            if (comparator(vector[root - 1], vector[largerChildIndex - 1])) {
-                std::swap(vector[root - 1], vector[largerChildIndex - 1]);
-                fixHeap(largerChildIndex);
-            }
-
+        void bubbleUp() noexcept {
+            T value = std::move(m_Arr.back());
+            impl::heap::siftUp<Arity>(m_Arr.data(), m_Arr.size() - 1, std::move(value), comparator);
         }
 
-        void bubbleUp(std::size_t node) noexcept {
-            std::vector<T>& vector = m_Arr;
-            std::size_t parentNode = node / 2;
-            while (parentNode >= 1) {
-                // vector[node - 1] > vector[parentNode - 1]
-                if (comparator(vector[parentNode - 1], vector[node - 1])) {
-                    std::swap(vector[parentNode - 1], vector[node - 1]);
-                } else {
-                    break;
-                }
-                node = parentNode;
-                parentNode = node / 2;
-            }
+        void removeRoot() noexcept {
+            impl::heap::popRoot<Arity>(m_Arr.data(), m_Arr.size(), comparator);
+            m_Arr.pop_back();
         }
 
     public:
@@ -115,18 +181,30 @@ namespace wtl {
             constructHeap();
         }
 
+        /**
+         * Constructor
+         * Construct heap using the elements of a range, in O(n) time.
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        Heap(Iterator first, Iterator last) : m_Arr(first, last) {
+            constructHeap();
+        }
+
         /**
          * Copy constructor
          * @param other
          */
-        Heap(const Heap<T, Comparator>& other) noexcept: m_Arr(other.m_Arr.begin(), other.m_Arr.end()) {}
+        Heap(const Heap& other) noexcept: m_Arr(other.m_Arr.begin(), other.m_Arr.end()) {}
 
         /**
          * Copy assignment
          * @param other
          * @return
          */
-        Heap<T, Comparator>& operator=(const Heap<T, Comparator>& other) noexcept {
+        Heap& operator=(const Heap& other) noexcept {
             if (this != &other) {
                 m_Arr.clear();
                 m_Arr = other.m_Arr;
@@ -138,14 +216,14 @@ namespace wtl {
          * Move constructor
          * @param other
          */
-        Heap(Heap<T, Comparator>&& other) noexcept: m_Arr(std::move(other.m_Arr)) {}
+        Heap(Heap&& other) noexcept: m_Arr(std::move(other.m_Arr)) {}
 
         /**
          * Move assignment
          * @param other
          * @return
          */
-        Heap<T, Comparator>& operator=(Heap<T, Comparator>&& other) noexcept {
+        Heap& operator=(Heap&& other) noexcept {
             if (this != &other) {
                 m_Arr.clear();
                 m_Arr = std::move(other.m_Arr);
@@ -183,7 +261,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool equals(const Heap<T, Comparator>& other) const noexcept {
+        bool equals(const Heap& other) const noexcept {
             return (*this) == other;
         }
 
@@ -193,15 +271,15 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool notEquals(const Heap<T, Comparator>& other) const noexcept {
+        bool notEquals(const Heap& other) const noexcept {
             return (*this) != other;
         }
 
-        bool operator==(const Heap<T, Comparator>& other) const noexcept {
+        bool operator==(const Heap& other) const noexcept {
             return m_Arr == other.m_Arr;
         }
 
-        bool operator!=(const Heap<T, Comparator>& other) const noexcept {
+        bool operator!=(const Heap& other) const noexcept {
             return !(m_Arr == other.m_Arr);
         }
 
@@ -254,9 +332,26 @@ namespace wtl {
             if (isEmpty()) {
                 throw std::runtime_error("Heap is empty");
             }
-            std::swap(m_Arr.front(), m_Arr.back());
-            m_Arr.pop_back();
-            fixHeap(1);
+            removeRoot();
+        }
+
+        /**
+         * Remove up to a number of elements from the root of the heap, moving them to an output iterator in order of
+         * priority.
+         * @tparam OutputIterator
+         * @param count
+         * @param out
+         * @return Number of elements removed, which is less than count if the heap runs out of elements.
+         */
+        template<typename OutputIterator>
+        std::size_t popN(std::size_t count, OutputIterator out) {
+            count = std::min(count, m_Arr.size());
+            for (std::size_t i = 0; i < count; i++) {
+                *out = std::move(m_Arr[0]);
+                ++out;
+                removeRoot();
+            }
+            return count;
         }
 
         /**
@@ -265,7 +360,7 @@ namespace wtl {
          */
         void insert(const T& element) noexcept {
             m_Arr.push_back(element);
-            bubbleUp(getSize());
+            bubbleUp();
         }
 
         /**
@@ -274,7 +369,29 @@ namespace wtl {
          */
         void insert(T&& element) noexcept {
             m_Arr.push_back(std::move(element));
-            bubbleUp(getSize());
+            bubbleUp();
+        }
+
+        /**
+         * Insert the elements of a range into the heap. If the range is at least as large as the heap, the whole
+         * heap is rebuilt in O(n) time instead of sifting up each element.
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void pushRange(Iterator first, Iterator last) {
+            std::size_t oldSize = m_Arr.size();
+            m_Arr.insert(m_Arr.end(), first, last);
+            std::size_t added = m_Arr.size() - oldSize;
+            if (added >= oldSize) {
+                constructHeap();
+                return;
+            }
+            for (std::size_t i = oldSize; i < m_Arr.size(); i++) {
+                T value = std::move(m_Arr[i]);
+                impl::heap::siftUp<Arity>(m_Arr.data(), i, std::move(value), comparator);
+            }
         }
 
         /**
@@ -283,9 +400,17 @@ namespace wtl {
          * @param args
          */
         template<typename ... Ts>
-        void emplace(Ts ... args) noexcept {
+        void emplace(Ts&& ... args) noexcept {
             m_Arr.emplace_back(std::forward<Ts>(args)...);
-            bubbleUp(getSize());
+            bubbleUp();
+        }
+
+        /**
+         * Reserve storage for a number of elements.
+         * @param capacity
+         */
+        void reserve(std::size_t capacity) {
+            m_Arr.reserve(capacity);
         }
 
         /**
@@ -301,4 +426,4 @@ namespace wtl {
         ~Heap() = default;
 
     };
-}
\ No newline at end of file
+}
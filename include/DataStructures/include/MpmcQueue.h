@@ -0,0 +1,354 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * A bounded, lock-free first-in first-out (FIFO) queue for any number of producer and consumer threads, using
+     * Dmitry Vyukov's design. Every slot of the circular buffer has a sequence number that says whose turn it is:
+     * a producer claiming position p waits for the sequence p, and publishes p + 1 once the element is constructed;
+     * a consumer claiming position p waits for p + 1, and hands the slot back to the next round of producers by
+     * publishing p + capacity. Positions are claimed with a compare-and-swap on the enqueue or dequeue counter,
+     * each on its own cache line, so producers and consumers only contend among themselves.
+     * The range variants claim a run of consecutive slots with a single compare-and-swap.
+     * A claimed position cannot be given back, so if constructing an element throws, its slot is still published,
+     * marked as skipped, and consumers pass over it. If moving an element out to a consumer throws, the elements of
+     * the positions that consumer claimed are destroyed before the exception propagates.
+     * @tparam T
+     */
+    template<typename T>
+    class MpmcQueue {
+    private:
+
+        /**
+         * A slot of the buffer and its sequence number
+         */
+        struct Cell {
+
+            std::atomic<std::size_t> m_Sequence;
+
+            /// Whether a producer failed to construct the element, published along with the sequence number
+            bool m_Skipped;
+
+            alignas(T) unsigned char m_Storage[sizeof(T)];
+
+            T* element() noexcept {
+                return std::launder(reinterpret_cast<T*>(m_Storage));
+            }
+
+        };
+
+        /**
+         * A counter of claimed positions, alone on its cache line
+         */
+        struct alignas(impl::ds::CACHE_LINE_SIZE) Counter {
+            std::atomic<std::size_t> m_Position{0};
+        };
+
+        /// Next position to enqueue at
+        Counter m_Enqueue;
+
+        /// Next position to dequeue from
+        Counter m_Dequeue;
+
+        /// Circular buffer, read-only after construction
+        alignas(impl::ds::CACHE_LINE_SIZE) Cell* m_Cells = nullptr;
+
+        /// Size of the buffer, a power of 2
+        std::size_t m_Capacity = 0;
+
+        /**
+         * Claim up to a number of consecutive positions whose cells are ready, that is whose sequence number is the
+         * position plus an offset. Once a position is claimed, no other thread touches its cell until this thread
+         * publishes a new sequence number, so the cells checked before the claim stay ready.
+         * @param counter
+         * @param offset 0 for producers, 1 for consumers
+         * @param wanted
+         * @return First claimed position, and the number of positions claimed, which is 0 if the queue is full
+         * (producers) or empty (consumers).
+         */
+        std::pair<std::size_t, std::size_t> claim(Counter& counter, std::size_t offset, std::size_t wanted) noexcept {
+            std::size_t position = counter.m_Position.load(std::memory_order_relaxed);
+            while (true) {
+                std::size_t count = 0;
+                bool stale = false;
+                while (count < wanted) {
+                    std::size_t expected = position + count + offset;
+                    std::size_t sequence = m_Cells[(position + count) & (m_Capacity - 1)].m_Sequence.load(
+                            std::memory_order_acquire);
+                    if (sequence != expected) {
+                        // Ahead means that another thread claimed this position since the counter was read.
+                        stale = count == 0 && static_cast<std::intptr_t>(sequence - expected) > 0;
+                        break;
+                    }
+                    count++;
+                }
+                if (count == 0 && !stale) {
+                    return {position, 0};
+                }
+                if (count > 0 && counter.m_Position.compare_exchange_weak(position, position + count,
+                                                                          std::memory_order_relaxed)) {
+                    return {position, count};
+                }
+                if (stale) {
+                    position = counter.m_Position.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * Publish claimed producer positions whose elements were not constructed, so that consumers skip them.
+         * @param position
+         * @param count
+         */
+        void publishSkipped(std::size_t position, std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; i++) {
+                Cell& cell = m_Cells[(position + i) & (m_Capacity - 1)];
+                cell.m_Skipped = true;
+                cell.m_Sequence.store(position + i + 1, std::memory_order_release);
+            }
+        }
+
+        /**
+         * Hand claimed consumer positions back to producers, destroying their elements.
+         * @param position
+         * @param count
+         */
+        void release(std::size_t position, std::size_t count) noexcept {
+            for (std::size_t i = 0; i < count; i++) {
+                Cell& cell = m_Cells[(position + i) & (m_Capacity - 1)];
+                if (cell.m_Skipped) {
+                    cell.m_Skipped = false;
+                } else {
+                    cell.element()->~T();
+                }
+                cell.m_Sequence.store(position + i + m_Capacity, std::memory_order_release);
+            }
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param capacity Maximum number of elements in the queue, rounded up to a power of 2
+         */
+        explicit MpmcQueue(std::size_t capacity) : m_Capacity(2) {
+            while (m_Capacity < capacity) {
+                m_Capacity *= 2;
+            }
+            m_Cells = static_cast<Cell*>(::operator new(m_Capacity * sizeof(Cell), std::align_val_t(alignof(Cell))));
+            for (std::size_t i = 0; i < m_Capacity; i++) {
+                new(&m_Cells[i].m_Sequence) std::atomic<std::size_t>(i);
+                m_Cells[i].m_Skipped = false;
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        /**
+         * Get the maximum number of elements in the queue
+         * @return
+         */
+        [[nodiscard]] std::size_t getCapacity() const noexcept {
+            return m_Capacity;
+        }
+
+        /**
+         * Get the number of elements in the queue, counting those still being enqueued or dequeued, and skipped
+         * slots. Only exact if no other thread is using the queue at the same time.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            std::size_t dequeued = m_Dequeue.m_Position.load(std::memory_order_acquire);
+            std::size_t enqueued = m_Enqueue.m_Position.load(std::memory_order_acquire);
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+        /**
+         * Check if queue is empty. Only exact if no other thread is using the queue at the same time.
+         * @return
+         */
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return getSize() == 0;
+        }
+
+        /**
+         * Construct an element in-place at the back of the queue, if it is not full.
+         * @tparam Ts
+         * @param args
+         * @return True if the element was enqueued, false if the queue is full.
+         */
+        template<typename ... Ts>
+        bool tryEmplace(Ts&& ... args) {
+            auto[position, count] = claim(m_Enqueue, 0, 1);
+            if (count == 0) {
+                return false;
+            }
+            Cell& cell = m_Cells[position & (m_Capacity - 1)];
+            try {
+                new(cell.m_Storage) T(std::forward<Ts>(args)...);
+            } catch (...) {
+                publishSkipped(position, 1);
+                throw;
+            }
+            cell.m_Sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Enqueue an element to the back of the queue, if it is not full.
+         * @param element
+         * @return True if the element was enqueued, false if the queue is full.
+         */
+        bool tryEnqueue(const T& element) {
+            return tryEmplace(element);
+        }
+
+        /**
+         * Enqueue an element to the back of the queue, if it is not full.
+         * @param element Only moved from if it was enqueued
+         * @return True if the element was enqueued, false if the queue is full.
+         */
+        bool tryEnqueue(T&& element) {
+            return tryEmplace(std::move(element));
+        }
+
+        /**
+         * Enqueue as many elements of a range as there are free consecutive slots for, in order. Elements enqueued
+         * by other producers at the same time never end up in between them. If copying an element throws, none of
+         * the range is enqueued.
+         * @tparam Iterator Forward iterator
+         * @param first
+         * @param last
+         * @return Number of elements enqueued, the first ones of the range.
+         */
+        template<typename Iterator>
+        std::size_t tryEnqueueRange(Iterator first, Iterator last) {
+            std::size_t wanted = std::min(static_cast<std::size_t>(std::distance(first, last)), m_Capacity);
+            if (wanted == 0) {
+                return 0;
+            }
+            auto[position, count] = claim(m_Enqueue, 0, wanted);
+            std::size_t constructed = 0;
+            try {
+                for (; constructed < count; constructed++, ++first) {
+                    new(m_Cells[(position + constructed) & (m_Capacity - 1)].m_Storage) T(*first);
+                }
+            } catch (...) {
+                for (std::size_t i = 0; i < constructed; i++) {
+                    m_Cells[(position + i) & (m_Capacity - 1)].element()->~T();
+                }
+                publishSkipped(position, count);
+                throw;
+            }
+            for (std::size_t i = 0; i < count; i++) {
+                m_Cells[(position + i) & (m_Capacity - 1)].m_Sequence.store(position + i + 1,
+                                                                           std::memory_order_release);
+            }
+            return count;
+        }
+
+        /**
+         * Move the element at the front of the queue out and remove it, if the queue is not empty. If the move
+         * assignment throws, the element is destroyed.
+         * @param element Assigned the front element
+         * @return True if an element was dequeued, false if the queue is empty.
+         */
+        bool tryDequeue(T& element) {
+            while (true) {
+                auto[position, count] = claim(m_Dequeue, 1, 1);
+                if (count == 0) {
+                    return false;
+                }
+                Cell& cell = m_Cells[position & (m_Capacity - 1)];
+                if (cell.m_Skipped) {
+                    release(position, 1);
+                    continue;
+                }
+                try {
+                    element = std::move(*cell.element());
+                } catch (...) {
+                    release(position, 1);
+                    throw;
+                }
+                release(position, 1);
+                return true;
+            }
+        }
+
+        /**
+         * Move up to a number of consecutive elements from the front of the queue to an output iterator, in order.
+         * If writing an element throws, it and the rest of the elements claimed with it are destroyed.
+         * @tparam OutputIterator
+         * @param out
+         * @param maxCount
+         * @return Number of elements dequeued
+         */
+        template<typename OutputIterator>
+        std::size_t tryDequeueInto(OutputIterator out, std::size_t maxCount = std::numeric_limits<std::size_t>::max()) {
+            std::size_t wanted = std::min(maxCount, m_Capacity);
+            if (wanted == 0) {
+                return 0;
+            }
+            while (true) {
+                auto[position, count] = claim(m_Dequeue, 1, wanted);
+                std::size_t dequeued = 0;
+                for (std::size_t i = 0; i < count; i++) {
+                    Cell& cell = m_Cells[(position + i) & (m_Capacity - 1)];
+                    if (!cell.m_Skipped) {
+                        try {
+                            *out = std::move(*cell.element());
+                            ++out;
+                        } catch (...) {
+                            release(position + i, count - i);
+                            throw;
+                        }
+                        dequeued++;
+                    }
+                    release(position + i, 1);
+                }
+                // A run of skipped slots is not an empty queue
+                if (dequeued > 0 || count == 0) {
+                    return dequeued;
+                }
+            }
+        }
+
+        /**
+         * Destructor. Must not run while any thread is still using the queue.
+         */
+        ~MpmcQueue() {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                std::size_t end = m_Enqueue.m_Position.load(std::memory_order_acquire);
+                for (std::size_t i = m_Dequeue.m_Position.load(std::memory_order_acquire); i != end; i++) {
+                    Cell& cell = m_Cells[i & (m_Capacity - 1)];
+                    if (!cell.m_Skipped) {
+                        cell.element()->~T();
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < m_Capacity; i++) {
+                m_Cells[i].m_Sequence.~atomic();
+            }
+            ::operator delete(m_Cells, m_Capacity * sizeof(Cell), std::align_val_t(alignof(Cell)));
+        }
+
+    };
+
+}
@@ -0,0 +1,294 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace wtl {
+
+    /**
+     * Allocator for the nodes of node based containers such as SinglyLinkedList, DoublyLinkedList and
+     * BinarySearchTree. Nodes are carved out of large chunks instead of being allocated one by one, and freed nodes
+     * are kept on a free list to be handed out again. Chunks are only returned to the system when the pool is
+     * destroyed, so a whole container is freed in O(chunks) instead of O(nodes), but a container keeps the memory of
+     * the most nodes it ever held. Containers therefore use a NodePool only when asked to, and allocate each node on
+     * its own with a HeapNodeAllocator by default.
+     * Chunks double in size up to MAXIMUM_CHUNK_SIZE nodes.
+     * @tparam T Type of node
+     */
+    template<typename T>
+    class NodePool {
+    public:
+
+        /// Containers may discard all their nodes at once using release()
+        static constexpr bool SUPPORTS_RELEASE = true;
+
+    private:
+
+        static constexpr std::size_t INITIAL_CHUNK_SIZE = 16;
+        static constexpr std::size_t MAXIMUM_CHUNK_SIZE = 4096;
+
+        /**
+         * Storage for a single node, or a link in the free list while the slot is not in use.
+         */
+        union Slot {
+            Slot* m_Next;
+            alignas(T) unsigned char m_Storage[sizeof(T)];
+        };
+
+        /**
+         * Header at the start of every chunk, followed by its slots.
+         */
+        struct Chunk {
+            /// Next chunk, in the order they were allocated
+            Chunk* m_Next;
+
+            /// Number of slots in the chunk
+            std::size_t m_Capacity;
+        };
+
+        static constexpr std::size_t ALIGNMENT = std::max(alignof(Chunk), alignof(Slot));
+
+        /// Offset of the first slot from the start of its chunk
+        static constexpr std::size_t HEADER_SIZE = (sizeof(Chunk) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+
+        /// First chunk allocated
+        Chunk* m_FirstChunk = nullptr;
+
+        /// Chunk that slots are currently carved from
+        Chunk* m_CurrentChunk = nullptr;
+
+        /// Next slot of the current chunk that was never handed out
+        Slot* m_Next = nullptr;
+
+        /// End of the slots of the current chunk
+        Slot* m_End = nullptr;
+
+        /// Slots that were handed out and given back
+        Slot* m_FreeList = nullptr;
+
+        /// Number of chunks allocated
+        std::size_t m_ChunkCount = 0;
+
+        /// Total number of slots in all chunks
+        std::size_t m_Capacity = 0;
+
+        /**
+         * Get the first slot of a chunk.
+         * @param chunk
+         * @return
+         */
+        [[nodiscard]] static Slot* slotsOf(Chunk* chunk) noexcept {
+            return reinterpret_cast<Slot*>(reinterpret_cast<unsigned char*>(chunk) + HEADER_SIZE);
+        }
+
+        /**
+         * Start carving slots from a chunk.
+         * @param chunk
+         */
+        void useChunk(Chunk* chunk) noexcept {
+            m_CurrentChunk = chunk;
+            m_Next = slotsOf(chunk);
+            m_End = m_Next + chunk->m_Capacity;
+        }
+
+        /**
+         * Move on to the next chunk, allocating it if the current chunk is the last one.
+         */
+        void nextChunk() {
+            if (m_CurrentChunk != nullptr && m_CurrentChunk->m_Next != nullptr) {
+                useChunk(m_CurrentChunk->m_Next);
+                return;
+            }
+            std::size_t capacity = m_CurrentChunk == nullptr ? INITIAL_CHUNK_SIZE :
+                                   std::min(m_CurrentChunk->m_Capacity * 2, MAXIMUM_CHUNK_SIZE);
+            auto* chunk = static_cast<Chunk*>(::operator new(HEADER_SIZE + capacity * sizeof(Slot),
+                                                             std::align_val_t(ALIGNMENT)));
+            chunk->m_Next = nullptr;
+            chunk->m_Capacity = capacity;
+            if (m_CurrentChunk == nullptr) {
+                m_FirstChunk = chunk;
+            } else {
+                m_CurrentChunk->m_Next = chunk;
+            }
+            m_ChunkCount++;
+            m_Capacity += capacity;
+            useChunk(chunk);
+        }
+
+        /**
+         * Return all chunks to the system.
+         */
+        void freeChunks() noexcept {
+            Chunk* chunk = m_FirstChunk;
+            while (chunk != nullptr) {
+                Chunk* next = chunk->m_Next;
+                ::operator delete(chunk, HEADER_SIZE + chunk->m_Capacity * sizeof(Slot), std::align_val_t(ALIGNMENT));
+                chunk = next;
+            }
+        }
+
+        /**
+         * Take over the chunks of another pool, which is left empty.
+         * @param other
+         */
+        void takeFrom(NodePool& other) noexcept {
+            m_FirstChunk = std::exchange(other.m_FirstChunk, nullptr);
+            m_CurrentChunk = std::exchange(other.m_CurrentChunk, nullptr);
+            m_Next = std::exchange(other.m_Next, nullptr);
+            m_End = std::exchange(other.m_End, nullptr);
+            m_FreeList = std::exchange(other.m_FreeList, nullptr);
+            m_ChunkCount = std::exchange(other.m_ChunkCount, 0);
+            m_Capacity = std::exchange(other.m_Capacity, 0);
+        }
+
+    public:
+
+        /**
+         * Constructor. No memory is allocated until the first node is created.
+         */
+        NodePool() = default;
+
+        /**
+         * Pools cannot be copied, since the nodes they hand out belong to a single container.
+         */
+        NodePool(const NodePool& other) = delete;
+
+        NodePool& operator=(const NodePool& other) = delete;
+
+        /**
+         * Move constructor. Nodes created by the other pool now belong to this one.
+         * @param other
+         */
+        NodePool(NodePool&& other) noexcept {
+            takeFrom(other);
+        }
+
+        /**
+         * Move assignment. The memory of this pool is freed, so all of its nodes must have been destroyed.
+         * @param other
+         * @return
+         */
+        NodePool& operator=(NodePool&& other) noexcept {
+            if (this != &other) {
+                freeChunks();
+                takeFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Construct a node. If the constructor throws, the slot goes back on the free list.
+         * @tparam Ts
+         * @param args
+         * @return
+         */
+        template<typename ... Ts>
+        T* create(Ts&& ... args) {
+            Slot* slot;
+            if (m_FreeList != nullptr) {
+                slot = m_FreeList;
+                m_FreeList = slot->m_Next;
+            } else {
+                if (m_Next == m_End) {
+                    nextChunk();
+                }
+                slot = m_Next++;
+            }
+            try {
+                return new(slot->m_Storage) T(std::forward<Ts>(args)...);
+            } catch (...) {
+                slot->m_Next = m_FreeList;
+                m_FreeList = slot;
+                throw;
+            }
+        }
+
+        /**
+         * Destroy a node and keep its memory for the next node created.
+         * @param node
+         */
+        void destroy(T* node) noexcept {
+            node->~T();
+            Slot* slot = reinterpret_cast<Slot*>(node);
+            slot->m_Next = m_FreeList;
+            m_FreeList = slot;
+        }
+
+        /**
+         * Discard every node at once without calling their destructors, keeping all chunks for the nodes created
+         * afterwards. Nodes that are not trivially destructible must have been destroyed in place beforehand.
+         */
+        void release() noexcept {
+            m_FreeList = nullptr;
+            if (m_FirstChunk != nullptr) {
+                useChunk(m_FirstChunk);
+            }
+        }
+
+        /**
+         * Get the number of chunks allocated.
+         * @return
+         */
+        [[nodiscard]] std::size_t getChunkCount() const noexcept {
+            return m_ChunkCount;
+        }
+
+        /**
+         * Get the number of nodes that fit in the chunks allocated.
+         * @return
+         */
+        [[nodiscard]] std::size_t getCapacity() const noexcept {
+            return m_Capacity;
+        }
+
+        /**
+         * Destructor. Frees all chunks without calling the destructors of nodes still in them.
+         */
+        ~NodePool() {
+            freeChunks();
+        }
+
+    };
+
+    /**
+     * Allocator for container nodes that allocates each node on its own, using new and delete, so the memory of a
+     * removed node is returned immediately. The default allocator of SinglyLinkedList, DoublyLinkedList and
+     * BinarySearchTree.
+     * @tparam T Type of node
+     */
+    template<typename T>
+    class HeapNodeAllocator {
+    public:
+
+        /// Nodes have to be destroyed one by one
+        static constexpr bool SUPPORTS_RELEASE = false;
+
+        /**
+         * Construct a node.
+         * @tparam Ts
+         * @param args
+         * @return
+         */
+        template<typename ... Ts>
+        T* create(Ts&& ... args) {
+            return new T(std::forward<Ts>(args)...);
+        }
+
+        /**
+         * Destroy a node and free its memory.
+         * @param node
+         */
+        void destroy(T* node) noexcept {
+            delete node;
+        }
+
+    };
+
+}
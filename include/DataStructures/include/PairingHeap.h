@@ -0,0 +1,533 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "impl/DataStructuresImpl.h"
+#include "NodePool.h"
+
+namespace wtl {
+
+    namespace impl {
+
+        /**
+         * Node of a PairingHeap. The children of a node form a doubly linked list of siblings, and the first child
+         * points back to its parent instead of a previous sibling.
+         * @tparam T
+         */
+        template<typename T>
+        struct PairingHeapNode {
+
+            T m_Value;
+
+            /// First child
+            PairingHeapNode* m_Child = nullptr;
+
+            /// Next sibling
+            PairingHeapNode* m_Next = nullptr;
+
+            /// Previous sibling, or the parent for the first child
+            PairingHeapNode* m_Prev = nullptr;
+
+            template<typename ... Ts>
+            explicit PairingHeapNode(Ts&& ... args) : m_Value(std::forward<Ts>(args)...) {}
+
+        };
+
+    }
+
+    /**
+     * Pairing heap, a heap-ordered multiway tree. Inserting, melding two heaps and raising the priority of an element
+     * take O(1) time, and removing the root takes O(log n) amortized time.
+     * By default, the comparison is done using operator<, hence the largest value has the highest priority.
+     * A custom binary predicate can be provided for custom ordering.
+     * Nodes come from a NodePool. Heaps that are going to be melded should share a pool, by passing the pool of one
+     * heap to the constructor of the others: melding heaps with the same pool just links their roots, while melding
+     * heaps with different pools moves each element across. A pool is not thread-safe, so heaps sharing a pool must
+     * be used from one thread at a time.
+     * @tparam T
+     * @tparam Comparator
+     */
+    template<typename T, typename Comparator = impl::ds::StandardComparator<T>>
+    class PairingHeap {
+    private:
+
+        typedef impl::PairingHeapNode<T> Node;
+
+    public:
+
+        typedef NodePool<Node> Pool;
+
+        /**
+         * Refers to an element of the heap, and stays valid until the element is removed. After a meld, the handle
+         * refers to the element in the heap it was melded into, provided both heaps share a pool.
+         */
+        class Handle {
+        private:
+
+            friend class PairingHeap;
+
+            Node* m_Node = nullptr;
+
+            explicit Handle(Node* node) noexcept: m_Node(node) {}
+
+        public:
+
+            Handle() = default;
+
+            const T& operator*() const noexcept {
+                return m_Node->m_Value;
+            }
+
+            const T* operator->() const noexcept {
+                return &m_Node->m_Value;
+            }
+
+            bool operator==(const Handle& other) const noexcept {
+                return m_Node == other.m_Node;
+            }
+
+            bool operator!=(const Handle& other) const noexcept {
+                return m_Node != other.m_Node;
+            }
+
+        };
+
+    private:
+
+        /// Comparator object used for ordering
+        impl::ds::ComparatorHelper<T, Comparator> comparator;
+
+        /// Pool the nodes are allocated from, created on first use
+        std::shared_ptr<Pool> m_Pool;
+
+        /// Root of the tree, the element with the highest priority
+        Node* m_Root = nullptr;
+
+        /// Number of elements
+        std::size_t m_Size = 0;
+
+        Pool& pool() {
+            if (m_Pool == nullptr) {
+                m_Pool = std::make_shared<Pool>();
+            }
+            return *m_Pool;
+        }
+
+        /**
+         * Link two roots, making the one with lower priority the first child of the other.
+         * @param first
+         * @param second
+         * @return The new root
+         */
+        Node* link(Node* first, Node* second) const noexcept {
+            if (comparator(first->m_Value, second->m_Value)) {
+                std::swap(first, second);
+            }
+            second->m_Next = first->m_Child;
+            if (first->m_Child != nullptr) {
+                first->m_Child->m_Prev = second;
+            }
+            second->m_Prev = first;
+            first->m_Child = second;
+            first->m_Next = nullptr;
+            first->m_Prev = nullptr;
+            return first;
+        }
+
+        /**
+         * Combine a list of siblings into one tree using the two-pass method: link the siblings in pairs from left to
+         * right, then link the results from right to left.
+         * @param first First sibling
+         * @return Root of the tree
+         */
+        Node* mergePairs(Node* first) const noexcept {
+            if (first == nullptr) {
+                return nullptr;
+            }
+            // The results of the first pass are stacked using m_Next, with the rightmost on top.
+            Node* stack = nullptr;
+            while (first != nullptr) {
+                Node* second = first->m_Next;
+                Node* next = second == nullptr ? nullptr : second->m_Next;
+                Node* linked = second == nullptr ? first : link(first, second);
+                linked->m_Next = stack;
+                stack = linked;
+                first = next;
+            }
+            Node* root = stack;
+            stack = stack->m_Next;
+            while (stack != nullptr) {
+                Node* next = stack->m_Next;
+                root = link(stack, root);
+                stack = next;
+            }
+            root->m_Next = nullptr;
+            root->m_Prev = nullptr;
+            return root;
+        }
+
+        /**
+         * Detach a node that is not the root, together with its subtree, from its parent and siblings.
+         * @param node
+         */
+        static void cut(Node* node) noexcept {
+            if (node->m_Prev->m_Child == node) {
+                node->m_Prev->m_Child = node->m_Next;
+            } else {
+                node->m_Prev->m_Next = node->m_Next;
+            }
+            if (node->m_Next != nullptr) {
+                node->m_Next->m_Prev = node->m_Prev;
+            }
+            node->m_Next = nullptr;
+            node->m_Prev = nullptr;
+        }
+
+        /**
+         * Add a node to the heap.
+         * @param node
+         * @return Handle to the node
+         */
+        Handle push(Node* node) noexcept {
+            m_Root = m_Root == nullptr ? node : link(m_Root, node);
+            m_Size++;
+            return Handle(node);
+        }
+
+        /**
+         * Restore the heap order after the priority of a node was raised.
+         * @param node
+         */
+        void promote(Node* node) noexcept {
+            if (node != m_Root) {
+                cut(node);
+                m_Root = link(m_Root, node);
+            }
+        }
+
+        /**
+         * Visit every node, in no particular order.
+         * @tparam Func
+         * @param func
+         */
+        template<typename Func>
+        void visit(Func&& func) const {
+            if (m_Root == nullptr) {
+                return;
+            }
+            std::vector<const Node*> stack{m_Root};
+            while (!stack.empty()) {
+                const Node* node = stack.back();
+                stack.pop_back();
+                func(node);
+                for (const Node* child = node->m_Child; child != nullptr; child = child->m_Next) {
+                    stack.push_back(child);
+                }
+            }
+        }
+
+        /**
+         * Destroy every node. If no other heap uses the pool and the elements are trivially destructible, the pool
+         * discards all nodes at once; otherwise the nodes are returned to the pool one by one.
+         */
+        void destroyAll() noexcept {
+            if (m_Root == nullptr) {
+                return;
+            }
+            if (m_Pool.use_count() == 1 && std::is_trivially_destructible_v<T>) {
+                m_Pool->release();
+            } else {
+                // Treating m_Child as the left and m_Next as the right pointer, rotate right until the node has no
+                // left child, so that no stack is needed.
+                Node* node = m_Root;
+                while (node != nullptr) {
+                    if (node->m_Child != nullptr) {
+                        Node* child = node->m_Child;
+                        node->m_Child = child->m_Next;
+                        child->m_Next = node;
+                        node = child;
+                    } else {
+                        Node* next = node->m_Next;
+                        m_Pool->destroy(node);
+                        node = next;
+                    }
+                }
+            }
+            m_Root = nullptr;
+            m_Size = 0;
+        }
+
+    public:
+
+        /**
+         * Constructor. The heap gets its own pool when the first element is inserted.
+         */
+        PairingHeap() = default;
+
+        /**
+         * Constructor
+         * @param pool Pool to allocate the nodes from, usually the pool of another heap this one will be melded with
+         */
+        explicit PairingHeap(std::shared_ptr<Pool> pool) noexcept: m_Pool(std::move(pool)) {}
+
+        PairingHeap(std::initializer_list<T> list) {
+            for (const T& element : list) {
+                insert(element);
+            }
+        }
+
+        /**
+         * Copy constructor. The copy has its own pool.
+         * @param other
+         */
+        PairingHeap(const PairingHeap& other) {
+            other.visit([this](const Node* node) {
+                insert(node->m_Value);
+            });
+        }
+
+        /**
+         * Copy assignment. This heap keeps its pool.
+         * @param other
+         * @return
+         */
+        PairingHeap& operator=(const PairingHeap& other) {
+            if (this != &other) {
+                clear();
+                other.visit([this](const Node* node) {
+                    insert(node->m_Value);
+                });
+            }
+            return *this;
+        }
+
+        /**
+         * Move constructor. Handles into the other heap now refer to elements of this one.
+         * @param other
+         */
+        PairingHeap(PairingHeap&& other) noexcept
+                : m_Pool(std::move(other.m_Pool)), m_Root(std::exchange(other.m_Root, nullptr)),
+                  m_Size(std::exchange(other.m_Size, 0)) {}
+
+        /**
+         * Move assignment. Handles into the other heap now refer to elements of this one.
+         * @param other
+         * @return
+         */
+        PairingHeap& operator=(PairingHeap&& other) noexcept {
+            if (this != &other) {
+                destroyAll();
+                m_Pool = std::move(other.m_Pool);
+                m_Root = std::exchange(other.m_Root, nullptr);
+                m_Size = std::exchange(other.m_Size, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * Get the pool the nodes are allocated from, to share it with another heap.
+         * @return
+         */
+        std::shared_ptr<Pool> getPool() {
+            pool();
+            return m_Pool;
+        }
+
+        /**
+         * Get the number of elements in the heap
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Check if the heap is empty
+         * @return
+         */
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return m_Size == 0;
+        }
+
+        /**
+         * Get the element with the highest priority
+         * @return
+         */
+        const T& peek() const {
+            if (isEmpty()) {
+                throw std::runtime_error("Pairing heap is empty");
+            }
+            return m_Root->m_Value;
+        }
+
+        /**
+         * Get a handle to the element with the highest priority
+         * @return
+         */
+        Handle top() const {
+            if (isEmpty()) {
+                throw std::runtime_error("Pairing heap is empty");
+            }
+            return Handle(m_Root);
+        }
+
+        /**
+         * Insert an element into the heap.
+         * @param element
+         * @return Handle to the element
+         */
+        Handle insert(const T& element) {
+            return push(pool().create(element));
+        }
+
+        /**
+         * Insert an element into the heap.
+         * @param element
+         * @return Handle to the element
+         */
+        Handle insert(T&& element) {
+            return push(pool().create(std::move(element)));
+        }
+
+        /**
+         * Construct an element in-place in the heap.
+         * @tparam Ts
+         * @param args
+         * @return Handle to the element
+         */
+        template<typename ... Ts>
+        Handle emplace(Ts&& ... args) {
+            return push(pool().create(std::forward<Ts>(args)...));
+        }
+
+        /**
+         * Remove the element with the highest priority.
+         */
+        void poll() {
+            if (isEmpty()) {
+                throw std::runtime_error("Pairing heap is empty");
+            }
+            Node* root = m_Root;
+            m_Root = mergePairs(root->m_Child);
+            m_Pool->destroy(root);
+            m_Size--;
+        }
+
+        /**
+         * Remove an element.
+         * @param handle
+         */
+        void erase(Handle handle) noexcept {
+            Node* node = handle.m_Node;
+            if (node == m_Root) {
+                m_Root = mergePairs(node->m_Child);
+            } else {
+                cut(node);
+                Node* children = mergePairs(node->m_Child);
+                if (children != nullptr) {
+                    m_Root = link(m_Root, children);
+                }
+            }
+            m_Pool->destroy(node);
+            m_Size--;
+        }
+
+        /**
+         * Replace an element with one of equal or higher priority, which for a heap ordered by operator< means
+         * increasing it, and for a min-heap decreasing it.
+         * @param handle
+         * @param element
+         */
+        void decreaseKey(Handle handle, const T& element) {
+            if (comparator(element, handle.m_Node->m_Value)) {
+                throw std::invalid_argument("New element has lower priority");
+            }
+            handle.m_Node->m_Value = element;
+            promote(handle.m_Node);
+        }
+
+        /**
+         * Replace an element with one of equal or higher priority, which for a heap ordered by operator< means
+         * increasing it, and for a min-heap decreasing it.
+         * @param handle
+         * @param element
+         */
+        void decreaseKey(Handle handle, T&& element) {
+            if (comparator(element, handle.m_Node->m_Value)) {
+                throw std::invalid_argument("New element has lower priority");
+            }
+            handle.m_Node->m_Value = std::move(element);
+            promote(handle.m_Node);
+        }
+
+        /**
+         * Move every element of another heap into this one, leaving the other heap empty. Takes O(1) time if both
+         * heaps share a pool, in which case handles into the other heap refer to elements of this one afterwards.
+         * Otherwise every element is moved across and the handles into the other heap are invalidated.
+         * @param other
+         */
+        void meld(PairingHeap& other) {
+            if (this == &other || other.m_Root == nullptr) {
+                return;
+            }
+            if (m_Pool == nullptr) {
+                m_Pool = other.m_Pool;
+            }
+            if (m_Pool != other.m_Pool) {
+                other.visit([this](const Node* node) {
+                    insert(std::move(const_cast<Node*>(node)->m_Value));
+                });
+                other.destroyAll();
+                return;
+            }
+            m_Root = m_Root == nullptr ? other.m_Root : link(m_Root, other.m_Root);
+            m_Size += other.m_Size;
+            other.m_Root = nullptr;
+            other.m_Size = 0;
+        }
+
+        /**
+         * Move every element of another heap into this one.
+         * @param other
+         */
+        void meld(PairingHeap&& other) {
+            meld(other);
+        }
+
+        /**
+         * Iterate through all the elements in the heap, in no particular order
+         * @param func Function that takes in a const T& as parameter
+         */
+        void foreach(const std::function<void(const T&)>& func) const {
+            visit([&func](const Node* node) {
+                func(node->m_Value);
+            });
+        }
+
+        /**
+         * Remove all elements in the heap. The pool keeps its memory for later insertions.
+         */
+        void clear() noexcept {
+            destroyAll();
+        }
+
+        /**
+         * Destructor
+         */
+        ~PairingHeap() {
+            destroyAll();
+        }
+
+    };
+
+}
@@ -18,12 +18,13 @@ namespace wtl {
      * A custom binary predicate can be provided for custom ordering.
      * @tparam T
      * @tparam Comparator
+     * @tparam Arity Number of children of each node of the underlying heap
      */
-    template<typename T, typename Comparator = impl::ds::StandardComparator<T>>
+    template<typename T, typename Comparator = impl::ds::StandardComparator<T>, std::size_t Arity = 2>
     class PriorityQueue {
     private:
 
-        using Heap = wtl::Heap<T, Comparator>;
+        using Heap = wtl::Heap<T, Comparator, Arity>;
 
         /// Underlying heap data structure
         Heap m_Heap;
@@ -48,18 +49,28 @@ namespace wtl {
         template<typename Container>
         explicit PriorityQueue(const Container& container) : m_Heap(container) {}
 
+        /**
+         * Constructor
+         * Construct priority queue using the elements of a range, in O(n) time.
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        PriorityQueue(Iterator first, Iterator last) : m_Heap(first, last) {}
+
         /**
          * Copy constructor
          * @param other
          */
-        PriorityQueue(const PriorityQueue<T, Comparator>& other) noexcept: m_Heap(other.m_Heap) {}
+        PriorityQueue(const PriorityQueue& other) noexcept: m_Heap(other.m_Heap) {}
 
         /**
          * Copy assignment
          * @param other
          * @return
          */
-        PriorityQueue<T, Comparator>& operator=(const PriorityQueue<T, Comparator>& other) noexcept {
+        PriorityQueue& operator=(const PriorityQueue& other) noexcept {
             if (this != &other) {
                 m_Heap.clear();
                 m_Heap = other.m_Heap;
@@ -71,14 +82,14 @@ namespace wtl {
          * Move constructor
          * @param other
          */
-        PriorityQueue(PriorityQueue<T, Comparator>&& other) noexcept: m_Heap(std::move(other.m_Heap)) {}
+        PriorityQueue(PriorityQueue&& other) noexcept: m_Heap(std::move(other.m_Heap)) {}
 
         /**
          * Move assignment
          * @param other
          * @return
          */
-        PriorityQueue<T, Comparator>& operator=(PriorityQueue<T, Comparator>&& other) noexcept {
+        PriorityQueue& operator=(PriorityQueue&& other) noexcept {
             if (this != &other) {
                 m_Heap.clear();
                 m_Heap = std::move(other.m_Heap);
@@ -129,7 +140,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool equals(const PriorityQueue<T>& other) const noexcept {
+        bool equals(const PriorityQueue& other) const noexcept {
             return (*this) == other;
         }
 
@@ -138,7 +149,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool notEquals(const PriorityQueue<T>& other) const noexcept {
+        bool notEquals(const PriorityQueue& other) const noexcept {
             return (*this) != other;
         }
 
@@ -147,7 +158,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator==(const PriorityQueue<T>& other) const noexcept {
+        bool operator==(const PriorityQueue& other) const noexcept {
             return m_Heap == (other.m_Heap);
         }
 
@@ -156,7 +167,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator!=(const PriorityQueue<T>& other) const noexcept {
+        bool operator!=(const PriorityQueue& other) const noexcept {
             return !(m_Heap == other.m_Heap);
         }
 
@@ -170,6 +181,18 @@ namespace wtl {
             m_Heap.poll();
         }
 
+        /**
+         * Remove up to a number of elements with the highest priority, moving them to an output iterator in order.
+         * @tparam OutputIterator
+         * @param count
+         * @param out
+         * @return Number of elements removed
+         */
+        template<typename OutputIterator>
+        std::size_t pollN(std::size_t count, OutputIterator out) {
+            return m_Heap.popN(count, out);
+        }
+
         /**
          * Insert element into priority queue
          * @param element
@@ -186,6 +209,17 @@ namespace wtl {
             m_Heap.insert(std::move(element));
         }
 
+        /**
+         * Insert the elements of a range into the priority queue
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void insertRange(Iterator first, Iterator last) {
+            m_Heap.pushRange(first, last);
+        }
+
         /**
          * Construct element in-place in priority queue
          * @tparam Ts
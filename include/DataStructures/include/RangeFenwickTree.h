@@ -0,0 +1,166 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "FenwickTree.h"
+
+namespace wtl {
+
+    /**
+     * A fenwick tree that supports adding a value to every element of a range and querying the sum of a range, both in
+     * O(logn) time complexity.
+     * Two fenwick trees are kept over the difference array d, where d[i] = a[i] - a[i - 1]. The first holds d[i] and
+     * the second holds d[i] * i, so that the prefix sum a[0] + ... + a[i] is (i + 1) * sum(d[0..i]) - sum(d[j] * j).
+     * Adding v to the range [l, r] only changes d[l] and d[r + 1].
+     * Indexed [0, size - 1], like an original array.
+     * @tparam T Numeric data type
+     */
+    template<typename T>
+    class RangeFenwickTree {
+    private:
+
+        /// Fenwick tree over the difference array
+        FenwickTree<T> m_Differences;
+
+        /// Fenwick tree over the difference array, each multiplied by its index
+        FenwickTree<T> m_WeightedDifferences;
+
+        [[nodiscard]] bool outOfBounds(std::size_t index) const noexcept {
+            return index >= getSize();
+        }
+
+        template<typename Container>
+        static std::vector<T> differences(const Container& container, bool weighted) {
+            std::vector<T> result;
+            T previous = T();
+            for (const auto& element : container) {
+                T value = static_cast<T>(element);
+                T difference = value - previous;
+                result.push_back(weighted ? difference * static_cast<T>(result.size()) : difference);
+                previous = value;
+            }
+            return result;
+        }
+
+        /**
+         * Add a value to the difference array at an index position, which may be one past the last element.
+         * @param index
+         * @param value
+         */
+        void addDifference(std::size_t index, T value) {
+            if (index < getSize()) {
+                m_Differences.update(index, value);
+                m_WeightedDifferences.update(index, value * static_cast<T>(index));
+            }
+        }
+
+        /**
+         * Sum of all indexes from index zero to index (inclusive), which must be valid.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] T prefixSum(std::size_t index) const {
+            return m_Differences.query(index) * static_cast<T>(index + 1) - m_WeightedDifferences.query(index);
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * Takes in a stl container and populates the tree with the elements, in the same order as they appear in the
+         * container as per the iterators.
+         * @tparam Container
+         * @param container
+         */
+        template<typename Container>
+        explicit RangeFenwickTree(const Container& container)
+                : m_Differences(differences(container, false)),
+                  m_WeightedDifferences(differences(container, true)) {}
+
+        /**
+         * Number of elements in the tree.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Differences.getSize();
+        }
+
+        /**
+         * Retrieve the value of a single index position of the array.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] T retrieve(std::size_t index) const {
+            if (outOfBounds(index)) {
+                throw std::invalid_argument("Index out of range");
+            }
+            return m_Differences.query(index);
+        }
+
+        /**
+         * Query the sum from index zero (inclusive) to index endIndex (inclusive).
+         * @param endIndex
+         * @return
+         */
+        [[nodiscard]] T query(std::size_t endIndex) const {
+            if (outOfBounds(endIndex)) {
+                throw std::invalid_argument("Index out of range");
+            }
+            return prefixSum(endIndex);
+        }
+
+        /**
+         * Query the sum from index startIndex (inclusive) to endIndex (inclusive).
+         * StartIndex cannot be larger than endIndex.
+         * @param startIndex
+         * @param endIndex
+         * @return
+         */
+        [[nodiscard]] T query(std::size_t startIndex, std::size_t endIndex) const {
+            if (outOfBounds(startIndex) || outOfBounds(endIndex) || startIndex > endIndex) {
+                throw std::invalid_argument("Index out of range");
+            }
+            if (startIndex == 0) {
+                return prefixSum(endIndex);
+            }
+            return prefixSum(endIndex) - prefixSum(startIndex - 1);
+        }
+
+        /**
+         * Change the value of an index position of the array by an amount.
+         * @param index
+         * @param value
+         */
+        void update(std::size_t index, T value) {
+            update(index, index, value);
+        }
+
+        /**
+         * Change the value of every index position from startIndex (inclusive) to endIndex (inclusive) by an amount.
+         * StartIndex cannot be larger than endIndex.
+         * @param startIndex
+         * @param endIndex
+         * @param value
+         */
+        void update(std::size_t startIndex, std::size_t endIndex, T value) {
+            if (outOfBounds(startIndex) || outOfBounds(endIndex) || startIndex > endIndex) {
+                throw std::invalid_argument("Index out of range");
+            }
+            addDifference(startIndex, value);
+            addDifference(endIndex + 1, -value);
+        }
+
+        /**
+         * Destructor
+         */
+        ~RangeFenwickTree() = default;
+
+    };
+
+}
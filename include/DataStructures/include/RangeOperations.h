@@ -0,0 +1,137 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+namespace wtl {
+
+    /**
+     * Operations that range query structures such as SparseTable combine elements with. They are passed as a
+     * template parameter, so every combine is inlined into the loops that build and query the structure.
+     * A user-defined operation is any functor with a T operator()(const T&, const T&) const. SparseTable requires
+     * it to be associative and idempotent, i.e. op(a, a) == a, while DisjointSparseTable only requires it to be
+     * associative. SegmentTree also requires a static or const identity() member function, which returns the element
+     * e such that op(e, a) == op(a, e) == a.
+     */
+
+    /**
+     * Smaller of two elements, using operator<.
+     * @tparam T
+     */
+    template<typename T>
+    struct RangeMin {
+        static T identity() noexcept {
+            if constexpr (std::numeric_limits<T>::has_infinity) {
+                return std::numeric_limits<T>::infinity();
+            } else {
+                return std::numeric_limits<T>::max();
+            }
+        }
+
+        T operator()(const T& lhs, const T& rhs) const noexcept {
+            return rhs < lhs ? rhs : lhs;
+        }
+    };
+
+    /**
+     * Larger of two elements, using operator<.
+     * @tparam T
+     */
+    template<typename T>
+    struct RangeMax {
+        static T identity() noexcept {
+            if constexpr (std::numeric_limits<T>::has_infinity) {
+                return -std::numeric_limits<T>::infinity();
+            } else {
+                return std::numeric_limits<T>::lowest();
+            }
+        }
+
+        T operator()(const T& lhs, const T& rhs) const noexcept {
+            return lhs < rhs ? rhs : lhs;
+        }
+    };
+
+    /**
+     * Greatest common divisor of two integers.
+     * @tparam T
+     */
+    template<typename T>
+    struct RangeGcd {
+        static T identity() noexcept {
+            return 0;
+        }
+
+        static_assert(std::is_integral_v<T>, "Greatest common divisor is only defined for integral types");
+
+        T operator()(const T& lhs, const T& rhs) const noexcept {
+            return std::gcd(lhs, rhs);
+        }
+    };
+
+    /**
+     * Bitwise AND of two integers.
+     * @tparam T
+     */
+    template<typename T>
+    struct RangeBitAnd {
+        static T identity() noexcept {
+            return ~T(0);
+        }
+
+        T operator()(const T& lhs, const T& rhs) const noexcept {
+            return lhs & rhs;
+        }
+    };
+
+    /**
+     * Bitwise OR of two integers.
+     * @tparam T
+     */
+    template<typename T>
+    struct RangeBitOr {
+        static T identity() noexcept {
+            return 0;
+        }
+
+        T operator()(const T& lhs, const T& rhs) const noexcept {
+            return lhs | rhs;
+        }
+    };
+
+    /**
+     * Sum of two elements, using operator+. Not idempotent.
+     * @tparam T
+     */
+    template<typename T>
+    struct RangeSum {
+        static T identity() {
+            return T();
+        }
+
+        T operator()(const T& lhs, const T& rhs) const {
+            return lhs + rhs;
+        }
+    };
+
+    /**
+     * Product of two elements, using operator*. Not idempotent, and not commutative for types such as matrices.
+     * @tparam T
+     */
+    template<typename T>
+    struct RangeProduct {
+        static T identity() {
+            return T(1);
+        }
+
+        T operator()(const T& lhs, const T& rhs) const {
+            return lhs * rhs;
+        }
+    };
+
+}
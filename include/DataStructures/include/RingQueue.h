@@ -0,0 +1,421 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * A first-in first-out (FIFO) queue stored in a circular buffer. Unlike Queue, which allocates a node for every
+     * element, elements are stored contiguously, and the buffer only grows, by doubling, when it is full. Once the
+     * queue has reached its largest size, enqueueing and dequeueing allocate nothing.
+     * The capacity is always a power of 2, so that positions wrap around using a mask instead of a division.
+     * @tparam T
+     */
+    template<typename T>
+    class RingQueue {
+    private:
+
+        /// Capacity allocated by the first enqueue
+        static constexpr std::size_t MINIMUM_CAPACITY = 8;
+
+        /// Circular buffer, nullptr until the first enqueue
+        T* m_Buffer = nullptr;
+
+        /// Size of the buffer, 0 or a power of 2
+        std::size_t m_Capacity = 0;
+
+        /// Position of the front element
+        std::size_t m_Head = 0;
+
+        /// Number of elements
+        std::size_t m_Size = 0;
+
+        [[nodiscard]] std::size_t wrap(std::size_t position) const noexcept {
+            return position & (m_Capacity - 1);
+        }
+
+        /**
+         * Move the elements into a new buffer, unwrapping them so that the front element is at position 0.
+         * Before the elements are moved, construct is called with the position in the new buffer just past the last
+         * element, so that new elements can be constructed there from elements of the queue while they are still
+         * valid. If it throws, the queue is left unchanged.
+         * @tparam Construct
+         * @param newCapacity Power of 2, not less than the size plus the number of elements constructed
+         * @param construct
+         */
+        template<typename Construct>
+        void reAllocate(std::size_t newCapacity, Construct&& construct) {
+            T* newBuffer = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+            try {
+                construct(newBuffer + m_Size);
+            } catch (...) {
+                ::operator delete(newBuffer, newCapacity * sizeof(T));
+                throw;
+            }
+            std::size_t first = std::min(m_Size, m_Capacity - m_Head);
+            impl::ds::relocate(newBuffer, m_Buffer + m_Head, first);
+            impl::ds::relocate(newBuffer + first, m_Buffer, m_Size - first);
+            ::operator delete(m_Buffer, m_Capacity * sizeof(T));
+            m_Buffer = newBuffer;
+            m_Capacity = newCapacity;
+            m_Head = 0;
+        }
+
+        void reAllocate(std::size_t newCapacity) {
+            reAllocate(newCapacity, [](T*) {});
+        }
+
+        /**
+         * Capacity needed for a number of extra elements, doubling the current capacity as many times as needed.
+         * @param count
+         * @return
+         */
+        [[nodiscard]] std::size_t grownCapacity(std::size_t count) const noexcept {
+            std::size_t newCapacity = std::max(m_Capacity, MINIMUM_CAPACITY);
+            while (newCapacity < m_Size + count) {
+                newCapacity *= 2;
+            }
+            return newCapacity;
+        }
+
+        /**
+         * Make space for a number of extra elements, doubling the capacity as many times as needed.
+         * @param count
+         */
+        void growFor(std::size_t count) {
+            if (m_Size + count > m_Capacity) {
+                reAllocate(grownCapacity(count));
+            }
+        }
+
+        void destroyAll() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (std::size_t i = 0; i < m_Size; i++) {
+                    m_Buffer[wrap(m_Head + i)].~T();
+                }
+            }
+        }
+
+        /**
+         * Copy the elements of another queue into empty storage of sufficient capacity.
+         * @param other
+         */
+        void copyFrom(const RingQueue& other) {
+            for (std::size_t i = 0; i < other.m_Size; i++) {
+                new(&m_Buffer[i]) T(other.m_Buffer[other.wrap(other.m_Head + i)]);
+            }
+            m_Head = 0;
+            m_Size = other.m_Size;
+        }
+
+    public:
+
+        /**
+         * Constructor. Nothing is allocated until the first enqueue.
+         */
+        RingQueue() = default;
+
+        /**
+         * Constructor
+         * @param capacity Number of elements that can be enqueued before the first reallocation
+         */
+        explicit RingQueue(std::size_t capacity) {
+            reserve(capacity);
+        }
+
+        /**
+         * Copy constructor. The copy only allocates as much as the elements need.
+         * @param other
+         */
+        RingQueue(const RingQueue& other) {
+            growFor(other.m_Size);
+            copyFrom(other);
+        }
+
+        /**
+         * Copy assignment. The existing buffer is reused if it is large enough.
+         * @param other
+         * @return
+         */
+        RingQueue& operator=(const RingQueue& other) {
+            if (this != &other) {
+                clear();
+                growFor(other.m_Size);
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Move constructor. The buffer of the other queue is taken over, and the other queue is left empty with no
+         * buffer.
+         * @param other
+         */
+        RingQueue(RingQueue&& other) noexcept
+                : m_Buffer(std::exchange(other.m_Buffer, nullptr)), m_Capacity(std::exchange(other.m_Capacity, 0)),
+                  m_Head(std::exchange(other.m_Head, 0)), m_Size(std::exchange(other.m_Size, 0)) {}
+
+        /**
+         * Move assignment. The buffer of the other queue is taken over, and the other queue is left empty with no
+         * buffer.
+         * @param other
+         * @return
+         */
+        RingQueue& operator=(RingQueue&& other) noexcept {
+            if (this != &other) {
+                destroyAll();
+                ::operator delete(m_Buffer, m_Capacity * sizeof(T));
+                m_Buffer = std::exchange(other.m_Buffer, nullptr);
+                m_Capacity = std::exchange(other.m_Capacity, 0);
+                m_Head = std::exchange(other.m_Head, 0);
+                m_Size = std::exchange(other.m_Size, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * Get the length of the queue
+         * @return Length of the queue
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Get the number of elements that can be held without reallocating
+         * @return
+         */
+        [[nodiscard]] std::size_t getCapacity() const noexcept {
+            return m_Capacity;
+        }
+
+        /**
+         * Check if queue is empty
+         * @return True if queue is empty, false if not
+         */
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return m_Size == 0;
+        }
+
+        /**
+         * Peek the front of the queue.
+         * @return Reference to the front of the queue
+         * @throw std::runtime_error if queue is empty
+         */
+        [[nodiscard]] T& peek() {
+            if (isEmpty()) {
+                throw std::runtime_error("Cannot peek empty queue");
+            }
+            return m_Buffer[m_Head];
+        }
+
+        /**
+         * Peek the front of the queue.
+         * @return Const reference to the front of the queue
+         * @throw std::runtime_error if queue is empty
+         */
+        [[nodiscard]] const T& peek() const {
+            if (isEmpty()) {
+                throw std::runtime_error("Cannot peek empty queue");
+            }
+            return m_Buffer[m_Head];
+        }
+
+        /**
+         * Enqueue an element to the back of the queue
+         * @param element
+         */
+        void enqueue(const T& element) {
+            emplace(element);
+        }
+
+        /**
+         * Enqueue an element to the back of the queue
+         * @param element
+         */
+        void enqueue(T&& element) {
+            emplace(std::move(element));
+        }
+
+        /**
+         * Enqueue an element to the back of the queue in-place.
+         * @tparam Ts
+         * @param args
+         * @return Reference to the constructed element
+         */
+        template<typename ... Ts>
+        T& emplace(Ts&& ... args) {
+            if (m_Size == m_Capacity) {
+                // The arguments may refer to elements of the queue, so the new element is constructed before they move
+                T* element = nullptr;
+                reAllocate(grownCapacity(1), [&](T* position) {
+                    element = new(position) T(std::forward<Ts>(args)...);
+                });
+                m_Size++;
+                return *element;
+            }
+            T* element = new(&m_Buffer[wrap(m_Head + m_Size)]) T(std::forward<Ts>(args)...);
+            m_Size++;
+            return *element;
+        }
+
+        /**
+         * Enqueue the elements of a range to the back of the queue, in order. If the iterators are at least forward
+         * iterators, the buffer is grown at most once for the whole range.
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void enqueueRange(Iterator first, Iterator last) {
+            using Category = typename std::iterator_traits<Iterator>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+                std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+                if (m_Size + count > m_Capacity) {
+                    // The range may be inside the queue, so it is copied before the elements move
+                    reAllocate(grownCapacity(count), [&](T* position) {
+                        std::size_t constructed = 0;
+                        try {
+                            for (; first != last; ++first) {
+                                new(&position[constructed]) T(*first);
+                                constructed++;
+                            }
+                        } catch (...) {
+                            for (std::size_t i = 0; i < constructed; i++) {
+                                position[i].~T();
+                            }
+                            throw;
+                        }
+                    });
+                    m_Size += count;
+                    return;
+                }
+                for (; first != last; ++first) {
+                    new(&m_Buffer[wrap(m_Head + m_Size)]) T(*first);
+                    m_Size++;
+                }
+            } else {
+                for (; first != last; ++first) {
+                    emplace(*first);
+                }
+            }
+        }
+
+        /**
+         * Remove the element at the front of the queue.
+         * @throw std::runtime_error if queue is empty
+         */
+        void dequeue() {
+            if (isEmpty()) {
+                throw std::runtime_error("Cannot dequeue empty queue");
+            }
+            m_Buffer[m_Head].~T();
+            m_Head = wrap(m_Head + 1);
+            m_Size--;
+        }
+
+        /**
+         * Move the element at the front of the queue out and remove it, if the queue is not empty.
+         * @param element Assigned the front element
+         * @return True if an element was dequeued, false if the queue is empty.
+         */
+        bool tryDequeue(T& element) noexcept(std::is_nothrow_move_assignable_v<T>) {
+            if (isEmpty()) {
+                return false;
+            }
+            element = std::move(m_Buffer[m_Head]);
+            m_Buffer[m_Head].~T();
+            m_Head = wrap(m_Head + 1);
+            m_Size--;
+            return true;
+        }
+
+        /**
+         * Move elements from the front of the queue to an output iterator, in order, removing them from the queue.
+         * The buffer is kept, so that the queue can be refilled without allocating. Each element is removed as soon
+         * as it is written, so if writing one throws, the elements before it have been dequeued and it is still at
+         * the front of the queue.
+         * @tparam OutputIterator
+         * @param out
+         * @param maxCount Maximum number of elements to dequeue
+         * @return Number of elements dequeued
+         */
+        template<typename OutputIterator>
+        std::size_t drainInto(OutputIterator out, std::size_t maxCount = std::numeric_limits<std::size_t>::max()) {
+            std::size_t count = std::min(maxCount, m_Size);
+            for (std::size_t i = 0; i < count; i++) {
+                *out = std::move(m_Buffer[m_Head]);
+                ++out;
+                m_Buffer[m_Head].~T();
+                m_Head = wrap(m_Head + 1);
+                m_Size--;
+            }
+            if (m_Size == 0) {
+                m_Head = 0;
+            }
+            return count;
+        }
+
+        /**
+         * Make sure that the specified number of elements can be stored without reallocating. The capacity is
+         * rounded up to a power of 2.
+         * @param capacity
+         */
+        void reserve(std::size_t capacity) {
+            if (capacity > m_Size) {
+                growFor(capacity - m_Size);
+            }
+        }
+
+        /**
+         * Shrink the buffer to the smallest power of 2 that holds the elements, or free it if the queue is empty.
+         */
+        void shrinkToFit() {
+            if (m_Size == 0) {
+                ::operator delete(m_Buffer, m_Capacity * sizeof(T));
+                m_Buffer = nullptr;
+                m_Capacity = 0;
+                m_Head = 0;
+                return;
+            }
+            std::size_t newCapacity = MINIMUM_CAPACITY;
+            while (newCapacity < m_Size) {
+                newCapacity *= 2;
+            }
+            if (newCapacity < m_Capacity) {
+                reAllocate(newCapacity);
+            }
+        }
+
+        /**
+         * Clear the queue. Size is reset to 0, and the buffer is kept for reuse.
+         */
+        void clear() noexcept {
+            destroyAll();
+            m_Head = 0;
+            m_Size = 0;
+        }
+
+        /**
+         * Destructor
+         */
+        ~RingQueue() {
+            destroyAll();
+            ::operator delete(m_Buffer, m_Capacity * sizeof(T));
+        }
+
+    };
+
+}
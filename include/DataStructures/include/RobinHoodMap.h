@@ -0,0 +1,519 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "impl/DataStructuresImpl.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace wtl {
+
+    /**
+     * A hashmap that uses closed hashing/open addressing with Robin Hood hashing. Linear probing is used, but on
+     * insertion an element that is further away from its home bucket takes the slot of an element that is closer
+     * to its own home bucket. This keeps the variance of probe lengths low.
+     * Unlike the ClosedMap, the number of buckets is a power of 2 and grows without limit, and removal shifts the
+     * following elements backwards instead of leaving deleted markers behind.
+     * Supports average O(1) time insertion, searching and removing.
+     * @tparam K
+     * @tparam V
+     * @tparam Hash
+     */
+    template<typename K, typename V, typename Hash = std::hash<K>>
+    class RobinHoodMap {
+    public:
+
+        /**
+         * Probe lengths of the elements currently in the map. The probe length of an element is the number of
+         * slots that a successful lookup for it examines.
+         */
+        struct ProbeStatistics {
+
+            /// Longest probe length
+            std::size_t m_MaximumProbeLength = 0;
+
+            /// Mean probe length over all the elements
+            double m_AverageProbeLength = 0;
+
+            /// Number of elements for each probe length, indexed by probe length
+            std::vector<std::size_t> m_Histogram;
+        };
+
+    private:
+
+        typedef std::pair<K, V> KeyValuePair;
+        typedef std::pair<std::reference_wrapper<const K>, std::reference_wrapper<V>> KeyValuePairResult;
+
+        static constexpr std::size_t MINIMUM_BUCKET_COUNT = 8;
+        static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+        /// Number of elements
+        std::size_t m_Size = 0;
+
+        /// Number of buckets. Always a power of 2.
+        std::size_t m_BucketCount = 0;
+
+        /// Buckets represented as a array of values
+        KeyValuePair* m_Buckets = nullptr;
+
+        /// Probe length of the element in each bucket. 0 if the bucket is empty.
+        std::uint32_t* m_ProbeLengths = nullptr;
+
+        /// Hashing algorithm
+        Hash m_Hash;
+
+        /**
+         * Check if the load factor would exceed 7/8 with the specified number of elements.
+         * @param size
+         * @param bucketCount
+         * @return
+         */
+        [[nodiscard]] static bool overloaded(std::size_t size, std::size_t bucketCount) noexcept {
+            return size * 8 > bucketCount * 7;
+        }
+
+        /**
+         * Home bucket of a key.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::size_t homeOf(const K& key) const noexcept {
+            return impl::ds::mixHash(m_Hash(key)) & (m_BucketCount - 1);
+        }
+
+        /**
+         * Allocate uninitialised storage for the specified number of buckets, with every bucket empty.
+         * @param bucketCount
+         */
+        void allocate(std::size_t bucketCount) {
+            m_BucketCount = bucketCount;
+            m_Buckets = (KeyValuePair*) ::operator new(bucketCount * sizeof(KeyValuePair));
+            m_ProbeLengths = new std::uint32_t[bucketCount]();
+        }
+
+        /**
+         * Destroy all elements and free the storage.
+         */
+        void deallocate() noexcept {
+            for (std::size_t i = 0; i < m_BucketCount; i++) {
+                if (m_ProbeLengths[i] != 0) {
+                    m_Buckets[i].~KeyValuePair();
+                }
+            }
+            ::operator delete(m_Buckets, m_BucketCount * sizeof(KeyValuePair));
+            delete[] m_ProbeLengths;
+            m_Buckets = nullptr;
+            m_ProbeLengths = nullptr;
+        }
+
+        /**
+         * Copy the elements of another RobinHoodMap into freshly allocated storage.
+         * @param other
+         */
+        void copyFrom(const RobinHoodMap& other) {
+            m_Size = other.m_Size;
+            allocate(other.m_BucketCount);
+            for (std::size_t i = 0; i < m_BucketCount; i++) {
+                m_ProbeLengths[i] = other.m_ProbeLengths[i];
+                if (m_ProbeLengths[i] != 0) {
+                    new(&m_Buckets[i]) KeyValuePair(other.m_Buckets[i]);
+                }
+            }
+        }
+
+        /**
+         * Find the bucket holding the key. The search stops as soon as it reaches a bucket whose element is closer
+         * to its home bucket than the key would be, since Robin Hood insertion would have placed the key there.
+         * @param key
+         * @return Index of the bucket, or NOT_FOUND if the key does not exist
+         */
+        [[nodiscard]] std::size_t findIndex(const K& key) const noexcept {
+            std::size_t mask = m_BucketCount - 1;
+            std::size_t index = homeOf(key);
+            for (std::uint32_t probeLength = 1; probeLength <= m_ProbeLengths[index]; probeLength++) {
+                if (probeLength == m_ProbeLengths[index] && m_Buckets[index].first == key) {
+                    return index;
+                }
+                index = (index + 1) & mask;
+            }
+            return NOT_FOUND;
+        }
+
+        /**
+         * Place a key-value pair that is known not to exist in the map, displacing elements that are closer to their
+         * home bucket along the way. There must be at least one empty bucket.
+         * @param pair
+         * @return Index of the bucket the pair was placed in
+         */
+        std::size_t place(KeyValuePair&& pair) {
+            std::size_t mask = m_BucketCount - 1;
+            std::size_t index = homeOf(pair.first);
+            std::uint32_t probeLength = 1;
+            while (m_ProbeLengths[index] >= probeLength) {
+                index = (index + 1) & mask;
+                ++probeLength;
+            }
+            std::size_t placedIndex = index;
+            if (m_ProbeLengths[index] == 0) {
+                new(&m_Buckets[index]) KeyValuePair(std::move(pair));
+                m_ProbeLengths[index] = probeLength;
+                return placedIndex;
+            }
+            // Take the slot of a richer element, then carry that element forward until an empty bucket is found
+            KeyValuePair carry(std::move(m_Buckets[index]));
+            m_Buckets[index] = std::move(pair);
+            std::swap(probeLength, m_ProbeLengths[index]);
+            while (true) {
+                index = (index + 1) & mask;
+                ++probeLength;
+                if (m_ProbeLengths[index] == 0) {
+                    new(&m_Buckets[index]) KeyValuePair(std::move(carry));
+                    m_ProbeLengths[index] = probeLength;
+                    return placedIndex;
+                }
+                if (m_ProbeLengths[index] < probeLength) {
+                    std::swap(carry, m_Buckets[index]);
+                    std::swap(probeLength, m_ProbeLengths[index]);
+                }
+            }
+        }
+
+        /**
+         * Move every element into a new table with the specified number of buckets.
+         * @param bucketCount
+         */
+        void rehash(std::size_t bucketCount) {
+            KeyValuePair* oldBuckets = m_Buckets;
+            std::uint32_t* oldProbeLengths = m_ProbeLengths;
+            std::size_t oldBucketCount = m_BucketCount;
+            allocate(bucketCount);
+            for (std::size_t i = 0; i < oldBucketCount; i++) {
+                if (oldProbeLengths[i] != 0) {
+                    place(std::move(oldBuckets[i]));
+                    oldBuckets[i].~KeyValuePair();
+                }
+            }
+            ::operator delete(oldBuckets, oldBucketCount * sizeof(KeyValuePair));
+            delete[] oldProbeLengths;
+        }
+
+        /**
+         * Double the number of buckets if inserting another element would exceed the maximum load factor.
+         */
+        void expand() {
+            if (overloaded(m_Size + 1, m_BucketCount)) {
+                rehash(m_BucketCount * 2);
+            }
+        }
+
+        /**
+         * Find the bucket of the key, or insert a new key-value pair constructed from the arguments.
+         * @tparam Ts
+         * @param key
+         * @param args Arguments used to construct the value, only if the key does not exist
+         * @return Index of the bucket and whether insertion occurred
+         */
+        template<typename ... Ts>
+        std::pair<std::size_t, bool> findOrInsert(const K& key, Ts&& ... args) {
+            std::size_t index = findIndex(key);
+            if (index != NOT_FOUND) {
+                return {index, false};
+            }
+            expand();
+            index = place(KeyValuePair(std::piecewise_construct, std::forward_as_tuple(key),
+                                       std::forward_as_tuple(std::forward<Ts>(args)...)));
+            ++m_Size;
+            return {index, true};
+        }
+
+        /**
+         * Smallest number of buckets that can hold the specified number of elements.
+         * @param size
+         * @return
+         */
+        [[nodiscard]] static std::size_t bucketCountFor(std::size_t size) noexcept {
+            std::size_t bucketCount = MINIMUM_BUCKET_COUNT;
+            while (overloaded(size, bucketCount)) {
+                bucketCount *= 2;
+            }
+            return bucketCount;
+        }
+
+    public:
+
+        /**
+         * Constructor
+         */
+        RobinHoodMap() {
+            allocate(MINIMUM_BUCKET_COUNT);
+        }
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        RobinHoodMap(const RobinHoodMap& other) {
+            copyFrom(other);
+        }
+
+        /**
+         * Copy assignment
+         * @param other
+         * @return
+         */
+        RobinHoodMap& operator=(const RobinHoodMap& other) {
+            if (this != &other) {
+                deallocate();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of elements
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Check if container is empty
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return m_Size == 0;
+        }
+
+        /**
+         * Get the number of buckets
+         * @return
+         */
+        [[nodiscard]] std::size_t getBucketCount() const noexcept {
+            return m_BucketCount;
+        }
+
+        /**
+         * Get the average load factor.
+         * @return
+         */
+        [[nodiscard]] double getLoadFactor() const noexcept {
+            return static_cast<double>(m_Size) / static_cast<double>(m_BucketCount);
+        }
+
+        /**
+         * Get the distribution of probe lengths of the elements currently stored. Takes O(number of buckets) time.
+         * @return
+         */
+        [[nodiscard]] ProbeStatistics getProbeStatistics() const {
+            ProbeStatistics statistics;
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < m_BucketCount; i++) {
+                std::size_t probeLength = m_ProbeLengths[i];
+                if (probeLength == 0) {
+                    continue;
+                }
+                if (probeLength >= statistics.m_Histogram.size()) {
+                    statistics.m_Histogram.resize(probeLength + 1, 0);
+                }
+                ++statistics.m_Histogram[probeLength];
+                total += probeLength;
+                if (probeLength > statistics.m_MaximumProbeLength) {
+                    statistics.m_MaximumProbeLength = probeLength;
+                }
+            }
+            if (m_Size > 0) {
+                statistics.m_AverageProbeLength = static_cast<double>(total) / static_cast<double>(m_Size);
+            }
+            return statistics;
+        }
+
+        /**
+         * Returns a reference to the value with the specified key, wrapped in a std::optional.
+         * If the key was not found, then std::nullopt is returned.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const K& key) noexcept {
+            std::size_t index = findIndex(key);
+            if (index == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Buckets[index].second;
+        }
+
+        /**
+         * Returns a const reference to the value with the specified key, wrapped in a std::optional.
+         * If the key was not found, then std::nullopt is returned.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const K& key) const noexcept {
+            std::size_t index = findIndex(key);
+            if (index == NOT_FOUND) {
+                return std::nullopt;
+            }
+            return m_Buckets[index].second;
+        }
+
+        /**
+         * Check if a key exists in the container.
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        [[nodiscard]] bool contains(const K& key) const noexcept {
+            return findIndex(key) != NOT_FOUND;
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens. The return value is a pair which consists
+         * of KeyValuePairResult and bool. The bool is true if insertion occurred, false if not.
+         * If insertion occurred, then the KeyValuePairResult is a pair with const reference to the key and reference
+         * to the inserted value.
+         * If no insertion occurred, then the KeyValuePairResult is a pair with const reference to the key and reference
+         * to the already existing element preventing the insertion.
+         * References are invalidated by any subsequent insertion or removal.
+         * @param key
+         * @param value
+         * @return stl pair consisting of KeyValuePairResult and bool.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, const V& value) {
+            auto[index, inserted] = findOrInsert(key, value);
+            return {{m_Buckets[index].first, m_Buckets[index].second}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @see insert(const K&, const V&)
+         * @param key
+         * @param value
+         * @return stl pair consisting of KeyValuePairResult and bool.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, V&& value) {
+            auto[index, inserted] = findOrInsert(key, std::move(value));
+            return {{m_Buckets[index].first, m_Buckets[index].second}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the existing value is replaced by the new value, else it is
+         * simply inserted as per normal.
+         * The return value is a pair of KeyValuePairResult and bool. The bool is true if insertion occurred, false if
+         * replacement occurred. The KeyValuePairResult is a pair with const reference to the key and reference
+         * to the value.
+         * @param key
+         * @param value
+         * @return
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, const V& value) {
+            auto[index, inserted] = findOrInsert(key, value);
+            if (!inserted) {
+                m_Buckets[index].second = value;
+            }
+            return {{m_Buckets[index].first, m_Buckets[index].second}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the existing value is replaced by the new value.
+         * @see insertOrReplace(const K&, const V&)
+         * @param key
+         * @param value
+         * @return
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, V&& value) {
+            std::size_t index = findIndex(key);
+            if (index != NOT_FOUND) {
+                m_Buckets[index].second = std::move(value);
+                return {{m_Buckets[index].first, m_Buckets[index].second}, false};
+            }
+            return insert(key, std::move(value));
+        }
+
+        /**
+         * Construct a value in-place if the key does not already exist. If it does, nothing occurs.
+         * @see insert(...)
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return
+         */
+        template<typename ... Ts>
+        std::pair<KeyValuePairResult, bool> emplace(const K& key, Ts&& ... args) {
+            auto[index, inserted] = findOrInsert(key, std::forward<Ts>(args)...);
+            return {{m_Buckets[index].first, m_Buckets[index].second}, inserted};
+        }
+
+        /**
+         * Erase key-value pair with specified key. The elements following it are shifted one bucket backwards until
+         * an empty bucket or an element in its home bucket is reached, so no deleted markers are left behind.
+         * @param key
+         * @return True if key was found and key-value pair was removed, false if not.
+         */
+        bool erase(const K& key) noexcept {
+            std::size_t index = findIndex(key);
+            if (index == NOT_FOUND) {
+                return false;
+            }
+            std::size_t mask = m_BucketCount - 1;
+            std::size_t next = (index + 1) & mask;
+            while (m_ProbeLengths[next] > 1) {
+                m_Buckets[index] = std::move(m_Buckets[next]);
+                m_ProbeLengths[index] = m_ProbeLengths[next] - 1;
+                index = next;
+                next = (next + 1) & mask;
+            }
+            m_Buckets[index].~KeyValuePair();
+            m_ProbeLengths[index] = 0;
+            --m_Size;
+            return true;
+        }
+
+        /**
+         * Make sure that the specified number of elements can be stored without rehashing.
+         * @param size
+         */
+        void reserve(std::size_t size) {
+            std::size_t bucketCount = bucketCountFor(size);
+            if (bucketCount > m_BucketCount) {
+                rehash(bucketCount);
+            }
+        }
+
+        /**
+         * Shrink the container.
+         * @return True if rehashing was done, false if not
+         */
+        bool shrinkToFit() {
+            std::size_t bucketCount = bucketCountFor(m_Size);
+            if (bucketCount < m_BucketCount) {
+                rehash(bucketCount);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Remove all elements in the container. Sets size back to 0.
+         */
+        void clear() noexcept {
+            deallocate();
+            m_Size = 0;
+            allocate(MINIMUM_BUCKET_COUNT);
+        }
+
+        /**
+         * Destructor
+         */
+        ~RobinHoodMap() {
+            deallocate();
+        }
+
+    };
+
+}
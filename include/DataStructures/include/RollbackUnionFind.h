@@ -0,0 +1,182 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace wtl {
+
+    /**
+     * Union find (dis-joint set) data structure whose joins can be undone.
+     * Join operation is carried out by size, and no path compression is done, so that every join changes exactly one
+     * parent pointer and one size, and the tree is O(logn) tall. Find and check if connected are O(logn).
+     * A snapshot is the number of joins done so far, and rolling back to it undoes every join after it, in O(1) per
+     * join undone, instead of copying the whole union find.
+     */
+    class RollbackUnionFind {
+    public:
+
+        /**
+         * Point to roll back to, as returned by snapshot()
+         */
+        using Snapshot = std::size_t;
+
+    private:
+
+        // The value inside each index is the parent node of that index.
+        std::vector<std::size_t> m_Graph;
+
+        // Number of nodes in the tree of each root node.
+        std::vector<std::size_t> m_TreeSize;
+
+        // Root node linked under another root by each join, in order
+        std::vector<std::size_t> m_History;
+
+        // Number of disjoint sets.
+        std::size_t m_NumberOfSets = 0;
+
+        /**
+         * Check if an index is out of bounds.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] bool outOfBounds(std::size_t index) const noexcept {
+            return index >= m_Graph.size();
+        }
+
+        /**
+         * Find the root of a node, which must be valid.
+         * @param node
+         * @return
+         */
+        [[nodiscard]] std::size_t root(std::size_t node) const noexcept {
+            while (node != m_Graph[node]) {
+                node = m_Graph[node];
+            }
+            return node;
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param size Number of nodes in the RollbackUnionFind
+         */
+        explicit RollbackUnionFind(std::size_t size) : m_Graph(size), m_TreeSize(size, 1), m_NumberOfSets(size) {
+            if (size <= 0) {
+                throw std::invalid_argument("Size of union find cannot be less than 1");
+            }
+            for (std::size_t i = 0; i < size; i++) {
+                m_Graph[i] = i;
+            }
+        }
+
+        /**
+         * Get the number of nodes.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Graph.size();
+        }
+
+        /**
+         * Get the number of disjoint sets. The range of values are [1, size].
+         * @return
+         */
+        [[nodiscard]] std::size_t getSets() const noexcept {
+            return m_NumberOfSets;
+        }
+
+        /**
+         * Find which set a node belongs to.
+         * @param node
+         * @return Root node of the specified node
+         */
+        [[nodiscard]] std::size_t belongs(std::size_t node) const {
+            if (outOfBounds(node)) {
+                throw std::invalid_argument("Invalid node");
+            }
+            return root(node);
+        }
+
+        /**
+         * Union two nodes' group together.
+         * Union does not occur if both nodes have the same root node. Otherwise, the root of the smaller tree is linked
+         * under the root of the larger tree. If both are of equal size, then node1's root becomes the overall root.
+         * @param node1
+         * @param node2
+         * @return True if the union occurred
+         */
+        bool join(std::size_t node1, std::size_t node2) {
+            if (outOfBounds(node1) || outOfBounds(node2)) {
+                throw std::invalid_argument("Invalid node");
+            }
+            std::size_t node1parent = root(node1);
+            std::size_t node2parent = root(node2);
+            if (node1parent == node2parent) {
+                return false;
+            }
+            if (m_TreeSize[node1parent] < m_TreeSize[node2parent]) {
+                std::swap(node1parent, node2parent);
+            }
+            // Recorded first, so that a join whose history cannot grow leaves the union find unchanged
+            m_History.push_back(node2parent);
+            m_Graph[node2parent] = node1parent;
+            m_TreeSize[node1parent] += m_TreeSize[node2parent];
+            --m_NumberOfSets;
+            return true;
+        }
+
+        /**
+         * Check if 2 nodes are connected
+         * @param node1
+         * @param node2
+         * @return True if they are connected
+         */
+        [[nodiscard]] bool connected(std::size_t node1, std::size_t node2) const {
+            if (outOfBounds(node1) || outOfBounds(node2)) {
+                throw std::invalid_argument("Invalid node");
+            }
+            return root(node1) == root(node2);
+        }
+
+        /**
+         * Get the current point to roll back to.
+         * @return
+         */
+        [[nodiscard]] Snapshot snapshot() const noexcept {
+            return m_History.size();
+        }
+
+        /**
+         * Undo every join that occurred after a snapshot was taken. A snapshot can no longer be used once the union
+         * find has been rolled back past it.
+         * @param snapshot
+         */
+        void rollback(Snapshot snapshot) {
+            if (snapshot > m_History.size()) {
+                throw std::invalid_argument("Invalid snapshot");
+            }
+            while (m_History.size() > snapshot) {
+                std::size_t child = m_History.back();
+                m_History.pop_back();
+                std::size_t parent = m_Graph[child];
+                m_TreeSize[parent] -= m_TreeSize[child];
+                m_Graph[child] = child;
+                ++m_NumberOfSets;
+            }
+        }
+
+        /**
+         * Destructor
+         */
+        ~RollbackUnionFind() = default;
+
+    };
+
+}
@@ -0,0 +1,441 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "impl/DataStructuresImpl.h"
+#include "RangeOperations.h"
+
+namespace wtl {
+
+    /**
+     * Update that adds a value to every element of a range of a SegmentTree. The monoid must be RangeSum, RangeMin
+     * or RangeMax, since adding a value does not distribute over the others.
+     * @tparam T
+     * @tparam Monoid
+     */
+    template<typename T, typename Monoid>
+    struct RangeAdd {
+
+        using Update = T;
+
+        static Update identity() {
+            return T();
+        }
+
+        /**
+         * Combine two updates into one.
+         * @param later Update that is applied after earlier
+         * @param earlier
+         * @return
+         */
+        Update compose(const Update& later, const Update& earlier) const {
+            return later + earlier;
+        }
+
+        /**
+         * Apply an update to the result of the monoid over a range.
+         * @param update
+         * @param value
+         * @param length Number of elements in the range
+         * @return
+         */
+        T apply(const Update& update, const T& value, std::size_t length) const {
+            if constexpr (std::is_same_v<Monoid, RangeSum<T>>) {
+                return value + update * static_cast<T>(length);
+            } else {
+                static_assert(std::is_same_v<Monoid, RangeMin<T>> || std::is_same_v<Monoid, RangeMax<T>>,
+                              "RangeAdd only supports RangeSum, RangeMin and RangeMax");
+                return value + update;
+            }
+        }
+    };
+
+    /**
+     * Update that sets every element of a range of a SegmentTree to a value. The monoid must be RangeSum or one of
+     * the idempotent monoids RangeMin, RangeMax, RangeGcd, RangeBitAnd or RangeBitOr, since the result over a range
+     * of equal elements is only known for those.
+     * @tparam T
+     * @tparam Monoid
+     */
+    template<typename T, typename Monoid>
+    struct RangeAssign {
+
+        /// The value to assign, or no value if the update does nothing
+        using Update = std::optional<T>;
+
+        static Update identity() {
+            return std::nullopt;
+        }
+
+        /**
+         * Combine two updates into one.
+         * @param later Update that is applied after earlier
+         * @param earlier
+         * @return
+         */
+        Update compose(const Update& later, const Update& earlier) const {
+            return later.has_value() ? later : earlier;
+        }
+
+        /**
+         * Apply an update to the result of the monoid over a range.
+         * @param update
+         * @param value
+         * @param length Number of elements in the range
+         * @return
+         */
+        T apply(const Update& update, const T& value, std::size_t length) const {
+            if (!update.has_value()) {
+                return value;
+            }
+            if constexpr (std::is_same_v<Monoid, RangeSum<T>>) {
+                return *update * static_cast<T>(length);
+            } else {
+                static_assert(std::is_same_v<Monoid, RangeMin<T>> || std::is_same_v<Monoid, RangeMax<T>> ||
+                              std::is_same_v<Monoid, RangeGcd<T>> || std::is_same_v<Monoid, RangeBitAnd<T>> ||
+                              std::is_same_v<Monoid, RangeBitOr<T>>,
+                              "RangeAssign only supports RangeSum and idempotent monoids");
+                return *update;
+            }
+        }
+    };
+
+    /**
+     * A segment tree supports updating a range of elements and querying the result of a monoid over a range of
+     * elements, both in O(logn) time complexity. Updates are kept at the highest nodes they cover and are pushed down
+     * to the children of a node only when a later operation goes through it.
+     * The monoid is an associative operation with an identity element, such as RangeSum, RangeMin or RangeMax. The
+     * lazy operation describes the updates, such as RangeAdd or RangeAssign, and must distribute over the monoid.
+     * A user-defined lazy operation provides an Update type and identity(), compose(later, earlier) and
+     * apply(update, value, length) member functions, like RangeAdd.
+     * The tree is iterative and bottom-up. Its nodes are kept in heap order, padded to a power of 2 leaves, so the
+     * two children of a node are next to each other in memory. The values are kept apart from the pending updates,
+     * so that queries, which only read values, touch as few cache lines as possible.
+     * Querying and searching push pending updates down, so they modify the tree and are not const.
+     * Segment tree is indexed [0, size - 1], like an original array.
+     * @tparam T
+     * @tparam Monoid Type of associative binary operation with an identity
+     * @tparam LazyOp Type of range update
+     */
+    template<typename T, typename Monoid = RangeSum<T>, typename LazyOp = RangeAdd<T, Monoid>>
+    class SegmentTree {
+    public:
+
+        using Update = typename LazyOp::Update;
+
+    private:
+
+        /// Number of elements
+        std::size_t m_Size = 0;
+
+        /// Number of leaves, a power of 2
+        std::size_t m_Leaves = 0;
+
+        /// Number of levels above the leaves
+        std::size_t m_Height = 0;
+
+        /// Values of the nodes in heap order, where node 1 is the root, the children of node k are 2k and 2k + 1,
+        /// and the leaves are m_Leaves to 2 * m_Leaves - 1. Node 0 is unused.
+        std::vector<T> m_Values;
+
+        /// Pending update of each node that is not a leaf, in the same order
+        std::vector<Update> m_Lazy;
+
+        /// If the pending update of a node has not been pushed down yet, so that pushing can be skipped for most nodes
+        std::vector<unsigned char> m_Pending;
+
+        /// Monoid object
+        Monoid m_Monoid;
+
+        /// Lazy operation object
+        LazyOp m_LazyOp;
+
+        void initialise(std::size_t size) {
+            if (size == 0) {
+                throw std::invalid_argument("Cannot construct empty segment tree");
+            }
+            m_Size = size;
+            m_Height = size > 1 ? impl::ds::floorLog2(size - 1) + 1 : 0;
+            m_Leaves = std::size_t(1) << m_Height;
+            m_Values.assign(2 * m_Leaves, m_Monoid.identity());
+            m_Lazy.assign(m_Leaves, m_LazyOp.identity());
+            m_Pending.assign(m_Leaves, 0);
+        }
+
+        void checkRange(std::size_t startIndex, std::size_t endIndex) const {
+            if (startIndex >= m_Size || endIndex >= m_Size || startIndex > endIndex) {
+                throw std::invalid_argument("Index out of range");
+            }
+        }
+
+        /**
+         * Recompute the value of a node from its children.
+         * @param node
+         */
+        void pull(std::size_t node) {
+            m_Values[node] = m_Monoid(m_Values[2 * node], m_Values[2 * node + 1]);
+        }
+
+        /**
+         * Apply an update to a node, and keep it to be pushed down later if the node is not a leaf.
+         * @param node
+         * @param update
+         */
+        void applyTo(std::size_t node, const Update& update) {
+            std::size_t length = m_Leaves >> impl::ds::floorLog2(node);
+            m_Values[node] = m_LazyOp.apply(update, m_Values[node], length);
+            if (node < m_Leaves) {
+                m_Lazy[node] = m_LazyOp.compose(update, m_Lazy[node]);
+                m_Pending[node] = 1;
+            }
+        }
+
+        /**
+         * Push the pending update of a node down to its children.
+         * @param node
+         */
+        void push(std::size_t node) {
+            if (!m_Pending[node]) {
+                return;
+            }
+            applyTo(2 * node, m_Lazy[node]);
+            applyTo(2 * node + 1, m_Lazy[node]);
+            m_Lazy[node] = m_LazyOp.identity();
+            m_Pending[node] = 0;
+        }
+
+        /**
+         * Push pending updates down from the root to the boundaries of the half-open range of leaves [first, last).
+         * @param first
+         * @param last
+         */
+        void pushBoundaries(std::size_t first, std::size_t last) {
+            for (std::size_t level = m_Height; level > 0; level--) {
+                if (((first >> level) << level) != first) {
+                    push(first >> level);
+                }
+                if (((last >> level) << level) != last) {
+                    push((last - 1) >> level);
+                }
+            }
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * Construct a segment tree where every element is the identity of the monoid. This is only a useful start
+         * for RangeSum and similar monoids: the identity of RangeMin and RangeMax is the largest or lowest value of
+         * T, which a RangeAdd update overflows. Use the constructor taking a value for those.
+         * @param size Number of elements
+         */
+        explicit SegmentTree(std::size_t size) {
+            initialise(size);
+        }
+
+        /**
+         * Constructor
+         * Construct a segment tree where every element is the same value, in O(n) time.
+         * @param size Number of elements
+         * @param value
+         */
+        SegmentTree(std::size_t size, const T& value) {
+            initialise(size);
+            std::fill_n(m_Values.begin() + static_cast<std::ptrdiff_t>(m_Leaves), size, value);
+            for (std::size_t node = m_Leaves - 1; node > 0; node--) {
+                pull(node);
+            }
+        }
+
+        /**
+         * Constructor
+         * Construct a segment tree using the elements in a stl container, in O(n) time.
+         * @tparam Iterator
+         * @param iteratorBegin Iterator pointing to the first element in the stl container
+         * @param iteratorEnd Iterator pointing to the past-the-end element of the stl container
+         */
+        template<typename Iterator, typename = typename std::iterator_traits<Iterator>::iterator_category>
+        SegmentTree(Iterator iteratorBegin, Iterator iteratorEnd) {
+            initialise(static_cast<std::size_t>(std::distance(iteratorBegin, iteratorEnd)));
+            for (std::size_t i = m_Leaves; iteratorBegin != iteratorEnd; ++iteratorBegin, i++) {
+                m_Values[i] = *iteratorBegin;
+            }
+            for (std::size_t node = m_Leaves - 1; node > 0; node--) {
+                pull(node);
+            }
+        }
+
+        /**
+         * Get the number of elements in the segment tree
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Retrieve the value of a single index position of the array.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] T retrieve(std::size_t index) {
+            checkRange(index, index);
+            index += m_Leaves;
+            for (std::size_t level = m_Height; level > 0; level--) {
+                push(index >> level);
+            }
+            return m_Values[index];
+        }
+
+        /**
+         * Replace the value of an index position of the array.
+         * @param index
+         * @param value
+         */
+        void replace(std::size_t index, const T& value) {
+            checkRange(index, index);
+            index += m_Leaves;
+            for (std::size_t level = m_Height; level > 0; level--) {
+                push(index >> level);
+            }
+            m_Values[index] = value;
+            for (std::size_t level = 1; level <= m_Height; level++) {
+                pull(index >> level);
+            }
+        }
+
+        /**
+         * Query between two inclusive indexes.
+         * @param startIndex
+         * @param endIndex
+         * @return Result of the monoid over the elements from startIndex to endIndex, in order
+         */
+        [[nodiscard]] T query(std::size_t startIndex, std::size_t endIndex) {
+            checkRange(startIndex, endIndex);
+            std::size_t first = startIndex + m_Leaves;
+            std::size_t last = endIndex + 1 + m_Leaves;
+            pushBoundaries(first, last);
+            T left = m_Monoid.identity();
+            T right = m_Monoid.identity();
+            for (; first < last; first >>= 1, last >>= 1) {
+                if (first & 1) {
+                    left = m_Monoid(left, m_Values[first++]);
+                }
+                if (last & 1) {
+                    right = m_Monoid(m_Values[--last], right);
+                }
+            }
+            return m_Monoid(left, right);
+        }
+
+        /**
+         * Query all the elements.
+         * @return Result of the monoid over every element, in order
+         */
+        [[nodiscard]] T queryAll() const {
+            return m_Values[1];
+        }
+
+        /**
+         * Apply an update to an index position of the array.
+         * @param index
+         * @param update
+         */
+        void update(std::size_t index, const Update& update) {
+            this->update(index, index, update);
+        }
+
+        /**
+         * Apply an update to every index position from startIndex (inclusive) to endIndex (inclusive).
+         * @param startIndex
+         * @param endIndex
+         * @param update
+         */
+        void update(std::size_t startIndex, std::size_t endIndex, const Update& update) {
+            checkRange(startIndex, endIndex);
+            std::size_t first = startIndex + m_Leaves;
+            std::size_t last = endIndex + 1 + m_Leaves;
+            pushBoundaries(first, last);
+            for (std::size_t left = first, right = last; left < right; left >>= 1, right >>= 1) {
+                if (left & 1) {
+                    applyTo(left++, update);
+                }
+                if (right & 1) {
+                    applyTo(--right, update);
+                }
+            }
+            for (std::size_t level = 1; level <= m_Height; level++) {
+                if (((first >> level) << level) != first) {
+                    pull(first >> level);
+                }
+                if (((last >> level) << level) != last) {
+                    pull((last - 1) >> level);
+                }
+            }
+        }
+
+        /**
+         * Binary search for the end of the longest range starting at startIndex whose result satisfies a predicate,
+         * in O(logn) time. The predicate must hold for the identity of the monoid, and once it fails for a range it
+         * must fail for every longer range starting at the same index, e.g. "the sum is at most k".
+         * @tparam Predicate Callable taking a const T& and returning bool
+         * @param startIndex
+         * @param predicate
+         * @return First index at which the predicate fails for the range from startIndex to it, or the number of
+         * elements if it never fails
+         */
+        template<typename Predicate>
+        [[nodiscard]] std::size_t maxRight(std::size_t startIndex, Predicate predicate) {
+            if (startIndex > m_Size) {
+                throw std::invalid_argument("Index out of range");
+            }
+            if (startIndex == m_Size) {
+                return m_Size;
+            }
+            std::size_t node = startIndex + m_Leaves;
+            for (std::size_t level = m_Height; level > 0; level--) {
+                push(node >> level);
+            }
+            T sum = m_Monoid.identity();
+            do {
+                while ((node & 1) == 0) {
+                    node >>= 1;
+                }
+                T combined = m_Monoid(sum, m_Values[node]);
+                if (!predicate(combined)) {
+                    // Descend to the leaf where the predicate first fails
+                    while (node < m_Leaves) {
+                        push(node);
+                        node = 2 * node;
+                        combined = m_Monoid(sum, m_Values[node]);
+                        if (predicate(combined)) {
+                            sum = std::move(combined);
+                            node++;
+                        }
+                    }
+                    return std::min(node - m_Leaves, m_Size);
+                }
+                sum = std::move(combined);
+                node++;
+            } while ((node & (~node + 1)) != node);
+            return m_Size;
+        }
+
+        /**
+         * Destructor
+         */
+        ~SegmentTree() = default;
+    };
+
+}
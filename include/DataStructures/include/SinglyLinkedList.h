@@ -9,6 +9,8 @@
 #include <functional>
 #include <utility>
 #include <initializer_list>
+#include <type_traits>
+#include "NodePool.h"
 
 namespace wtl {
 
@@ -58,8 +60,11 @@ namespace wtl {
     /**
      * Singly linked list with O(1) access, insertion and removal of elements at the front.
      * @tparam T Type of element stored
+     * @tparam NodeAllocator HeapNodeAllocator to allocate each node on its own, or NodePool to carve nodes out of
+     * chunks. A NodePool keeps the memory of removed nodes until the container is destroyed, so a container that
+     * grows large and shrinks again keeps its peak memory.
      */
-    template<typename T>
+    template<typename T, template<typename> class NodeAllocator = wtl::HeapNodeAllocator>
     class SinglyLinkedList {
     private:
 
@@ -72,6 +77,9 @@ namespace wtl {
         /// Pointer to the front of the linked list
         SLLNode* m_Head = nullptr;
 
+        /// Allocator of the nodes
+        NodeAllocator<SLLNode> m_Nodes;
+
         /**
          * Check if index is out of bounds
          * @param index
@@ -114,7 +122,7 @@ namespace wtl {
          * Copy constructor
          * @param other
          */
-        SinglyLinkedList(const SinglyLinkedList<T>& other) {
+        SinglyLinkedList(const SinglyLinkedList& other) {
             SLLNode* ptr = other.m_Head;
             while (ptr != nullptr) {
                 appendBack(ptr->m_Data);
@@ -127,7 +135,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        SinglyLinkedList<T>& operator=(const SinglyLinkedList<T>& other) {
+        SinglyLinkedList& operator=(const SinglyLinkedList& other) {
             if (this != &other) {
                 clear();
                 SLLNode* ptr = other.m_Head;
@@ -143,7 +151,7 @@ namespace wtl {
          * Move constructor
          * @param other
          */
-        SinglyLinkedList(SinglyLinkedList<T>&& other) noexcept {
+        SinglyLinkedList(SinglyLinkedList&& other) noexcept : m_Nodes(std::move(other.m_Nodes)) {
             m_Size = other.m_Size;
             other.m_Size = 0;
             m_Head = other.m_Head;
@@ -155,9 +163,10 @@ namespace wtl {
          * @param other
          * @return
          */
-        SinglyLinkedList<T>& operator=(SinglyLinkedList<T>&& other) noexcept {
+        SinglyLinkedList& operator=(SinglyLinkedList&& other) noexcept {
             if (this != &other) {
                 clear();
+                m_Nodes = std::move(other.m_Nodes);
                 m_Size = other.m_Size;
                 other.m_Size = 0;
                 m_Head = other.m_Head;
@@ -287,7 +296,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool equals(const SinglyLinkedList<T>& other) const noexcept {
+        bool equals(const SinglyLinkedList& other) const noexcept {
             return (*this) == other;
         }
 
@@ -296,7 +305,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool notEquals(const SinglyLinkedList<T>& other) const noexcept {
+        bool notEquals(const SinglyLinkedList& other) const noexcept {
             return !((*this) == other);
         }
 
@@ -305,7 +314,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator==(const SinglyLinkedList<T>& other) const noexcept {
+        bool operator==(const SinglyLinkedList& other) const noexcept {
             if (m_Size != other.m_Size) {
                 return false;
             }
@@ -326,7 +335,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator!=(const SinglyLinkedList<T>& other) const noexcept {
+        bool operator!=(const SinglyLinkedList& other) const noexcept {
             return !(*this == other);
         }
 
@@ -361,9 +370,9 @@ namespace wtl {
          */
         void appendFront(const T& data) noexcept {
             if (isEmpty()) {
-                m_Head = new SLLNode(data);
+                m_Head = m_Nodes.create(data);
             } else {
-                auto* newHead = new SLLNode(data, m_Head);
+                auto* newHead = m_Nodes.create(data, m_Head);
                 m_Head = newHead;
             }
             m_Size++;
@@ -375,9 +384,9 @@ namespace wtl {
         */
         void appendFront(T&& data) noexcept {
             if (isEmpty()) {
-                m_Head = new SLLNode(std::move(data));
+                m_Head = m_Nodes.create(std::move(data));
             } else {
-                auto* newHead = new SLLNode(std::move(data), m_Head);
+                auto* newHead = m_Nodes.create(std::move(data), m_Head);
                 m_Head = newHead;
             }
             m_Size++;
@@ -392,9 +401,9 @@ namespace wtl {
         template<typename... Ts>
         T& emplaceFront(Ts&& ... args) noexcept {
             if (isEmpty()) {
-                m_Head = new SLLNode(nullptr, std::forward<Ts>(args)...);
+                m_Head = m_Nodes.create(nullptr, std::forward<Ts>(args)...);
             } else {
-                auto* newHead = new SLLNode(m_Head, std::forward<Ts>(args)...);
+                auto* newHead = m_Nodes.create(m_Head, std::forward<Ts>(args)...);
                 m_Head = newHead;
             }
             m_Size++;
@@ -407,10 +416,10 @@ namespace wtl {
          */
         void appendBack(const T& data) noexcept {
             if (isEmpty()) {
-                m_Head = new SLLNode(data);
+                m_Head = m_Nodes.create(data);
             } else {
                 SLLNode* lastPtr = ptrTo(m_Size - 1);
-                lastPtr->m_Next = new SLLNode(data);
+                lastPtr->m_Next = m_Nodes.create(data);
             }
             m_Size++;
         }
@@ -421,10 +430,10 @@ namespace wtl {
          */
         void appendBack(T&& data) noexcept {
             if (isEmpty()) {
-                m_Head = new SLLNode(std::move(data));
+                m_Head = m_Nodes.create(std::move(data));
             } else {
                 SLLNode* lastPtr = ptrTo(m_Size - 1);
-                lastPtr->m_Next = new SLLNode(std::move(data));
+                lastPtr->m_Next = m_Nodes.create(std::move(data));
             }
             m_Size++;
         }
@@ -438,12 +447,12 @@ namespace wtl {
         template<typename ... Ts>
         T& emplaceBack(Ts&& ... args) noexcept {
             if (isEmpty()) {
-                m_Head = new SLLNode(nullptr, std::forward<Ts>(args)...);
+                m_Head = m_Nodes.create(nullptr, std::forward<Ts>(args)...);
                 m_Size++;
                 return m_Head->m_Data;
             } else {
                 SLLNode* lastPtr = ptrTo(m_Size - 1);
-                lastPtr->m_Next = new SLLNode(nullptr, std::forward<Ts>(args)...);
+                lastPtr->m_Next = m_Nodes.create(nullptr, std::forward<Ts>(args)...);
                 m_Size++;
                 return lastPtr->m_Next->m_Data;
             }
@@ -467,9 +476,9 @@ namespace wtl {
             } else if (index == 0) {
                 appendFront(data);
             } else {
-                SLLNode* newNode = new SLLNode(data);
+                SLLNode* newNode = m_Nodes.create(data);
                 SLLNode* tempPtr = m_Head;
-                for (int i = 0; i < index - 1; i++) {
+                for (std::size_t i = 0; i < index - 1; i++) {
                     tempPtr = tempPtr->m_Next;
                 }
                 newNode->m_Next = tempPtr->m_Next;
@@ -496,9 +505,9 @@ namespace wtl {
             } else if (index == 0) {
                 appendFront(std::move(data));
             } else {
-                SLLNode* newNode = new SLLNode(std::move(data));
+                SLLNode* newNode = m_Nodes.create(std::move(data));
                 SLLNode* tempPtr = m_Head;
-                for (int i = 0; i < index - 1; i++) {
+                for (std::size_t i = 0; i < index - 1; i++) {
                     tempPtr = tempPtr->m_Next;
                 }
                 newNode->m_Next = tempPtr->m_Next;
@@ -528,9 +537,9 @@ namespace wtl {
             } else if (index == 0) {
                 emplaceFront(std::forward<Ts>(args)...);
             } else {
-                auto* newNode = new SLLNode(nullptr, std::forward<Ts>(args)...);
+                auto* newNode = m_Nodes.create(nullptr, std::forward<Ts>(args)...);
                 SLLNode* tempPtr = m_Head;
-                for (int i = 0; i < index - 1; i++) {
+                for (std::size_t i = 0; i < index - 1; i++) {
                     tempPtr = tempPtr->m_Next;
                 }
                 newNode->m_Next = tempPtr->m_Next;
@@ -545,7 +554,7 @@ namespace wtl {
         void detachFront() noexcept {
             if (!isEmpty()) {
                 SLLNode* ptr = m_Head->m_Next;
-                delete m_Head;
+                m_Nodes.destroy(m_Head);
                 m_Head = ptr;
                 m_Size--;
             }
@@ -559,11 +568,11 @@ namespace wtl {
                 return;
             }
             if (m_Size == 1) {
-                delete m_Head;
+                m_Nodes.destroy(m_Head);
                 m_Head = nullptr;
             } else {
                 SLLNode* ptr = ptrTo(m_Size - 2);
-                delete ptr->m_Next;
+                m_Nodes.destroy(ptr->m_Next);
                 ptr->m_Next = nullptr;
             }
             m_Size--;
@@ -583,12 +592,12 @@ namespace wtl {
                 detachBack();
             } else {
                 SLLNode* tempPtr = m_Head;
-                for (int i = 0; i < index - 1; i++) {
+                for (std::size_t i = 0; i < index - 1; i++) {
                     tempPtr = tempPtr->m_Next;
                 }
                 SLLNode* nodeToRemove = tempPtr->m_Next;
                 tempPtr->m_Next = nodeToRemove->m_Next;
-                delete nodeToRemove;
+                m_Nodes.destroy(nodeToRemove);
                 m_Size--;
             }
         }
@@ -606,7 +615,6 @@ namespace wtl {
             while (!isEmpty()) {
                 if (front() == element) {
                     detachFront();
-                    m_Size--;
                     count++;
                 } else {
                     break;
@@ -614,17 +622,17 @@ namespace wtl {
             }
             if (!isEmpty()) {
                 SLLNode* prevNode = m_Head;
-                SLLNode* currNode = m_Head->nextNode;
+                SLLNode* currNode = m_Head->m_Next;
                 while (currNode != nullptr) {
-                    if (currNode->data == element) {
-                        prevNode->nextNode = currNode->nextNode;
-                        delete currNode;
-                        currNode = prevNode->nextNode;
+                    if (currNode->m_Data == element) {
+                        prevNode->m_Next = currNode->m_Next;
+                        m_Nodes.destroy(currNode);
+                        currNode = prevNode->m_Next;
                         m_Size--;
                         count++;
                     } else {
                         prevNode = currNode;
-                        currNode = currNode->nextNode;
+                        currNode = currNode->m_Next;
                     }
                 }
             }
@@ -632,20 +640,30 @@ namespace wtl {
         }
 
         /**
-         * Removes all elements in O(n). Size returns to 0.
+         * Removes all elements. Size returns to 0.
+         * If the nodes come from a NodePool, their memory is reclaimed all at once, and nodes are only visited if
+         * the elements have destructors to run.
          */
         void clear() noexcept {
-            if (!isEmpty()) {
-                SLLNode* next = m_Head->m_Next;
-                delete m_Head;
-                while (next != nullptr) {
+            if constexpr (NodeAllocator<SLLNode>::SUPPORTS_RELEASE) {
+                if constexpr (!std::is_trivially_destructible_v<T>) {
+                    SLLNode* ptr = m_Head;
+                    while (ptr != nullptr) {
+                        SLLNode* next = ptr->m_Next;
+                        ptr->~SLLNode();
+                        ptr = next;
+                    }
+                }
+                m_Nodes.release();
+            } else {
+                while (m_Head != nullptr) {
+                    SLLNode* next = m_Head->m_Next;
+                    m_Nodes.destroy(m_Head);
                     m_Head = next;
-                    next = next->m_Next;
-                    delete m_Head;
                 }
-                m_Size = 0;
-                m_Head = nullptr;
             }
+            m_Size = 0;
+            m_Head = nullptr;
         }
 
         /**
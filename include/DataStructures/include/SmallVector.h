@@ -0,0 +1,573 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * A dynamically sized array with room for N elements inside the object itself. No memory is allocated until
+     * the vector holds more than N elements, at which point the elements move to the heap and it behaves like a
+     * Vector. When it shrinks back to N elements or fewer, the elements move back inside.
+     * Has the same interface as Vector, so it can be used as the container of a Stack or as the bucket type of an
+     * adjacency list where most buckets are small.
+     * @tparam T
+     * @tparam N Number of elements stored inline
+     */
+    template<typename T, std::size_t N>
+    class SmallVector {
+    private:
+
+        static_assert(N > 0, "SmallVector must have room for at least 1 inline element!");
+
+        /// Whether elements can be relocated to new storage by copying their bytes
+        static constexpr bool TRIVIALLY_RELOCATABLE = std::is_trivially_copyable_v<T>;
+
+        /// Pointer to the storage in use, either m_Inline or a heap allocation
+        T* m_Arr;
+
+        /// Number of elements currently stored
+        std::size_t m_Size = 0;
+
+        /// Number of elements that fit in the storage in use
+        std::size_t m_Capacity = N;
+
+        /// Inline storage
+        alignas(T) unsigned char m_Inline[N * sizeof(T)];
+
+        /**
+         * Get the inline storage.
+         * @return
+         */
+        [[nodiscard]] T* inlineStorage() noexcept {
+            return reinterpret_cast<T*>(m_Inline);
+        }
+
+        /**
+         * Check if the elements are on the heap.
+         * @return
+         */
+        [[nodiscard]] bool isOnHeap() const noexcept {
+            return m_Arr != reinterpret_cast<const T*>(m_Inline);
+        }
+
+        /**
+         * Check if an index is out of bounds.
+         * @param index
+         * @return True if out of bounds, false if not.
+         */
+        [[nodiscard]] bool outOfBounds(std::size_t index) const noexcept {
+            return index >= m_Size;
+        }
+
+        /**
+         * Move the elements to a storage with the specified capacity, leaving a gap of new elements at an index. If
+         * the capacity is N or less, the inline storage is used.
+         * The new elements are constructed before the old ones are relocated, so they can be copied from elements of
+         * the vector itself, and if constructing them throws, the vector is unchanged.
+         * @tparam Construct
+         * @param newCapacity Must be at least the size plus the number of new elements
+         * @param index Position of the gap, from 0 to m_Size
+         * @param count Number of new elements
+         * @param construct Function constructing the new elements at the address passed to it
+         */
+        template<typename Construct>
+        void reAllocate(std::size_t newCapacity, std::size_t index, std::size_t count, Construct&& construct) {
+            T* newArr;
+            if (newCapacity <= N) {
+                if (!isOnHeap()) {
+                    return;
+                }
+                newArr = inlineStorage();
+                newCapacity = N;
+            } else {
+                newArr = (T*) (::operator new(newCapacity * sizeof(T)));
+            }
+            try {
+                construct(newArr + index);
+            } catch (...) {
+                if (newArr != inlineStorage()) {
+                    ::operator delete(newArr, newCapacity * sizeof(T));
+                }
+                throw;
+            }
+            impl::ds::relocate(newArr, m_Arr, index);
+            impl::ds::relocate(newArr + index + count, m_Arr + index, m_Size - index);
+            freeHeap();
+            m_Arr = newArr;
+            m_Capacity = newCapacity;
+            m_Size += count;
+        }
+
+        /**
+         * Move the elements to a storage with the specified capacity. If it is N or less, the inline storage is used.
+         * @param newCapacity Must be at least the size
+         */
+        void reAllocate(std::size_t newCapacity) noexcept {
+            reAllocate(newCapacity, m_Size, 0, [](T*) noexcept {});
+        }
+
+        /**
+         * Free the heap storage, if it is in use. Elements must already have been destroyed or relocated.
+         */
+        void freeHeap() noexcept {
+            if (isOnHeap()) {
+                ::operator delete(m_Arr, m_Capacity * sizeof(T));
+            }
+        }
+
+        /**
+         * Destroy all elements.
+         */
+        void destroyAll() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (std::size_t i = 0; i < m_Size; i++) {
+                    m_Arr[i].~T();
+                }
+            }
+        }
+
+        /**
+         * Capacity to grow to for a number of extra elements, at least a factor of 1.5 more than the current one.
+         * @param count
+         * @return
+         */
+        [[nodiscard]] std::size_t grownCapacity(std::size_t count) const noexcept {
+            return std::max(m_Size + count, m_Capacity + m_Capacity / 2);
+        }
+
+        /**
+         * Whether the elements from an index onwards can be shifted back before copying a range into the gap.
+         * @see Vector::canShiftBeforeCopying(...)
+         * @tparam Iterator
+         * @param index
+         * @param first
+         * @param last
+         * @return
+         */
+        template<typename Iterator>
+        [[nodiscard]] bool canShiftBeforeCopying(std::size_t index, Iterator first, Iterator last) const noexcept {
+            using Reference = typename std::iterator_traits<Iterator>::reference;
+            if constexpr (!TRIVIALLY_RELOCATABLE || !std::is_nothrow_constructible_v<T, Reference>) {
+                return false;
+            } else if constexpr (std::is_pointer_v<Iterator>) {
+                std::less<const void*> less;
+                return !less(m_Arr + index, last) || !less(first, m_Arr + m_Size);
+            } else {
+                return true;
+            }
+        }
+
+        /**
+         * Take over the elements of another SmallVector, which is left empty and inline. Heap storage is taken over
+         * as is, while inline elements are relocated one by one.
+         * @param other
+         */
+        void takeFrom(SmallVector& other) noexcept {
+            if (other.isOnHeap()) {
+                m_Arr = other.m_Arr;
+                m_Capacity = other.m_Capacity;
+            } else {
+                m_Arr = inlineStorage();
+                m_Capacity = N;
+                impl::ds::relocate(m_Arr, other.m_Arr, other.m_Size);
+            }
+            m_Size = other.m_Size;
+            other.m_Arr = other.inlineStorage();
+            other.m_Size = 0;
+            other.m_Capacity = N;
+        }
+
+        /**
+         * Copy the elements of another SmallVector into this empty, inline SmallVector.
+         * @param other
+         */
+        void copyFrom(const SmallVector& other) {
+            reAllocate(other.m_Size);
+            try {
+                std::uninitialized_copy_n(other.m_Arr, other.m_Size, m_Arr);
+            } catch (...) {
+                clear();
+                throw;
+            }
+            m_Size = other.m_Size;
+        }
+
+    public:
+
+        /**
+         * Default constructor. Does not allocate.
+         */
+        SmallVector() noexcept : m_Arr(inlineStorage()) {}
+
+        /**
+         * Constructor
+         * @param capacity Initial capacity reserved for vector. Memory is only allocated if it is more than N.
+         */
+        explicit SmallVector(std::size_t capacity) : m_Arr(inlineStorage()) {
+            reserve(capacity);
+        }
+
+        /**
+         * Constructor
+         * @param list
+         */
+        SmallVector(std::initializer_list<T> list) : m_Arr(inlineStorage()) {
+            append(list.begin(), list.end());
+        }
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        SmallVector(const SmallVector& other) : m_Arr(inlineStorage()) {
+            copyFrom(other);
+        }
+
+        /**
+         * Copy assignment
+         * @param other
+         * @return
+         */
+        SmallVector& operator=(const SmallVector& other) {
+            if (this != &other) {
+                clear();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Move constructor. The other vector is left empty.
+         * @param other
+         */
+        SmallVector(SmallVector&& other) noexcept {
+            takeFrom(other);
+        }
+
+        /**
+         * Move assignment. The other vector is left empty.
+         * @param other
+         * @return
+         */
+        SmallVector& operator=(SmallVector&& other) noexcept {
+            if (this != &other) {
+                destroyAll();
+                freeHeap();
+                takeFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of elements in the vector
+         * @return Number of elements
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Get the number of elements that can be held in currently allocated storage
+         * @return
+         */
+        [[nodiscard]] std::size_t getCapacity() const noexcept {
+            return m_Capacity;
+        }
+
+        /**
+         * Check if the vector is empty
+         * @return True if vector is empty, false if not
+         */
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return m_Size == 0;
+        }
+
+        /**
+         * Check if the elements are stored inline, without any heap allocation.
+         * @return
+         */
+        [[nodiscard]] bool isInline() const noexcept {
+            return !isOnHeap();
+        }
+
+        /**
+         * Access specified element with bounds checking
+         * @param index
+         * @return
+         */
+        [[nodiscard]] T& at(std::size_t index) {
+            if (outOfBounds(index)) {
+                throw std::out_of_range("Accessing index out of range");
+            }
+            return m_Arr[index];
+        }
+
+        /**
+         * Access specified element with bounds checking
+         * @param index
+         * @return
+         */
+        [[nodiscard]] const T& at(std::size_t index) const {
+            if (outOfBounds(index)) {
+                throw std::out_of_range("Accessing index out of range");
+            }
+            return m_Arr[index];
+        }
+
+        /**
+         * Returns a reference to the element at specified index with bounds checking.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] const T& operator[](std::size_t index) const {
+            return at(index);
+        }
+
+        /**
+         * Returns a reference to the element at specified index with bounds checking.
+         * @param index
+         * @return
+         */
+        [[nodiscard]] T& operator[](std::size_t index) {
+            return at(index);
+        }
+
+        /**
+         * Append an element at the back of the vector
+         * @param value
+         */
+        void pushBack(const T& value) noexcept {
+            emplaceBack(value);
+        }
+
+        /**
+         * Append an element at the back of the vector
+         * @param value
+         */
+        void pushBack(T&& value) noexcept {
+            emplaceBack(std::move(value));
+        }
+
+        /**
+         * Construct an element in-place at the back of the vector. The arguments may refer to elements of the vector,
+         * even when it moves from the inline storage to the heap.
+         * @tparam Ts
+         * @param args
+         * @return Reference to the constructed element
+         */
+        template<typename ... Ts>
+        T& emplaceBack(Ts&& ... args) {
+            if (m_Size == m_Capacity) {
+                reAllocate(grownCapacity(1), m_Size, 1, [&args...](T* element) {
+                    new(element) T(std::forward<Ts>(args)...);
+                });
+            } else {
+                new(&m_Arr[m_Size]) T(std::forward<Ts>(args)...);
+                m_Size++;
+            }
+            return m_Arr[m_Size - 1];
+        }
+
+        /**
+         * Append the elements of a range at the back of the vector. If the iterators are at least forward iterators,
+         * the storage is grown once for the whole range.
+         * @see Vector::append(...)
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void append(Iterator first, Iterator last) {
+            insert(m_Size, first, last);
+        }
+
+        /**
+         * Insert the elements of a range before the specified index.
+         * @see Vector::insert(...)
+         * @tparam Iterator
+         * @param index Position of the first inserted element, from 0 to getSize()
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void insert(std::size_t index, Iterator first, Iterator last) {
+            if (index > m_Size) {
+                throw std::out_of_range("Inserting at index out of range");
+            }
+            std::size_t oldSize = m_Size;
+            using Category = typename std::iterator_traits<Iterator>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+                auto count = static_cast<std::size_t>(std::distance(first, last));
+                if (m_Size + count > m_Capacity) {
+                    reAllocate(grownCapacity(count), index, count, [first, count](T* gap) {
+                        std::uninitialized_copy_n(first, count, gap);
+                    });
+                    return;
+                }
+                if (canShiftBeforeCopying(index, first, last)) {
+                    std::memmove(static_cast<void*>(m_Arr + index + count), static_cast<const void*>(m_Arr + index),
+                                 (m_Size - index) * sizeof(T));
+                    std::uninitialized_copy_n(first, count, m_Arr + index);
+                    m_Size += count;
+                    return;
+                }
+                std::uninitialized_copy_n(first, count, m_Arr + m_Size);
+                m_Size += count;
+            } else {
+                try {
+                    for (; first != last; ++first) {
+                        emplaceBack(*first);
+                    }
+                } catch (...) {
+                    while (m_Size > oldSize) {
+                        m_Arr[--m_Size].~T();
+                    }
+                    throw;
+                }
+            }
+            std::rotate(m_Arr + index, m_Arr + oldSize, m_Arr + m_Size);
+        }
+
+        /**
+         * Make sure that the specified number of elements can be stored without reallocating.
+         * @param capacity
+         */
+        void reserve(std::size_t capacity) noexcept {
+            if (capacity > m_Capacity) {
+                reAllocate(capacity);
+            }
+        }
+
+        /**
+         * Remove the last element. Heap storage is halved once it is less than a quarter full, and given up for the
+         * inline storage once the elements fit in it.
+         */
+        void popBack() noexcept {
+            if (m_Size > 0) {
+                m_Arr[--m_Size].~T();
+            }
+            if (isOnHeap() && m_Size < m_Capacity / 4) {
+                reAllocate(m_Capacity / 2);
+            }
+        }
+
+        /**
+         * Shrink the vector to release unused memory. The elements move back inline if they fit.
+         */
+        void shrinkToFit() noexcept {
+            if (isOnHeap() && m_Size < m_Capacity) {
+                reAllocate(m_Size);
+            }
+        }
+
+        /**
+         * Clear all elements in the vector. Size is reset to 0, and heap storage is released.
+         */
+        void clear() noexcept {
+            destroyAll();
+            freeHeap();
+            m_Arr = inlineStorage();
+            m_Size = 0;
+            m_Capacity = N;
+        }
+
+        /**
+         * Get a pointer to the underlying storage.
+         * @return
+         */
+        [[nodiscard]] T* data() noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Get a pointer to the underlying storage.
+         * @return
+         */
+        [[nodiscard]] const T* data() const noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Iterator to the first element, so that the vector can be used in range-based for loops.
+         * @return
+         */
+        [[nodiscard]] T* begin() noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Iterator to the first element.
+         * @return
+         */
+        [[nodiscard]] const T* begin() const noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Iterator past the last element.
+         * @return
+         */
+        [[nodiscard]] T* end() noexcept {
+            return m_Arr + m_Size;
+        }
+
+        /**
+         * Iterator past the last element.
+         * @return
+         */
+        [[nodiscard]] const T* end() const noexcept {
+            return m_Arr + m_Size;
+        }
+
+        /**
+         * Check if 2 vectors are equal. They are equal if the number of elements are equal,
+         * and the elements at each index are equal.
+         * @param other
+         * @return
+         */
+        bool operator==(const SmallVector& other) const noexcept {
+            if (m_Size != other.m_Size) {
+                return false;
+            }
+            for (std::size_t i = 0; i < m_Size; i++) {
+                if (m_Arr[i] != other.m_Arr[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Check if 2 vectors are not equal
+         * @param other
+         * @return
+         */
+        bool operator!=(const SmallVector& other) const noexcept {
+            return !(*this == other);
+        }
+
+        /**
+         * Destructor
+         */
+        ~SmallVector() {
+            destroyAll();
+            freeHeap();
+        }
+
+    };
+
+}
@@ -7,24 +7,51 @@
 #include <cstddef>
 #include <iterator>
 #include <stdexcept>
-#include <cmath>
 #include <type_traits>
-#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "impl/DataStructuresImpl.h"
+#include "RangeOperations.h"
 
 namespace wtl {
 
+    namespace impl {
+
+        /**
+         * Default operation of a sparse table, which is either the minimum or the maximum, chosen when the sparse table
+         * is constructed. The choice does not change afterwards, so the branch on it is always predicted and can be
+         * hoisted out of the build loop.
+         * @tparam T
+         */
+        template<typename T>
+        struct SparseTableMinMax {
+
+            bool m_Max = false;
+
+            T operator()(const T& lhs, const T& rhs) const noexcept {
+                return m_Max ? RangeMax<T>{}(lhs, rhs) : RangeMin<T>{}(lhs, rhs);
+            }
+        };
+
+    }
+
     /**
      * A sparse table allows for O(1) range query of a static array for associative and idempotent function.
-     * For non-idempotent functions, the time complexity is O(nlogn).
-     * The operations that are being supported are in SparseTableOperations enum.
+     * The operation is a template parameter, such as RangeMin, RangeMax, RangeGcd, RangeBitAnd, RangeBitOr or a
+     * user-defined functor, so it is inlined into the build and query loops. By default, the operation is the minimum
+     * or maximum, as selected by the Operation passed to the constructor.
+     * Level k of the table holds the result of the operation over each window of 2^k elements, and only has as many
+     * entries as there are such windows.
      * @tparam T
+     * @tparam Combine Type of associative and idempotent binary operation
      */
-    template<typename T>
+    template<typename T, typename Combine = impl::SparseTableMinMax<T>>
     class SparseTable {
     public:
 
         /**
-         * Operations supported by the sparse table
+         * Operations that can be selected at runtime when using the default Combine
          */
         enum class Operation {
             MIN, MAX
@@ -33,84 +60,62 @@ namespace wtl {
     private:
 
         /// Number of elements in the sparse table
-        std::size_t m_Size;
+        std::size_t m_Size = 0;
 
-        /// Pointer to the underlying array.
-        /// Even though sparse table is usually represented as a 2D array, a 1D array is used for faster access.
-        /// The (row, column) used to access a 2D array is converted into a single index value.
-        T* m_Table = nullptr;
+        /// All the levels of the sparse table, one after another
+        std::vector<T> m_Table;
 
-        /// Keep track of what operation is being done on the sparse table
-        Operation m_Operation;
+        /// Index in m_Table of the first entry of each level
+        std::vector<std::size_t> m_LevelOffsets;
 
-        /// Function pointer to the operation done by the sparse table
-        T (wtl::SparseTable<T>::*m_OpFunc)(std::size_t, std::size_t, std::size_t, std::size_t) const;
-
-        /**
-         * Convert row and column index for a 2D array into the index of a 1D array
-         * @param row
-         * @param column
-         * @return
-         */
-        [[nodiscard]] std::size_t indexConvert(std::size_t row, std::size_t column) const noexcept {
-            return (row * m_Size) + column;
-        }
+        /// Operation done by the sparse table
+        Combine m_Combine;
 
         template<typename Iterator>
         void constructSparseTable(Iterator iteratorBegin, Iterator iteratorEnd) {
-            std::size_t p = std::floor(std::log2(m_Size));
-            m_Table = new T[m_Size * (p + 1)];
-
-            // Copy over the first row
-            std::size_t index = 0;
-            while (iteratorBegin != iteratorEnd) {
-                m_Table[index++] = *iteratorBegin;
-                ++iteratorBegin;
+            m_Size = static_cast<std::size_t>(std::distance(iteratorBegin, iteratorEnd));
+            if (m_Size == 0) {
+                throw std::invalid_argument("Cannot construct empty sparse table");
             }
-            // Construct the rest of the sparse table
-            for (std::size_t i = 1; i <= p; i++) {
-                std::size_t jump = pow(2, i - 1);
-                for (std::size_t j = 0; j < m_Size; j++) {
-                    std::size_t secondIndex = j + jump;
-                    if (secondIndex < m_Size) {
-                        T val = (this->*m_OpFunc)(i - 1, j, i - 1, secondIndex);
-                        m_Table[(i * m_Size) + j] = val;
-                    }
-                }
+            std::size_t levels = impl::ds::floorLog2(m_Size) + 1;
+            m_LevelOffsets.resize(levels);
+            std::size_t total = 0;
+            for (std::size_t level = 0; level < levels; level++) {
+                m_LevelOffsets[level] = total;
+                total += m_Size - (std::size_t(1) << level) + 1;
             }
-        }
+            m_Table.reserve(total);
+            m_Table.insert(m_Table.end(), iteratorBegin, iteratorEnd);
+            m_Table.resize(total);
 
-        T min(std::size_t r1, std::size_t c1, std::size_t r2, std::size_t c2) const noexcept {
-            std::size_t index1 = indexConvert(r1, c1);
-            std::size_t index2 = indexConvert(r2, c2);
-            if (m_Table[index1] < m_Table[index2]) {
-                return m_Table[index1];
+            T* table = m_Table.data();
+            for (std::size_t level = 1; level < levels; level++) {
+                const T* previous = table + m_LevelOffsets[level - 1];
+                T* current = table + m_LevelOffsets[level];
+                std::size_t half = std::size_t(1) << (level - 1);
+                std::size_t count = m_Size - (half << 1) + 1;
+                for (std::size_t j = 0; j < count; j++) {
+                    current[j] = m_Combine(previous[j], previous[j + half]);
+                }
             }
-            return m_Table[index2];
         }
 
-        T max(std::size_t r1, std::size_t c1, std::size_t r2, std::size_t c2) const noexcept {
-            std::size_t index1 = indexConvert(r1, c1);
-            std::size_t index2 = indexConvert(r2, c2);
-            if (m_Table[index1] > m_Table[index2]) {
-                return m_Table[index1];
+        void checkRange(std::size_t startIndex, std::size_t endIndex) const {
+            if (startIndex >= m_Size || endIndex >= m_Size || startIndex > endIndex) {
+                throw std::invalid_argument("Index out of range");
             }
-            return m_Table[index2];
-        }
-
-        [[nodiscard]] bool outOfBounds(std::size_t index) const noexcept {
-            return index < 0 || index >= m_Size;
         }
 
-        void bindOperation(Operation operation) noexcept {
-            switch (operation) {
-                case Operation::MIN:
-                    this->m_OpFunc = &SparseTable<T>::min;
-                    break;
-                case Operation::MAX:
-                    this->m_OpFunc = &SparseTable<T>::max;
-                    break;
-            }
+        /**
+         * Query between two inclusive indexes, which must be valid.
+         * @param startIndex
+         * @param endIndex
+         * @return
+         */
+        T queryUnchecked(std::size_t startIndex, std::size_t endIndex) const noexcept {
+            std::size_t level = impl::ds::floorLog2(endIndex - startIndex + 1);
+            const T* row = m_Table.data() + m_LevelOffsets[level];
+            return m_Combine(row[startIndex], row[endIndex + 1 - (std::size_t(1) << level)]);
         }
 
     public:
@@ -121,18 +126,28 @@ namespace wtl {
          * @tparam Iterator
          * @param iteratorBegin Iterator pointing to the first element in the stl container
          * @param iteratorEnd Iterator pointing to the past-the-end element of the stl container
+         * @param combine Operation object
          */
         template<typename Iterator>
-        explicit
-        SparseTable(Iterator iteratorBegin, Iterator iteratorEnd, Operation operation) : m_Operation(operation) {
-            static_assert(std::is_arithmetic_v<T>, "Sparse table only supports arithmetic types");
-            Iterator itFront = iteratorBegin;
-            Iterator itBack = iteratorEnd;
-            m_Size = std::distance(itFront, itBack);
-            if (m_Size == 0) {
-                throw std::invalid_argument("Cannot construct empty sparse table");
-            }
-            bindOperation(m_Operation);
+        SparseTable(Iterator iteratorBegin, Iterator iteratorEnd, Combine combine = Combine())
+                : m_Combine(std::move(combine)) {
+            constructSparseTable(iteratorBegin, iteratorEnd);
+        }
+
+        /**
+         * Constructor.
+         * Construct a minimum or maximum sparse table using the elements in a stl container. Only available with the
+         * default Combine.
+         * @tparam Iterator
+         * @param iteratorBegin Iterator pointing to the first element in the stl container
+         * @param iteratorEnd Iterator pointing to the past-the-end element of the stl container
+         * @param operation
+         */
+        template<typename Iterator>
+        SparseTable(Iterator iteratorBegin, Iterator iteratorEnd, Operation operation) {
+            static_assert(std::is_same_v<Combine, impl::SparseTableMinMax<T>>,
+                          "Operation can only be selected at runtime with the default Combine");
+            m_Combine.m_Max = operation == Operation::MAX;
             constructSparseTable(iteratorBegin, iteratorEnd);
         }
 
@@ -140,56 +155,30 @@ namespace wtl {
          * Copy constructor
          * @param other
          */
-        SparseTable(const SparseTable<T>& other) {
-            m_Operation = other.m_Operation;
-            bindOperation(m_Operation);
-            m_Size = other.m_Size;
-            std::size_t p = std::floor(std::log2(m_Size));
-            m_Table = new T[m_Size * (p + 1)];
-            memcpy(m_Table, other.m_Table, m_Size * (p + 1) * sizeof(T));
-        }
+        SparseTable(const SparseTable& other) = default;
 
         /**
          * Copy assignment
          */
-        SparseTable<T>& operator=(const SparseTable<T>& other) noexcept {
-            if (this != &other) {
-                delete[] m_Table;
-                m_Operation = other.m_Operation;
-                bindOperation(m_Operation);
-                m_Size = other.m_Size;
-                std::size_t p = std::floor(std::log2(m_Size));
-                m_Table = new T[m_Size * (p + 1)];
-                memcpy(m_Table, other.m_Table, m_Size * (p + 1) * sizeof(T));
-            }
-            return *this;
-        }
+        SparseTable& operator=(const SparseTable& other) = default;
 
         /**
          * Move constructor
          * @param other
          */
-        SparseTable(SparseTable<T>&& other) noexcept {
-            m_Size = other.m_Size;
-            other.m_Size = 0;
-            m_Operation = other.m_Operation;
-            bindOperation(m_Operation);
-            m_Table = other.m_Table;
-            other.m_Table = nullptr;
-        }
+        SparseTable(SparseTable&& other) noexcept
+                : m_Size(std::exchange(other.m_Size, 0)), m_Table(std::move(other.m_Table)),
+                  m_LevelOffsets(std::move(other.m_LevelOffsets)), m_Combine(std::move(other.m_Combine)) {}
 
         /**
          * Move assignment
          */
-        SparseTable<T>& operator=(SparseTable<T>&& other) noexcept {
+        SparseTable& operator=(SparseTable&& other) noexcept {
             if (this != &other) {
-                delete[] m_Table;
-                m_Size = other.m_Size;
-                other.m_Size = 0;
-                m_Operation = other.m_Operation;
-                bindOperation(m_Operation);
-                m_Table = other.m_Table;
-                other.m_Table = nullptr;
+                m_Size = std::exchange(other.m_Size, 0);
+                m_Table = std::move(other.m_Table);
+                m_LevelOffsets = std::move(other.m_LevelOffsets);
+                m_Combine = std::move(other.m_Combine);
             }
             return *this;
         }
@@ -203,11 +192,21 @@ namespace wtl {
         }
 
         /**
-         * Get the operation of the sparse table.
+         * Get the number of bytes used by the sparse table, excluding the object itself.
+         * @return
+         */
+        [[nodiscard]] std::size_t getMemoryUsage() const noexcept {
+            return m_Table.capacity() * sizeof(T) + m_LevelOffsets.capacity() * sizeof(std::size_t);
+        }
+
+        /**
+         * Get the operation of the sparse table. Only available with the default Combine.
          * @return
          */
         [[nodiscard]] Operation getOperation() const noexcept {
-            return m_Operation;
+            static_assert(std::is_same_v<Combine, impl::SparseTableMinMax<T>>,
+                          "Operation can only be selected at runtime with the default Combine");
+            return m_Combine.m_Max ? Operation::MAX : Operation::MIN;
         }
 
         /**
@@ -217,20 +216,41 @@ namespace wtl {
          * @return
          */
         [[nodiscard]] T query(std::size_t startIndex, std::size_t endIndex) const {
-            if (outOfBounds(startIndex) || outOfBounds(endIndex)) {
-                throw std::invalid_argument("Index out of range");
-            }
-            std::size_t p = std::floor(std::log2(endIndex - startIndex + 1));
-            std::size_t k = std::pow(2, p);
-            return (this->*m_OpFunc)(p, startIndex, p, endIndex - k + 1);
+            checkRange(startIndex, endIndex);
+            return queryUnchecked(startIndex, endIndex);
         }
 
         /**
-         * Destructor
+         * Answer a range of queries, each a pair of inclusive indexes, as impl::ds::batchRangeQuery does.
+         * @tparam RangeIterator Iterator over std::pair<std::size_t, std::size_t>, or similar
+         * @tparam OutputIterator
+         * @param first
+         * @param last
+         * @param out
+         * @return Output iterator past the last result written
          */
-        ~SparseTable() {
-            delete[] m_Table;
+        template<typename RangeIterator, typename OutputIterator>
+        OutputIterator query(RangeIterator first, RangeIterator last, OutputIterator out) const {
+            return impl::ds::batchRangeQuery(first, last, out, [this](std::size_t startIndex, std::size_t endIndex) {
+                return query(startIndex, endIndex);
+            });
         }
+
+        /**
+         * Answer a batch of queries, each a pair of inclusive indexes.
+         * @param ranges
+         * @return Results in the same order as the queries
+         */
+        [[nodiscard]] std::vector<T> query(const std::vector<std::pair<std::size_t, std::size_t>>& ranges) const {
+            return impl::ds::batchRangeQuery<T>(ranges, [this](std::size_t startIndex, std::size_t endIndex) {
+                return query(startIndex, endIndex);
+            });
+        }
+
+        /**
+         * Destructor
+         */
+        ~SparseTable() = default;
     };
 
 }
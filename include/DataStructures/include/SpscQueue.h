@@ -0,0 +1,259 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    /**
+     * A bounded, lock-free first-in first-out (FIFO) queue for exactly one producer thread and one consumer thread.
+     * Elements are stored in a circular buffer whose capacity is a power of 2. The producer only writes the tail and
+     * the consumer only writes the head, each on its own cache line, so the two threads never contend for a lock
+     * or a cache line except to hand over elements.
+     * Each side also keeps a cached copy of the other side's index, and only reloads it when the queue looks full or
+     * empty, so that most operations touch no cache line written by the other thread.
+     * The range variants hand over a whole batch of elements with a single atomic store.
+     * @tparam T
+     */
+    template<typename T>
+    class SpscQueue {
+    private:
+
+        /**
+         * Index written by one side, and the copy of the other side's index that it last read.
+         */
+        struct alignas(impl::ds::CACHE_LINE_SIZE) Position {
+
+            /// Number of elements this side has ever enqueued (tail) or dequeued (head)
+            std::atomic<std::size_t> m_Index{0};
+
+            /// Last seen value of the other side's index
+            std::size_t m_Cached = 0;
+
+        };
+
+        /// Written by the producer
+        Position m_Tail;
+
+        /// Written by the consumer
+        Position m_Head;
+
+        /// Circular buffer, read-only after construction
+        alignas(impl::ds::CACHE_LINE_SIZE) T* m_Buffer = nullptr;
+
+        /// Size of the buffer, a power of 2
+        std::size_t m_Capacity = 0;
+
+        /**
+         * Number of free slots the producer can fill, reloading the head only if the cached copy shows fewer than
+         * wanted.
+         * @param tail
+         * @param wanted
+         * @return
+         */
+        std::size_t freeSlots(std::size_t tail, std::size_t wanted) noexcept {
+            std::size_t free = m_Capacity - (tail - m_Tail.m_Cached);
+            if (free < wanted) {
+                m_Tail.m_Cached = m_Head.m_Index.load(std::memory_order_acquire);
+                free = m_Capacity - (tail - m_Tail.m_Cached);
+            }
+            return free;
+        }
+
+        /**
+         * Number of elements the consumer can take, reloading the tail only if the cached copy shows fewer than
+         * wanted.
+         * @param head
+         * @param wanted
+         * @return
+         */
+        std::size_t readySlots(std::size_t head, std::size_t wanted) noexcept {
+            std::size_t ready = m_Head.m_Cached - head;
+            if (ready < wanted) {
+                m_Head.m_Cached = m_Tail.m_Index.load(std::memory_order_acquire);
+                ready = m_Head.m_Cached - head;
+            }
+            return ready;
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param capacity Maximum number of elements in the queue, rounded up to a power of 2
+         */
+        explicit SpscQueue(std::size_t capacity) : m_Capacity(2) {
+            while (m_Capacity < capacity) {
+                m_Capacity *= 2;
+            }
+            m_Buffer = static_cast<T*>(::operator new(m_Capacity * sizeof(T)));
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /**
+         * Get the maximum number of elements in the queue
+         * @return
+         */
+        [[nodiscard]] std::size_t getCapacity() const noexcept {
+            return m_Capacity;
+        }
+
+        /**
+         * Get the number of elements in the queue. Only exact if neither side is running at the same time.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            std::size_t head = m_Head.m_Index.load(std::memory_order_acquire);
+            return m_Tail.m_Index.load(std::memory_order_acquire) - head;
+        }
+
+        /**
+         * Check if queue is empty. Only exact if neither side is running at the same time.
+         * @return
+         */
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return getSize() == 0;
+        }
+
+        /**
+         * Construct an element in-place at the back of the queue, if it is not full. Producer only.
+         * @tparam Ts
+         * @param args
+         * @return True if the element was enqueued, false if the queue is full.
+         */
+        template<typename ... Ts>
+        bool tryEmplace(Ts&& ... args) {
+            std::size_t tail = m_Tail.m_Index.load(std::memory_order_relaxed);
+            if (freeSlots(tail, 1) == 0) {
+                return false;
+            }
+            new(&m_Buffer[tail & (m_Capacity - 1)]) T(std::forward<Ts>(args)...);
+            m_Tail.m_Index.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Enqueue an element to the back of the queue, if it is not full. Producer only.
+         * @param element
+         * @return True if the element was enqueued, false if the queue is full.
+         */
+        bool tryEnqueue(const T& element) {
+            return tryEmplace(element);
+        }
+
+        /**
+         * Enqueue an element to the back of the queue, if it is not full. Producer only.
+         * @param element Only moved from if it was enqueued
+         * @return True if the element was enqueued, false if the queue is full.
+         */
+        bool tryEnqueue(T&& element) {
+            return tryEmplace(std::move(element));
+        }
+
+        /**
+         * Enqueue as many elements of a range as there is space for, in order, and publish them all at once. If
+         * copying an element throws, none of the range is enqueued. Producer only.
+         * @tparam Iterator Forward iterator
+         * @param first
+         * @param last
+         * @return Number of elements enqueued, the first ones of the range.
+         */
+        template<typename Iterator>
+        std::size_t tryEnqueueRange(Iterator first, Iterator last) {
+            std::size_t tail = m_Tail.m_Index.load(std::memory_order_relaxed);
+            std::size_t wanted = static_cast<std::size_t>(std::distance(first, last));
+            std::size_t count = std::min(wanted, freeSlots(tail, wanted));
+            std::size_t constructed = 0;
+            try {
+                for (; constructed < count; constructed++, ++first) {
+                    new(&m_Buffer[(tail + constructed) & (m_Capacity - 1)]) T(*first);
+                }
+            } catch (...) {
+                for (std::size_t i = 0; i < constructed; i++) {
+                    m_Buffer[(tail + i) & (m_Capacity - 1)].~T();
+                }
+                throw;
+            }
+            if (count > 0) {
+                m_Tail.m_Index.store(tail + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /**
+         * Move the element at the front of the queue out and remove it, if the queue is not empty. Consumer only.
+         * @param element Assigned the front element
+         * @return True if an element was dequeued, false if the queue is empty.
+         */
+        bool tryDequeue(T& element) {
+            std::size_t head = m_Head.m_Index.load(std::memory_order_relaxed);
+            if (readySlots(head, 1) == 0) {
+                return false;
+            }
+            T& slot = m_Buffer[head & (m_Capacity - 1)];
+            element = std::move(slot);
+            slot.~T();
+            m_Head.m_Index.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Move up to a number of elements from the front of the queue to an output iterator, in order, and free
+         * their slots all at once. If writing an element throws, the elements before it are still dequeued, and it
+         * stays at the front. Consumer only.
+         * @tparam OutputIterator
+         * @param out
+         * @param maxCount
+         * @return Number of elements dequeued
+         */
+        template<typename OutputIterator>
+        std::size_t tryDequeueInto(OutputIterator out, std::size_t maxCount = std::numeric_limits<std::size_t>::max()) {
+            std::size_t head = m_Head.m_Index.load(std::memory_order_relaxed);
+            std::size_t count = std::min(maxCount, readySlots(head, std::min(maxCount, m_Capacity)));
+            for (std::size_t i = 0; i < count; i++) {
+                T& slot = m_Buffer[(head + i) & (m_Capacity - 1)];
+                try {
+                    *out = std::move(slot);
+                    ++out;
+                } catch (...) {
+                    m_Head.m_Index.store(head + i, std::memory_order_release);
+                    throw;
+                }
+                slot.~T();
+            }
+            if (count > 0) {
+                m_Head.m_Index.store(head + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /**
+         * Destructor. Must not run while either side is still using the queue.
+         */
+        ~SpscQueue() {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                std::size_t tail = m_Tail.m_Index.load(std::memory_order_acquire);
+                for (std::size_t i = m_Head.m_Index.load(std::memory_order_acquire); i != tail; i++) {
+                    m_Buffer[i & (m_Capacity - 1)].~T();
+                }
+            }
+            ::operator delete(m_Buffer, m_Capacity * sizeof(T));
+        }
+
+    };
+
+}
@@ -2,9 +2,12 @@
 // Created by Nicholas on 14/12/2020.
 //
 
+#pragma once
+
 #include <cstddef>
 #include <stdexcept>
 #include <initializer_list>
+#include <utility>
 #include "Vector.h"
 
 namespace wtl {
@@ -12,13 +15,14 @@ namespace wtl {
     /**
      * A first-in last-out (FILO) stack implemented using an dynamically sized array.
      * @tparam T
+     * @tparam Container Vector, or a SmallVector so that small stacks do not allocate
      */
-    template<typename T>
+    template<typename T, typename Container = wtl::Vector<T>>
     class Stack {
     private:
 
         // Underlying vector data structure
-        wtl::Vector<T> m_Vector;
+        Container m_Vector;
 
     public:
 
@@ -34,7 +38,7 @@ namespace wtl {
          * Copy constructor
          * @param other
          */
-        Stack(const Stack<T>& other) : m_Vector(other.m_Vector) {
+        Stack(const Stack& other) : m_Vector(other.m_Vector) {
         }
 
         /**
@@ -42,15 +46,28 @@ namespace wtl {
          * @param other
          * @return
          */
-        Stack<T>& operator=(const Stack<T>& other) noexcept {
+        Stack& operator=(const Stack& other) noexcept {
             if (this != &other) {
                 m_Vector = other.m_Vector;
             }
+            return *this;
         }
 
-        Stack(Stack<T>&& other) = delete;
+        /**
+         * Move constructor
+         * @param other
+         */
+        Stack(Stack&& other) noexcept : m_Vector(std::move(other.m_Vector)) {}
 
-        Stack<T>& operator=(Stack<T>&& other) = delete;
+        /**
+         * Move assignment
+         * @param other
+         * @return
+         */
+        Stack& operator=(Stack&& other) noexcept {
+            m_Vector = std::move(other.m_Vector);
+            return *this;
+        }
 
         /**
          * Get the size of the stack
@@ -164,7 +181,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator==(const Stack<T>& other) const noexcept {
+        bool operator==(const Stack& other) const noexcept {
             return m_Vector == other.m_Vector;
         }
 
@@ -173,7 +190,7 @@ namespace wtl {
          * @param other
          * @return
          */
-        bool operator!=(const Stack<T>& other) const noexcept {
+        bool operator!=(const Stack& other) const noexcept {
             return m_Vector != other.m_Vector;
         }
 
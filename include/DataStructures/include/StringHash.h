@@ -0,0 +1,36 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace wtl {
+
+    /**
+     * Transparent hash for std::string keys. Containers that are given this hash can be queried with a
+     * std::string_view or a C string directly, without constructing a temporary std::string for every lookup.
+     * std::string, std::string_view and C strings with the same characters all hash to the same value.
+     */
+    struct StringHash {
+
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view string) const noexcept {
+            return std::hash<std::string_view>{}(string);
+        }
+
+        std::size_t operator()(const std::string& string) const noexcept {
+            return std::hash<std::string_view>{}(string);
+        }
+
+        std::size_t operator()(const char* string) const noexcept {
+            return std::hash<std::string_view>{}(string);
+        }
+    };
+
+}
@@ -0,0 +1,921 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "NodePool.h"
+#include "impl/DataStructuresImpl.h"
+
+namespace wtl {
+
+    template<typename K, typename V, typename Comparator, template<typename> class NodeAllocator>
+    class TreeMap;
+
+    namespace impl {
+
+        /**
+         * Node of a TreeMap
+         * @tparam K
+         * @tparam V
+         */
+        template<typename K, typename V>
+        struct TreeMapNode {
+
+            K m_Key;
+
+            V m_Value;
+
+            TreeMapNode<K, V>* m_Parent = nullptr;
+
+            TreeMapNode<K, V>* m_Left = nullptr;
+
+            TreeMapNode<K, V>* m_Right = nullptr;
+
+            /// New nodes are red
+            bool m_Red = true;
+
+            /**
+             * Constructor for constructing the value in-place
+             * @tparam Key
+             * @tparam Ts
+             * @param key
+             * @param args
+             */
+            template<typename Key, typename ... Ts>
+            explicit TreeMapNode(Key&& key, Ts&& ... args)
+                    : m_Key(std::forward<Key>(key)), m_Value(std::forward<Ts>(args)...) {}
+
+        };
+
+        /**
+         * Bidirectional iterator over the key-value pairs of a TreeMap, in ascending order of keys.
+         * Dereferencing gives a pair of references to the key and the value.
+         * @tparam K
+         * @tparam V
+         * @tparam IsConst Whether the values are accessed as const
+         */
+        template<typename K, typename V, bool IsConst>
+        class TreeMapIterator {
+        private:
+
+            typedef TreeMapNode<K, V> Node;
+
+            template<typename, typename, typename, template<typename> class>
+            friend class wtl::TreeMap;
+
+            friend class TreeMapIterator<K, V, !IsConst>;
+
+            /// Current node, nullptr for the end
+            Node* m_Node = nullptr;
+
+            /// Member of the map holding the root of the tree, needed to step back from the end. It belongs to the
+            /// map object rather than to the nodes, so it goes stale when the map is moved.
+            Node* const* m_Root = nullptr;
+
+            TreeMapIterator(Node* node, Node* const* root) noexcept : m_Node(node), m_Root(root) {}
+
+        public:
+
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef std::pair<const K&, std::conditional_t<IsConst, const V&, V&>> value_type;
+            typedef value_type reference;
+            typedef std::ptrdiff_t difference_type;
+
+            /**
+             * Gives operator-> something to point to, since the pair is created on the fly.
+             */
+            struct pointer {
+                value_type m_Pair;
+
+                value_type* operator->() noexcept {
+                    return &m_Pair;
+                }
+            };
+
+            TreeMapIterator() = default;
+
+            /**
+             * Conversion from a non-const iterator to a const iterator
+             * @param other
+             */
+            template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+            TreeMapIterator(const TreeMapIterator<K, V, OtherConst>& other) noexcept
+                    : m_Node(other.m_Node), m_Root(other.m_Root) {}
+
+            reference operator*() const noexcept {
+                return {m_Node->m_Key, m_Node->m_Value};
+            }
+
+            pointer operator->() const noexcept {
+                return {{m_Node->m_Key, m_Node->m_Value}};
+            }
+
+            TreeMapIterator& operator++() noexcept {
+                if (m_Node->m_Right != nullptr) {
+                    m_Node = m_Node->m_Right;
+                    while (m_Node->m_Left != nullptr) {
+                        m_Node = m_Node->m_Left;
+                    }
+                } else {
+                    Node* parent = m_Node->m_Parent;
+                    while (parent != nullptr && m_Node == parent->m_Right) {
+                        m_Node = parent;
+                        parent = parent->m_Parent;
+                    }
+                    m_Node = parent;
+                }
+                return *this;
+            }
+
+            TreeMapIterator operator++(int) noexcept {
+                TreeMapIterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            TreeMapIterator& operator--() noexcept {
+                if (m_Node == nullptr) {
+                    m_Node = *m_Root;
+                    while (m_Node->m_Right != nullptr) {
+                        m_Node = m_Node->m_Right;
+                    }
+                } else if (m_Node->m_Left != nullptr) {
+                    m_Node = m_Node->m_Left;
+                    while (m_Node->m_Right != nullptr) {
+                        m_Node = m_Node->m_Right;
+                    }
+                } else {
+                    Node* parent = m_Node->m_Parent;
+                    while (parent != nullptr && m_Node == parent->m_Left) {
+                        m_Node = parent;
+                        parent = parent->m_Parent;
+                    }
+                    m_Node = parent;
+                }
+                return *this;
+            }
+
+            TreeMapIterator operator--(int) noexcept {
+                TreeMapIterator copy = *this;
+                --*this;
+                return copy;
+            }
+
+            bool operator==(const TreeMapIterator& other) const noexcept {
+                return m_Node == other.m_Node;
+            }
+
+            bool operator!=(const TreeMapIterator& other) const noexcept {
+                return m_Node != other.m_Node;
+            }
+
+        };
+
+    }
+
+    /**
+     * An ordered map implemented as a red-black tree. Unlike BinarySearchTree, the tree is rebalanced after every
+     * insertion and removal, so insertion, searching and removal take O(log n) time in the worst case, even if the
+     * keys are inserted in sorted order.
+     * Iterating visits the key-value pairs in ascending order of keys. Iterators stay valid until the element they
+     * point to is erased. When the map is moved, iterators to its elements move with them to the new map and can
+     * still be dereferenced and incremented, but end iterators, and decrementing from the end, refer to the map
+     * moved from, and must not be used.
+     * @tparam K
+     * @tparam V
+     * @tparam Comparator Strict weak ordering of the keys
+     * @tparam NodeAllocator NodePool, which frees the memory of erased nodes only on clear() or destruction, or
+     * HeapNodeAllocator to allocate and free each node on its own
+     */
+    template<typename K, typename V, typename Comparator = impl::ds::StandardComparator<K>,
+            template<typename> class NodeAllocator = wtl::NodePool>
+    class TreeMap {
+    private:
+
+        typedef impl::TreeMapNode<K, V> Node;
+
+    public:
+
+        typedef impl::TreeMapIterator<K, V, false> Iterator;
+        typedef impl::TreeMapIterator<K, V, true> ConstIterator;
+        typedef std::pair<std::reference_wrapper<const K>, std::reference_wrapper<V>> KeyValuePairResult;
+
+    private:
+
+        /// Number of key-value pairs
+        std::size_t m_Size = 0;
+
+        /// Root of the tree
+        Node* m_Root = nullptr;
+
+        /// Allocator of the nodes
+        NodeAllocator<Node> m_Nodes;
+
+        /// Ordering of the keys
+        Comparator m_Comparator;
+
+        [[nodiscard]] static bool isRed(const Node* node) noexcept {
+            return node != nullptr && node->m_Red;
+        }
+
+        [[nodiscard]] static Node* minimum(Node* node) noexcept {
+            while (node->m_Left != nullptr) {
+                node = node->m_Left;
+            }
+            return node;
+        }
+
+        /**
+         * Replace a child of a node's parent, or the root if it has none.
+         * @param node
+         * @param replacement
+         */
+        void replaceChild(Node* node, Node* replacement) noexcept {
+            if (node->m_Parent == nullptr) {
+                m_Root = replacement;
+            } else if (node == node->m_Parent->m_Left) {
+                node->m_Parent->m_Left = replacement;
+            } else {
+                node->m_Parent->m_Right = replacement;
+            }
+            if (replacement != nullptr) {
+                replacement->m_Parent = node->m_Parent;
+            }
+        }
+
+        /**
+         * Rotate left, so that the right child of the node takes its place.
+         * @param node
+         */
+        void rotateLeft(Node* node) noexcept {
+            Node* child = node->m_Right;
+            node->m_Right = child->m_Left;
+            if (child->m_Left != nullptr) {
+                child->m_Left->m_Parent = node;
+            }
+            replaceChild(node, child);
+            child->m_Left = node;
+            node->m_Parent = child;
+        }
+
+        /**
+         * Rotate right, so that the left child of the node takes its place.
+         * @param node
+         */
+        void rotateRight(Node* node) noexcept {
+            Node* child = node->m_Left;
+            node->m_Left = child->m_Right;
+            if (child->m_Right != nullptr) {
+                child->m_Right->m_Parent = node;
+            }
+            replaceChild(node, child);
+            child->m_Right = node;
+            node->m_Parent = child;
+        }
+
+        /**
+         * Restore the red-black properties after inserting a red node.
+         * @param node
+         */
+        void insertFixup(Node* node) noexcept {
+            while (isRed(node->m_Parent)) {
+                Node* parent = node->m_Parent;
+                Node* grandparent = parent->m_Parent;
+                if (parent == grandparent->m_Left) {
+                    Node* uncle = grandparent->m_Right;
+                    if (isRed(uncle)) {
+                        parent->m_Red = false;
+                        uncle->m_Red = false;
+                        grandparent->m_Red = true;
+                        node = grandparent;
+                        continue;
+                    }
+                    if (node == parent->m_Right) {
+                        rotateLeft(parent);
+                        node = parent;
+                        parent = node->m_Parent;
+                    }
+                    parent->m_Red = false;
+                    grandparent->m_Red = true;
+                    rotateRight(grandparent);
+                } else {
+                    Node* uncle = grandparent->m_Left;
+                    if (isRed(uncle)) {
+                        parent->m_Red = false;
+                        uncle->m_Red = false;
+                        grandparent->m_Red = true;
+                        node = grandparent;
+                        continue;
+                    }
+                    if (node == parent->m_Left) {
+                        rotateRight(parent);
+                        node = parent;
+                        parent = node->m_Parent;
+                    }
+                    parent->m_Red = false;
+                    grandparent->m_Red = true;
+                    rotateLeft(grandparent);
+                }
+            }
+            m_Root->m_Red = false;
+        }
+
+        /**
+         * Restore the red-black properties after removing a black node.
+         * @param node Node that took the place of the removed node, which may be nullptr
+         * @param parent Parent of that node
+         */
+        void eraseFixup(Node* node, Node* parent) noexcept {
+            while (node != m_Root && !isRed(node)) {
+                if (node == parent->m_Left) {
+                    Node* sibling = parent->m_Right;
+                    if (isRed(sibling)) {
+                        sibling->m_Red = false;
+                        parent->m_Red = true;
+                        rotateLeft(parent);
+                        sibling = parent->m_Right;
+                    }
+                    if (!isRed(sibling->m_Left) && !isRed(sibling->m_Right)) {
+                        sibling->m_Red = true;
+                        node = parent;
+                        parent = node->m_Parent;
+                    } else {
+                        if (!isRed(sibling->m_Right)) {
+                            sibling->m_Left->m_Red = false;
+                            sibling->m_Red = true;
+                            rotateRight(sibling);
+                            sibling = parent->m_Right;
+                        }
+                        sibling->m_Red = parent->m_Red;
+                        parent->m_Red = false;
+                        sibling->m_Right->m_Red = false;
+                        rotateLeft(parent);
+                        node = m_Root;
+                    }
+                } else {
+                    Node* sibling = parent->m_Left;
+                    if (isRed(sibling)) {
+                        sibling->m_Red = false;
+                        parent->m_Red = true;
+                        rotateRight(parent);
+                        sibling = parent->m_Left;
+                    }
+                    if (!isRed(sibling->m_Left) && !isRed(sibling->m_Right)) {
+                        sibling->m_Red = true;
+                        node = parent;
+                        parent = node->m_Parent;
+                    } else {
+                        if (!isRed(sibling->m_Left)) {
+                            sibling->m_Right->m_Red = false;
+                            sibling->m_Red = true;
+                            rotateLeft(sibling);
+                            sibling = parent->m_Left;
+                        }
+                        sibling->m_Red = parent->m_Red;
+                        parent->m_Red = false;
+                        sibling->m_Left->m_Red = false;
+                        rotateRight(parent);
+                        node = m_Root;
+                    }
+                }
+            }
+            if (node != nullptr) {
+                node->m_Red = false;
+            }
+        }
+
+        /**
+         * Unlink a node from the tree, rebalance, and destroy it.
+         * @param node
+         */
+        void eraseNode(Node* node) noexcept {
+            bool removedRed = node->m_Red;
+            Node* replacement;
+            Node* replacementParent;
+            if (node->m_Left == nullptr) {
+                replacement = node->m_Right;
+                replacementParent = node->m_Parent;
+                replaceChild(node, node->m_Right);
+            } else if (node->m_Right == nullptr) {
+                replacement = node->m_Left;
+                replacementParent = node->m_Parent;
+                replaceChild(node, node->m_Left);
+            } else {
+                // The successor has no left child. It is moved into the place of the node.
+                Node* successor = minimum(node->m_Right);
+                removedRed = successor->m_Red;
+                replacement = successor->m_Right;
+                if (successor->m_Parent == node) {
+                    replacementParent = successor;
+                } else {
+                    replacementParent = successor->m_Parent;
+                    replaceChild(successor, successor->m_Right);
+                    successor->m_Right = node->m_Right;
+                    successor->m_Right->m_Parent = successor;
+                }
+                replaceChild(node, successor);
+                successor->m_Left = node->m_Left;
+                successor->m_Left->m_Parent = successor;
+                successor->m_Red = node->m_Red;
+            }
+            m_Nodes.destroy(node);
+            --m_Size;
+            if (!removedRed) {
+                eraseFixup(replacement, replacementParent);
+            }
+        }
+
+        /**
+         * Find the node with an equivalent key.
+         * @param key
+         * @return nullptr if not found
+         */
+        [[nodiscard]] Node* findNode(const K& key) const noexcept {
+            Node* node = lowerBoundNode(key);
+            if (node != nullptr && !m_Comparator(key, node->m_Key)) {
+                return node;
+            }
+            return nullptr;
+        }
+
+        /**
+         * Find the first node whose key is not less than the key.
+         * @param key
+         * @return nullptr if there is none
+         */
+        [[nodiscard]] Node* lowerBoundNode(const K& key) const noexcept {
+            Node* node = m_Root;
+            Node* result = nullptr;
+            while (node != nullptr) {
+                if (m_Comparator(node->m_Key, key)) {
+                    node = node->m_Right;
+                } else {
+                    result = node;
+                    node = node->m_Left;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Find the first node whose key is greater than the key.
+         * @param key
+         * @return nullptr if there is none
+         */
+        [[nodiscard]] Node* upperBoundNode(const K& key) const noexcept {
+            Node* node = m_Root;
+            Node* result = nullptr;
+            while (node != nullptr) {
+                if (m_Comparator(key, node->m_Key)) {
+                    result = node;
+                    node = node->m_Left;
+                } else {
+                    node = node->m_Right;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Find the node with an equivalent key, or create one with a value constructed from the arguments.
+         * @tparam Key const K& or K
+         * @tparam Ts
+         * @param key Only moved from if a node is created
+         * @param args
+         * @return The node, and true if it was created
+         */
+        template<typename Key, typename ... Ts>
+        std::pair<Node*, bool> findOrInsert(Key&& key, Ts&& ... args) {
+            Node* parent = nullptr;
+            Node* node = m_Root;
+            bool left = false;
+            while (node != nullptr) {
+                parent = node;
+                if (m_Comparator(key, node->m_Key)) {
+                    node = node->m_Left;
+                    left = true;
+                } else if (m_Comparator(node->m_Key, key)) {
+                    node = node->m_Right;
+                    left = false;
+                } else {
+                    return {node, false};
+                }
+            }
+            node = m_Nodes.create(std::forward<Key>(key), std::forward<Ts>(args)...);
+            node->m_Parent = parent;
+            if (parent == nullptr) {
+                m_Root = node;
+            } else if (left) {
+                parent->m_Left = node;
+            } else {
+                parent->m_Right = node;
+            }
+            ++m_Size;
+            insertFixup(node);
+            return {node, true};
+        }
+
+        /**
+         * Copy a subtree, keeping its shape and colours. Each copied node is linked in as soon as it is created, so
+         * if copying a key or value throws, the nodes copied so far form a tree that can be cleared.
+         * @param node
+         * @param parent Parent of the copy
+         * @param link Set to the root of the copy
+         */
+        void copyTree(const Node* node, Node* parent, Node*& link) {
+            if (node == nullptr) {
+                return;
+            }
+            link = m_Nodes.create(node->m_Key, node->m_Value);
+            link->m_Red = node->m_Red;
+            link->m_Parent = parent;
+            copyTree(node->m_Left, link, link->m_Left);
+            copyTree(node->m_Right, link, link->m_Right);
+        }
+
+        /**
+         * Post-order traversal destroying each node. Nodes from a NodePool are only destructed, since their memory
+         * is reclaimed all at once afterwards.
+         * @param node
+         */
+        void clearNodes(Node* node) noexcept {
+            if (node == nullptr) {
+                return;
+            }
+            clearNodes(node->m_Left);
+            clearNodes(node->m_Right);
+            if constexpr (NodeAllocator<Node>::SUPPORTS_RELEASE) {
+                node->~Node();
+            } else {
+                m_Nodes.destroy(node);
+            }
+        }
+
+        /**
+         * In-order traversal passing each key and value to a function as rvalues.
+         * @tparam Func
+         * @param node
+         * @param func
+         */
+        template<typename Func>
+        static void drainNodes(Node* node, Func& func) {
+            if (node == nullptr) {
+                return;
+            }
+            drainNodes(node->m_Left, func);
+            func(std::move(node->m_Key), std::move(node->m_Value));
+            drainNodes(node->m_Right, func);
+        }
+
+        [[nodiscard]] static std::size_t heightOf(const Node* node) noexcept {
+            if (node == nullptr) {
+                return 0;
+            }
+            return 1 + std::max(heightOf(node->m_Left), heightOf(node->m_Right));
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param comparator
+         */
+        explicit TreeMap(Comparator comparator = Comparator()) : m_Comparator(std::move(comparator)) {}
+
+        /**
+         * Copy constructor
+         * @param other
+         */
+        TreeMap(const TreeMap& other) : m_Comparator(other.m_Comparator) {
+            Node* root = nullptr;
+            try {
+                copyTree(other.m_Root, nullptr, root);
+            } catch (...) {
+                clearNodes(root);
+                throw;
+            }
+            m_Root = root;
+            m_Size = other.m_Size;
+        }
+
+        /**
+         * Copy assignment. The map is unchanged if copying a key or value throws.
+         * @param other
+         * @return
+         */
+        TreeMap& operator=(const TreeMap& other) {
+            if (this != &other) {
+                *this = TreeMap(other);
+            }
+            return *this;
+        }
+
+        /**
+         * Move constructor
+         * @param other
+         */
+        TreeMap(TreeMap&& other) noexcept
+                : m_Size(std::exchange(other.m_Size, 0)), m_Root(std::exchange(other.m_Root, nullptr)),
+                  m_Nodes(std::move(other.m_Nodes)), m_Comparator(other.m_Comparator) {}
+
+        /**
+         * Move assignment
+         * @param other
+         * @return
+         */
+        TreeMap& operator=(TreeMap&& other) noexcept {
+            if (this != &other) {
+                clear();
+                m_Nodes = std::move(other.m_Nodes);
+                m_Comparator = other.m_Comparator;
+                m_Root = std::exchange(other.m_Root, nullptr);
+                m_Size = std::exchange(other.m_Size, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * Get the number of elements
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Check if container is empty
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return m_Size == 0;
+        }
+
+        /**
+         * Get the height of the tree, which is at most 2 log2(n + 1).
+         * @return
+         */
+        [[nodiscard]] std::size_t getHeight() const noexcept {
+            return heightOf(m_Root);
+        }
+
+        /**
+         * Retrieve the value mapped to a key.
+         * @param key
+         * @return std::optional holding a reference to the value, or std::nullopt if the key does not exist.
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const K& key) noexcept {
+            Node* node = findNode(key);
+            if (node == nullptr) {
+                return std::nullopt;
+            }
+            return node->m_Value;
+        }
+
+        /**
+         * Retrieve the value mapped to a key.
+         * @param key
+         * @return std::optional holding a const reference to the value, or std::nullopt if the key does not exist.
+         */
+        [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const K& key) const noexcept {
+            const Node* node = findNode(key);
+            if (node == nullptr) {
+                return std::nullopt;
+            }
+            return node->m_Value;
+        }
+
+        /**
+         * Check if a key exists
+         * @param key
+         * @return
+         */
+        [[nodiscard]] bool contains(const K& key) const noexcept {
+            return findNode(key) != nullptr;
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, const V& value) {
+            auto[node, inserted] = findOrInsert(key, value);
+            return {{node->m_Key, node->m_Value}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, then nothing happens.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insert(const K& key, V&& value) {
+            auto[node, inserted] = findOrInsert(key, std::move(value));
+            return {{node->m_Key, node->m_Value}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the value is replaced.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, const V& value) {
+            auto[node, inserted] = findOrInsert(key, value);
+            if (!inserted) {
+                node->m_Value = value;
+            }
+            return {{node->m_Key, node->m_Value}, inserted};
+        }
+
+        /**
+         * Insert key-value pair. If key already exists, the value is replaced.
+         * @param key
+         * @param value
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        std::pair<KeyValuePairResult, bool> insertOrReplace(const K& key, V&& value) {
+            Node* node = findNode(key);
+            if (node != nullptr) {
+                node->m_Value = std::move(value);
+                return {{node->m_Key, node->m_Value}, false};
+            }
+            return insert(key, std::move(value));
+        }
+
+        /**
+         * Construct value in-place. If key already exists, then nothing happens.
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        template<typename ... Ts>
+        std::pair<KeyValuePairResult, bool> emplace(const K& key, Ts&& ... args) {
+            auto[node, inserted] = findOrInsert(key, std::forward<Ts>(args)...);
+            return {{node->m_Key, node->m_Value}, inserted};
+        }
+
+        /**
+         * Construct value in-place, moving the key into the map. If key already exists, then nothing happens and the
+         * key is not moved from.
+         * @tparam Ts
+         * @param key
+         * @param args
+         * @return Pair of references to the key and the value in the map, and true if insertion occurred.
+         */
+        template<typename ... Ts>
+        std::pair<KeyValuePairResult, bool> emplace(K&& key, Ts&& ... args) {
+            auto[node, inserted] = findOrInsert(std::move(key), std::forward<Ts>(args)...);
+            return {{node->m_Key, node->m_Value}, inserted};
+        }
+
+        /**
+         * Remove the key-value pair with the key.
+         * @param key
+         * @return True if key was found and removed, false if not.
+         */
+        bool erase(const K& key) noexcept {
+            Node* node = findNode(key);
+            if (node == nullptr) {
+                return false;
+            }
+            eraseNode(node);
+            return true;
+        }
+
+        /**
+         * Remove the key-value pair an iterator points to.
+         * @param iterator Must not be the end
+         * @return Iterator to the next key-value pair
+         */
+        Iterator erase(Iterator iterator) noexcept {
+            Iterator next = std::next(iterator);
+            eraseNode(iterator.m_Node);
+            return next;
+        }
+
+        [[nodiscard]] Iterator begin() noexcept {
+            return {m_Root == nullptr ? nullptr : minimum(m_Root), &m_Root};
+        }
+
+        [[nodiscard]] ConstIterator begin() const noexcept {
+            return {m_Root == nullptr ? nullptr : minimum(m_Root), &m_Root};
+        }
+
+        [[nodiscard]] Iterator end() noexcept {
+            return {nullptr, &m_Root};
+        }
+
+        [[nodiscard]] ConstIterator end() const noexcept {
+            return {nullptr, &m_Root};
+        }
+
+        /**
+         * Find the key-value pair with the key.
+         * @param key
+         * @return Iterator to the key-value pair, or end() if the key does not exist.
+         */
+        [[nodiscard]] Iterator find(const K& key) noexcept {
+            return {findNode(key), &m_Root};
+        }
+
+        [[nodiscard]] ConstIterator find(const K& key) const noexcept {
+            return {findNode(key), &m_Root};
+        }
+
+        /**
+         * Find the first key-value pair whose key is not less than the key.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] Iterator lowerBound(const K& key) noexcept {
+            return {lowerBoundNode(key), &m_Root};
+        }
+
+        [[nodiscard]] ConstIterator lowerBound(const K& key) const noexcept {
+            return {lowerBoundNode(key), &m_Root};
+        }
+
+        /**
+         * Find the first key-value pair whose key is greater than the key.
+         * @param key
+         * @return
+         */
+        [[nodiscard]] Iterator upperBound(const K& key) noexcept {
+            return {upperBoundNode(key), &m_Root};
+        }
+
+        [[nodiscard]] ConstIterator upperBound(const K& key) const noexcept {
+            return {upperBoundNode(key), &m_Root};
+        }
+
+        /**
+         * The key-value pairs with keys from low, inclusive, to high, exclusive, for use in a range-based for loop.
+         * @param low
+         * @param high
+         * @return
+         */
+        [[nodiscard]] impl::ds::IteratorRange<Iterator> range(const K& low, const K& high) noexcept {
+            if (!m_Comparator(low, high)) {
+                return {end(), end()};
+            }
+            return {lowerBound(low), lowerBound(high)};
+        }
+
+        [[nodiscard]] impl::ds::IteratorRange<ConstIterator> range(const K& low, const K& high) const noexcept {
+            if (!m_Comparator(low, high)) {
+                return {end(), end()};
+            }
+            return {lowerBound(low), lowerBound(high)};
+        }
+
+        /**
+         * Remove all key-value pairs, passing each key and value to a function as rvalues in ascending order of keys,
+         * so that they can be moved out of the map.
+         * @tparam Func Callable taking K&& and V&&
+         * @param func
+         */
+        template<typename Func>
+        void drain(Func&& func) {
+            drainNodes(m_Root, func);
+            clear();
+        }
+
+        /**
+         * Remove all elements. Size reset to 0.
+         * If the nodes come from a NodePool, their memory is reclaimed all at once, and nodes are only visited if
+         * the keys or values have destructors to run.
+         */
+        void clear() noexcept {
+            if constexpr (NodeAllocator<Node>::SUPPORTS_RELEASE) {
+                if constexpr (!std::is_trivially_destructible_v<Node>) {
+                    clearNodes(m_Root);
+                }
+                m_Nodes.release();
+            } else {
+                clearNodes(m_Root);
+            }
+            m_Root = nullptr;
+            m_Size = 0;
+        }
+
+        /**
+         * Destructor
+         */
+        ~TreeMap() {
+            clear();
+        }
+
+    };
+
+}
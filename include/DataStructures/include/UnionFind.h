@@ -171,16 +171,9 @@ namespace wtl {
             if (outOfBounds(node1) || outOfBounds(node2)) {
                 throw std::invalid_argument("Invalid node");
             }
-            std::size_t node1parent = node1;
-            std::size_t node2parent = node2;
-            // Find the parent node of node 1
-            while (node1parent != m_Graph[node1parent]) {
-                node1parent = m_Graph[node1parent];
-            }
-            // Find the parent node of node 2
-            while (node2parent != m_Graph[node2parent]) {
-                node2parent = m_Graph[node2parent];
-            }
+            // Find the parent nodes, compressing both paths on the way
+            std::size_t node1parent = belongs(node1);
+            std::size_t node2parent = belongs(node2);
             // Both nodes belong to the same group, so don't carry out union
             if (node1parent == node2parent) {
                 return false;
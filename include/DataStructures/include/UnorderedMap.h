@@ -4,8 +4,12 @@
 
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <list>
+#include <optional>
+#include <type_traits>
 #include <utility>
+#include "impl/DataStructuresImpl.h"
 
 #pragma once
 
@@ -100,21 +104,72 @@ namespace wtl {
         /// Hashing algorithm
         Hash m_Hash;
 
+        /**
+         * Move every node into a new array of buckets. Nodes are spliced from the old lists into the new ones, so
+         * no element is copied or moved and no node is allocated. References to elements remain valid.
+         * @param bucketCount
+         */
+        void rehash(std::size_t bucketCount) noexcept {
+            auto* newBuckets = new std::list<Entry>[bucketCount];
+            for (std::size_t i = 0; i < m_BucketCount; i++) {
+                std::list<Entry>& bucket = m_Buckets[i];
+                while (!bucket.empty()) {
+                    std::size_t index = m_Hash(bucket.front().m_Key) % bucketCount;
+                    newBuckets[index].splice(newBuckets[index].end(), bucket, bucket.begin());
+                }
+            }
+            delete[] m_Buckets;
+            m_BucketCount = bucketCount;
+            m_Buckets = newBuckets;
+        }
+
+        /**
+         * Find the entry with a key equal to the query. The query is either a K or, if the hash is transparent,
+         * any type that the hash accepts and that compares equal with K.
+         * @tparam Q
+         * @param key
+         * @return Pointer to the entry, or nullptr if not found
+         */
+        template<typename Q>
+        [[nodiscard]] Entry* findEntry(const Q& key) const noexcept {
+            std::size_t index = m_Hash(key) % m_BucketCount;
+            for (Entry& entry : m_Buckets[index]) {
+                if (entry.m_Key == key) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * Erase the entry with a key equal to the query.
+         * @tparam Q
+         * @param key
+         * @return True if an entry was removed
+         */
+        template<typename Q>
+        bool eraseEntry(const Q& key) noexcept {
+            std::size_t index = m_Hash(key) % m_BucketCount;
+            auto iterator = m_Buckets[index].begin();
+            for (; iterator != m_Buckets[index].end(); ++iterator) {
+                if (iterator->m_Key == key) {
+                    break;
+                }
+            }
+            if (iterator != m_Buckets[index].end()) {
+                m_Buckets[index].erase(iterator);
+                --m_Size;
+                return true;
+            }
+            return false;
+        }
+
         /**
          * Double the number of buckets if the load factor exceeds the threshold. Rehashes the key-value pairs.
          */
         void expand() noexcept {
             if (getLoadFactor() >= MAXIMUM_LOAD_FACTOR) {
-                auto* newBuckets = new std::list<Entry>[m_BucketCount * 2];
-                for (std::size_t i = 0; i < m_BucketCount; i++) {
-                    for (const Entry& entry : m_Buckets[i]) {
-                        std::size_t index = m_Hash(entry.m_Key) % (m_BucketCount * 2);
-                        newBuckets[index].push_back(entry);
-                    }
-                }
-                delete[] m_Buckets;
-                m_BucketCount *= 2;
-                m_Buckets = newBuckets;
+                rehash(m_BucketCount * 2);
             }
         }
 
@@ -194,11 +249,8 @@ namespace wtl {
          * @return
          */
         [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const K& key) noexcept {
-            std::size_t index = m_Hash(key) % m_BucketCount;
-            for (Entry& entry : m_Buckets[index]) {
-                if (entry.m_Key == key) {
-                    return entry.m_Value;
-                }
+            if (Entry* entry = findEntry(key)) {
+                return entry->m_Value;
             }
             return std::nullopt;
         }
@@ -210,11 +262,39 @@ namespace wtl {
          * @return
          */
         [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const K& key) const noexcept {
-            std::size_t index = m_Hash(key) % m_BucketCount;
-            for (const Entry& entry : m_Buckets[index]) {
-                if (entry.m_Key == key) {
-                    return entry.m_Value;
-                }
+            if (const Entry* entry = findEntry(key)) {
+                return entry->m_Value;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Heterogeneous lookup, only available if Hash declares is_transparent. The key is never converted to K,
+         * so for example a std::string_view can be used to look up a std::string key without any allocation.
+         * Hash must give the same hash for the query as for an equal K.
+         * @tparam Q
+         * @param key
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        [[nodiscard]] std::optional<std::reference_wrapper<V>> at(const Q& key) noexcept {
+            if (Entry* entry = findEntry(key)) {
+                return entry->m_Value;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Heterogeneous lookup, only available if Hash declares is_transparent.
+         * @see at(const Q&)
+         * @tparam Q
+         * @param key
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        [[nodiscard]] std::optional<std::reference_wrapper<const V>> at(const Q& key) const noexcept {
+            if (const Entry* entry = findEntry(key)) {
+                return entry->m_Value;
             }
             return std::nullopt;
         }
@@ -225,10 +305,18 @@ namespace wtl {
          * @return True if key exists, false if not.
          */
         bool contains(const K& key) const noexcept {
-            if (at(key) == std::nullopt) {
-                return false;
-            }
-            return true;
+            return findEntry(key) != nullptr;
+        }
+
+        /**
+         * Heterogeneous version of contains(...), only available if Hash declares is_transparent.
+         * @tparam Q
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        bool contains(const Q& key) const noexcept {
+            return findEntry(key) != nullptr;
         }
 
         /**
@@ -303,7 +391,7 @@ namespace wtl {
             if (iterator == m_Buckets[index].end()) {
                 m_Buckets[index].push_back(Entry(key, value));
                 ++m_Size;
-                iterator = m_Buckets[index].end() - 1;
+                iterator = std::prev(m_Buckets[index].end());
                 return {{iterator->m_Key, iterator->m_Value}, true};
             } else {
                 iterator->m_Value = value;
@@ -333,7 +421,7 @@ namespace wtl {
             if (iterator == m_Buckets[index].end()) {
                 m_Buckets[index].push_back(Entry(key, std::move(value)));
                 ++m_Size;
-                iterator = m_Buckets[index].end() - 1;
+                iterator = std::prev(m_Buckets[index].end());
                 return {{iterator->m_Key, iterator->m_Value}, true};
             } else {
                 iterator->m_Value = std::move(value);
@@ -387,7 +475,7 @@ namespace wtl {
             if (iterator == m_Buckets[index].end()) {
                 m_Buckets[index].push_back(Entry(key, std::forward<Ts>(args)...));
                 ++m_Size;
-                iterator = m_Buckets[index].end() - 1;
+                iterator = std::prev(m_Buckets[index].end());
                 return {{iterator->m_Key, iterator->m_Value}, true};
             } else {
                 iterator->m_Value = V(std::forward<Ts>(args)...);
@@ -401,19 +489,55 @@ namespace wtl {
          * @return True if key was found and key-value pair was removed, false if not.
          */
         bool erase(const K& key) noexcept {
-            std::size_t index = m_Hash(key) % m_BucketCount;
-            auto iterator = m_Buckets[index].begin();
-            for (; iterator != m_Buckets[index].end(); ++iterator) {
-                if (iterator->m_Key == key) {
-                    break;
-                }
+            return eraseEntry(key);
+        }
+
+        /**
+         * Heterogeneous version of erase(...), only available if Hash declares is_transparent.
+         * @tparam Q
+         * @param key
+         * @return True if key was found and key-value pair was removed, false if not.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        bool erase(const Q& key) noexcept {
+            return eraseEntry(key);
+        }
+
+        /**
+         * Make sure that the specified number of elements can be stored without rehashing. The number of buckets
+         * is doubled as many times as needed in one go, so each element is only rehashed once.
+         * @param size
+         */
+        void reserve(std::size_t size) noexcept {
+            std::size_t s = m_BucketCount;
+            while (static_cast<double>(size) > static_cast<double>(s) * MAXIMUM_LOAD_FACTOR) {
+                s *= 2;
             }
-            if (iterator != m_Buckets[index].end()) {
-                m_Buckets[index].erase(iterator);
-                --m_Size;
-                return true;
+            if (s > m_BucketCount) {
+                rehash(s);
             }
-            return false;
+        }
+
+        /**
+         * Insert the key-value pairs in a range, such as that of a stl map or a container of std::pair. If the
+         * iterators are at least forward iterators, the table is sized up front for all of the elements.
+         * Keys that already exist are skipped, as in insert(...).
+         * @tparam Iterator
+         * @param first
+         * @param last
+         * @return Number of key-value pairs inserted
+         */
+        template<typename Iterator>
+        std::size_t insertRange(Iterator first, Iterator last) noexcept {
+            using Category = typename std::iterator_traits<Iterator>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+                reserve(m_Size + static_cast<std::size_t>(std::distance(first, last)));
+            }
+            std::size_t count = 0;
+            for (; first != last; ++first) {
+                count += insert(first->first, first->second).second;
+            }
+            return count;
         }
 
         /**
@@ -426,16 +550,7 @@ namespace wtl {
                 s *= 2;
             }
             if (s < m_BucketCount) {
-                std::list<Entry>* newBuckets = new std::list<Entry>[s];
-                for (std::size_t i = 0; i < m_BucketCount; i++) {
-                    for (const Entry& entry : m_Buckets[i]) {
-                        std::size_t index = m_Hash(entry.m_Key) % s;
-                        newBuckets[index].push_back(entry);
-                    }
-                }
-                delete[] m_Buckets;
-                m_BucketCount = s;
-                m_Buckets = newBuckets;
+                rehash(s);
                 return true;
             }
             return false;
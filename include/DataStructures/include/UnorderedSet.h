@@ -6,8 +6,12 @@
 
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <list>
+#include <optional>
+#include <type_traits>
 #include <utility>
+#include "impl/DataStructuresImpl.h"
 
 namespace wtl {
 
@@ -37,20 +41,71 @@ namespace wtl {
         Hash m_Hash;
 
         /**
-        * Double the number of buckets if the load factor exceeds the threshold. Rehashes the key-value pairs.
-        */
+         * Move every node into a new array of buckets. Nodes are spliced from the old lists into the new ones, so
+         * no element is copied or moved and no node is allocated. References to elements remain valid.
+         * @param bucketCount
+         */
+        void rehash(std::size_t bucketCount) noexcept {
+            auto* newBuckets = new std::list<K>[bucketCount];
+            for (std::size_t i = 0; i < m_BucketCount; i++) {
+                std::list<K>& bucket = m_Buckets[i];
+                while (!bucket.empty()) {
+                    std::size_t index = m_Hash(bucket.front()) % bucketCount;
+                    newBuckets[index].splice(newBuckets[index].end(), bucket, bucket.begin());
+                }
+            }
+            delete[] m_Buckets;
+            m_BucketCount = bucketCount;
+            m_Buckets = newBuckets;
+        }
+
+        /**
+         * Find the element equal to the query. The query is either a K or, if the hash is transparent, any type
+         * that the hash accepts and that compares equal with K.
+         * @tparam Q
+         * @param key
+         * @return Pointer to the element, or nullptr if not found
+         */
+        template<typename Q>
+        [[nodiscard]] const K* findKey(const Q& key) const noexcept {
+            std::size_t index = m_Hash(key) % m_BucketCount;
+            for (const K& entry : m_Buckets[index]) {
+                if (entry == key) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * Remove the element equal to the query.
+         * @tparam Q
+         * @param key
+         * @return True if an element was removed
+         */
+        template<typename Q>
+        bool eraseKey(const Q& key) noexcept {
+            std::size_t index = m_Hash(key) % m_BucketCount;
+            auto iterator = m_Buckets[index].begin();
+            for (; iterator != m_Buckets[index].end(); ++iterator) {
+                if (*iterator == key) {
+                    break;
+                }
+            }
+            if (iterator != m_Buckets[index].end()) {
+                m_Buckets[index].erase(iterator);
+                --m_Size;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Double the number of buckets if the load factor exceeds the threshold. Rehashes the key-value pairs.
+         */
         void expand() noexcept {
             if (getLoadFactor() >= MAXIMUM_LOAD_FACTOR) {
-                std::list<K>* newBuckets = new std::list<K>[m_BucketCount * 2];
-                for (std::size_t i = 0; i < m_BucketCount; i++) {
-                    for (const K& key : m_Buckets[i]) {
-                        std::size_t index = m_Hash(key) % (m_BucketCount * 2);
-                        newBuckets[index].push_back(key);
-                    }
-                }
-                delete[] m_Buckets;
-                m_BucketCount *= 2;
-                m_Buckets = newBuckets;
+                rehash(m_BucketCount * 2);
             }
         }
 
@@ -133,11 +188,24 @@ namespace wtl {
          * @return
          */
         [[nodiscard]] std::optional<std::reference_wrapper<const K>> find(const K& key) const noexcept {
-            std::size_t index = m_Hash(key) % m_BucketCount;
-            for (const K& entry : m_Buckets[index]) {
-                if (entry == key) {
-                    return entry;
-                }
+            if (const K* entry = findKey(key)) {
+                return *entry;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Heterogeneous lookup, only available if Hash declares is_transparent. The key is never converted to K,
+         * so for example a std::string_view can be used to look up a std::string element without any allocation.
+         * Hash must give the same hash for the query as for an equal K.
+         * @tparam Q
+         * @param key
+         * @return
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        [[nodiscard]] std::optional<std::reference_wrapper<const K>> find(const Q& key) const noexcept {
+            if (const K* entry = findKey(key)) {
+                return *entry;
             }
             return std::nullopt;
         }
@@ -148,10 +216,18 @@ namespace wtl {
          * @return True if key exists, false if not.
          */
         [[nodiscard]] bool contains(const K& key) const noexcept {
-            if (find(key) == std::nullopt) {
-                return false;
-            }
-            return true;
+            return findKey(key) != nullptr;
+        }
+
+        /**
+         * Heterogeneous version of contains(...), only available if Hash declares is_transparent.
+         * @tparam Q
+         * @param key
+         * @return True if key exists, false if not.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        [[nodiscard]] bool contains(const Q& key) const noexcept {
+            return findKey(key) != nullptr;
         }
 
         /**
@@ -225,19 +301,54 @@ namespace wtl {
          * @return True if key was found and removed, false if key not found.
          */
         bool erase(const K& key) noexcept {
-            std::size_t index = m_Hash(key) % m_BucketCount;
-            auto iterator = m_Buckets[index].begin();
-            for (; iterator != m_Buckets[index].end(); ++iterator) {
-                if (*iterator == key) {
-                    break;
-                }
+            return eraseKey(key);
+        }
+
+        /**
+         * Heterogeneous version of erase(...), only available if Hash declares is_transparent.
+         * @tparam Q
+         * @param key
+         * @return True if key was found and removed, false if key not found.
+         */
+        template<typename Q, typename = impl::ds::EnableIfTransparent<Hash, K, Q>>
+        bool erase(const Q& key) noexcept {
+            return eraseKey(key);
+        }
+
+        /**
+         * Make sure that the specified number of elements can be stored without rehashing. The number of buckets
+         * is doubled as many times as needed in one go, so each element is only rehashed once.
+         * @param size
+         */
+        void reserve(std::size_t size) noexcept {
+            std::size_t s = m_BucketCount;
+            while (static_cast<double>(size) > static_cast<double>(s) * MAXIMUM_LOAD_FACTOR) {
+                s *= 2;
             }
-            if (iterator != m_Buckets[index].end()) {
-                m_Buckets[index].erase(iterator);
-                --m_Size;
-                return true;
+            if (s > m_BucketCount) {
+                rehash(s);
             }
-            return false;
+        }
+
+        /**
+         * Insert the elements in a range. If the iterators are at least forward iterators, the table is sized up
+         * front for all of the elements. Elements that already exist are skipped, as in insert(...).
+         * @tparam Iterator
+         * @param first
+         * @param last
+         * @return Number of elements inserted
+         */
+        template<typename Iterator>
+        std::size_t insertRange(Iterator first, Iterator last) noexcept {
+            using Category = typename std::iterator_traits<Iterator>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+                reserve(m_Size + static_cast<std::size_t>(std::distance(first, last)));
+            }
+            std::size_t count = 0;
+            for (; first != last; ++first) {
+                count += insert(*first).second;
+            }
+            return count;
         }
 
         /**
@@ -250,16 +361,7 @@ namespace wtl {
                 s *= 2;
             }
             if (s < m_BucketCount) {
-                std::list<K>* newBuckets = new std::list<K>[s];
-                for (std::size_t i = 0; i < m_BucketCount; i++) {
-                    for (const K& key : m_Buckets[i]) {
-                        std::size_t index = m_Hash(key) % s;
-                        newBuckets[index].push_back(key);
-                    }
-                }
-                delete[] m_Buckets;
-                m_BucketCount = s;
-                m_Buckets = newBuckets;
+                rehash(s);
                 return true;
             }
             return false;
@@ -4,17 +4,37 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include <stdexcept>
 #include <initializer_list>
+#include "impl/DataStructuresImpl.h"
 
 namespace wtl {
 
+    /**
+     * A dynamically sized array. Elements are stored contiguously, and the storage grows by a factor of 1.5 when it is
+     * full. It shrinks by half only once less than a quarter of it is in use, so that alternating pushes and pops
+     * near a boundary do not reallocate every time.
+     * Trivially copyable elements are relocated using memcpy instead of one move and one destructor call each.
+     * @tparam T
+     */
     template<typename T>
     class Vector {
     private:
 
+        /// Whether elements can be relocated to new storage by copying their bytes
+        static constexpr bool TRIVIALLY_RELOCATABLE = std::is_trivially_copyable_v<T>;
+
+        /// Capacity that popBack() and clear() never shrink below
+        static constexpr std::size_t MINIMUM_CAPACITY = 2;
+
         // Pointer to underlying array storage
         T* m_Arr = nullptr;
 
@@ -37,18 +57,82 @@ namespace wtl {
         }
 
         /**
-         * Reallocate the contents of a filled storage into a new storage.
+         * Reallocate the contents of a filled storage into a new storage, leaving a gap of new elements at an index.
+         * The new elements are constructed before the old ones are relocated, so they can be copied from elements of
+         * the vector itself, and if constructing them throws, the vector is unchanged.
+         * @tparam Construct
          * @param newCapacity
+         * @param index Position of the gap, from 0 to m_Size
+         * @param count Number of new elements
+         * @param construct Function constructing the new elements at the address passed to it
          */
-        void reAllocate(std::size_t newCapacity) noexcept {
+        template<typename Construct>
+        void reAllocate(std::size_t newCapacity, std::size_t index, std::size_t count, Construct&& construct) {
             T* newArr = (T*) (::operator new(newCapacity * sizeof(T)));
-            for (std::size_t i = 0; i < m_Size; i++) {
-                new(&newArr[i]) T(std::move(m_Arr[i]));
-                m_Arr[i].~T();
+            try {
+                construct(newArr + index);
+            } catch (...) {
+                ::operator delete(newArr, newCapacity * sizeof(T));
+                throw;
             }
+            impl::ds::relocate(newArr, m_Arr, index);
+            impl::ds::relocate(newArr + index + count, m_Arr + index, m_Size - index);
             ::operator delete(m_Arr, m_Capacity * sizeof(T));
             m_Arr = newArr;
             m_Capacity = newCapacity;
+            m_Size += count;
+        }
+
+        /**
+         * Reallocate the contents of a filled storage into a new storage.
+         * @param newCapacity
+         */
+        void reAllocate(std::size_t newCapacity) noexcept {
+            reAllocate(newCapacity, m_Size, 0, [](T*) noexcept {});
+        }
+
+        /**
+         * Capacity to grow to for a number of extra elements. The storage grows by at least a factor of 1.5, so that
+         * repeated insertions still take amortised constant time per element.
+         * @param count
+         * @return
+         */
+        [[nodiscard]] std::size_t grownCapacity(std::size_t count) const noexcept {
+            return std::max({m_Size + count, m_Capacity + m_Capacity / 2, MINIMUM_CAPACITY});
+        }
+
+        /**
+         * Whether the elements from an index onwards can be shifted back before copying a range into the gap. This
+         * needs copies that cannot throw, and a range that is not inside the elements being shifted.
+         * @tparam Iterator
+         * @param index
+         * @param first
+         * @param last
+         * @return
+         */
+        template<typename Iterator>
+        [[nodiscard]] bool canShiftBeforeCopying(std::size_t index, Iterator first, Iterator last) const noexcept {
+            using Reference = typename std::iterator_traits<Iterator>::reference;
+            if constexpr (!TRIVIALLY_RELOCATABLE || !std::is_nothrow_constructible_v<T, Reference>) {
+                return false;
+            } else if constexpr (std::is_pointer_v<Iterator>) {
+                std::less<const void*> less;
+                return !less(m_Arr + index, last) || !less(first, m_Arr + m_Size);
+            } else {
+                return true;
+            }
+        }
+
+        /**
+         * Destroy all elements and free the storage.
+         */
+        void deallocate() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (std::size_t i = 0; i < m_Size; i++) {
+                    m_Arr[i].~T();
+                }
+            }
+            ::operator delete(m_Arr, m_Capacity * sizeof(T));
         }
 
     public:
@@ -98,11 +182,7 @@ namespace wtl {
          */
         Vector<T>& operator=(const Vector& other) noexcept {
             if (this != &other) {
-                for (std::size_t i = 0; i < m_Size; i++) {
-                    m_Arr[i].~T();
-                }
-                ::operator delete(m_Arr, m_Capacity * sizeof(m_Capacity));
-
+                deallocate();
                 m_Size = other.m_Size;
                 m_Capacity = other.m_Capacity;
                 m_Arr = (T*) (::operator new(m_Capacity * sizeof(T)));
@@ -114,17 +194,34 @@ namespace wtl {
         }
 
         /**
-         * Move constructor
+         * Move constructor. The storage of the other vector is taken over, and the other vector is left empty with
+         * no storage.
          * @param other
          */
-        Vector(Vector&& other) = delete;
+        Vector(Vector&& other) noexcept : m_Arr(other.m_Arr), m_Size(other.m_Size), m_Capacity(other.m_Capacity) {
+            other.m_Arr = nullptr;
+            other.m_Size = 0;
+            other.m_Capacity = 0;
+        }
 
         /**
-         * Move assignment
+         * Move assignment. The storage of the other vector is taken over, and the other vector is left empty with
+         * no storage.
          * @param other
          * @return
          */
-        Vector<T>& operator=(Vector&& other) = delete;
+        Vector<T>& operator=(Vector&& other) noexcept {
+            if (this != &other) {
+                deallocate();
+                m_Arr = other.m_Arr;
+                m_Size = other.m_Size;
+                m_Capacity = other.m_Capacity;
+                other.m_Arr = nullptr;
+                other.m_Size = 0;
+                other.m_Capacity = 0;
+            }
+            return *this;
+        }
 
         /**
          * Get the number of elements in the vector
@@ -203,11 +300,7 @@ namespace wtl {
          * @param value
          */
         void pushBack(const T& value) noexcept {
-            if (m_Size == m_Capacity) {
-                reAllocate(m_Capacity * 1.5);
-            }
-            new(&m_Arr[m_Size]) T(value);
-            m_Size++;
+            emplaceBack(value);
         }
 
         /**
@@ -215,15 +308,11 @@ namespace wtl {
          * @param value
          */
         void pushBack(T&& value) noexcept {
-            if (m_Size == m_Capacity) {
-                reAllocate(m_Capacity * 1.5);
-            }
-            new(&m_Arr[m_Size]) T(std::move(value));
-            m_Size++;
+            emplaceBack(std::move(value));
         }
 
         /**
-         * Construct an element in-place at the back of the vector
+         * Construct an element in-place at the back of the vector. The arguments may refer to elements of the vector.
          * @tparam Ts
          * @param args
          * @return Reference to the constructed element
@@ -231,21 +320,100 @@ namespace wtl {
         template<typename ... Ts>
         T& emplaceBack(Ts&& ... args) {
             if (m_Size == m_Capacity) {
-                reAllocate(m_Capacity * 1.5);
+                reAllocate(grownCapacity(1), m_Size, 1, [&args...](T* element) {
+                    new(element) T(std::forward<Ts>(args)...);
+                });
+            } else {
+                new(&m_Arr[m_Size]) T(std::forward<Ts>(args)...);
+                m_Size++;
             }
-            new(&m_Arr[m_Size]) T(std::forward<Ts>(args)...);
-            return m_Arr[m_Size++];
+            return m_Arr[m_Size - 1];
         }
 
         /**
-         * Remove the last element.
+         * Append the elements of a range at the back of the vector. If the iterators are at least forward iterators,
+         * the storage is grown once for the whole range. The range may be made of elements of the vector. If copying
+         * an element throws, the vector is unchanged.
+         * @tparam Iterator
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void append(Iterator first, Iterator last) {
+            insert(m_Size, first, last);
+        }
+
+        /**
+         * Insert the elements of a range before the specified index. The range may be made of elements of the
+         * vector. If copying an element throws, the vector is unchanged.
+         * When the storage has to grow, the range is copied into the new storage before the old elements are
+         * relocated around it. Otherwise, trivially copyable elements from the index onwards are moved back with
+         * memmove and the range copied into the gap, unless the range lies inside the elements being moved. In all
+         * other cases, the range is copied to the back and rotated into place.
+         * @tparam Iterator
+         * @param index Position of the first inserted element, from 0 to getSize()
+         * @param first
+         * @param last
+         */
+        template<typename Iterator>
+        void insert(std::size_t index, Iterator first, Iterator last) {
+            if (index > m_Size) {
+                throw std::out_of_range("Inserting at index out of range");
+            }
+            std::size_t oldSize = m_Size;
+            using Category = typename std::iterator_traits<Iterator>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+                auto count = static_cast<std::size_t>(std::distance(first, last));
+                if (m_Size + count > m_Capacity) {
+                    reAllocate(grownCapacity(count), index, count, [first, count](T* gap) {
+                        std::uninitialized_copy_n(first, count, gap);
+                    });
+                    return;
+                }
+                if (canShiftBeforeCopying(index, first, last)) {
+                    std::memmove(static_cast<void*>(m_Arr + index + count), static_cast<const void*>(m_Arr + index),
+                                 (m_Size - index) * sizeof(T));
+                    std::uninitialized_copy_n(first, count, m_Arr + index);
+                    m_Size += count;
+                    return;
+                }
+                std::uninitialized_copy_n(first, count, m_Arr + m_Size);
+                m_Size += count;
+            } else {
+                try {
+                    for (; first != last; ++first) {
+                        emplaceBack(*first);
+                    }
+                } catch (...) {
+                    while (m_Size > oldSize) {
+                        m_Arr[--m_Size].~T();
+                    }
+                    throw;
+                }
+            }
+            std::rotate(m_Arr + index, m_Arr + oldSize, m_Arr + m_Size);
+        }
+
+        /**
+         * Make sure that the specified number of elements can be stored without reallocating.
+         * @param capacity
+         */
+        void reserve(std::size_t capacity) noexcept {
+            if (capacity > m_Capacity) {
+                reAllocate(capacity);
+            }
+        }
+
+        /**
+         * Remove the last element. The capacity is halved once the vector is less than a quarter full, which leaves
+         * it half full, so that it takes many pushes or pops before the next reallocation.
          */
         void popBack() noexcept {
             if (m_Size > 0) {
                 m_Arr[--m_Size].~T();
             }
             std::size_t temp = m_Capacity / 2;
-            if ((m_Size < temp) && (temp >= 2)) {
+            if ((m_Size < m_Capacity / 4) && (temp >= MINIMUM_CAPACITY)) {
                 reAllocate(temp);
             }
         }
@@ -254,15 +422,8 @@ namespace wtl {
          * Shrink the vector to release unused memory, such that the capacity is equal to the size.
          */
         void shrinkToFit() noexcept {
-            if (m_Size >= 2 && m_Size < m_Capacity) {
-                T* temp = (T*) (::operator new(m_Size * sizeof(T)));
-                for (std::size_t i = 0; i < m_Size; i++) {
-                    new(&temp[i]) T(std::move(m_Arr[i]));
-                    m_Arr[i].~T();
-                }
-                ::operator delete(m_Arr, m_Capacity * sizeof(m_Capacity));
-                m_Capacity = m_Size;
-                m_Arr = temp;
+            if (m_Size >= MINIMUM_CAPACITY && m_Size < m_Capacity) {
+                reAllocate(m_Size);
             }
         }
 
@@ -270,15 +431,60 @@ namespace wtl {
          * Clear all elements in the vector. Size is reset to 0.
          */
         void clear() noexcept {
-            for (std::size_t i = 0; i < m_Size; i++) {
-                m_Arr[i].~T();
-            }
-            ::operator delete(m_Arr, m_Capacity * sizeof(m_Capacity));
+            deallocate();
             m_Size = 0;
-            m_Capacity = 2;
+            m_Capacity = MINIMUM_CAPACITY;
             m_Arr = (T*) (::operator new(m_Capacity * sizeof(T)));
         }
 
+        /**
+         * Get a pointer to the underlying storage.
+         * @return
+         */
+        [[nodiscard]] T* data() noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Get a pointer to the underlying storage.
+         * @return
+         */
+        [[nodiscard]] const T* data() const noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Iterator to the first element, so that the vector can be used in range-based for loops.
+         * @return
+         */
+        [[nodiscard]] T* begin() noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Iterator to the first element.
+         * @return
+         */
+        [[nodiscard]] const T* begin() const noexcept {
+            return m_Arr;
+        }
+
+        /**
+         * Iterator past the last element.
+         * @return
+         */
+        [[nodiscard]] T* end() noexcept {
+            return m_Arr + m_Size;
+        }
+
+        /**
+         * Iterator past the last element.
+         * @return
+         */
+        [[nodiscard]] const T* end() const noexcept {
+            return m_Arr + m_Size;
+        }
+
         /**
          * Check if 2 vectors are equal. They are equal if the number of elements are equal,
          * and the elements at each index are equal.
@@ -310,10 +516,7 @@ namespace wtl {
          * Destructor
          */
         ~Vector() {
-            for (std::size_t i = 0; i < m_Size; i++) {
-                m_Arr[i].~T();
-            }
-            ::operator delete(m_Arr, m_Capacity * sizeof(m_Capacity));
+            deallocate();
         }
 
     };
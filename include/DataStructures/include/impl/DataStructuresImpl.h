@@ -4,8 +4,161 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace wtl::impl::ds {
 
+    /// Size of a cache line on the targeted processors, used to keep data written by different threads apart
+    constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * Mix the bits of a hash value into 64 bits using Fibonacci hashing, for structures that take bits from both
+     * halves of the result even where std::size_t is 32 bits.
+     * @param hash
+     * @return
+     */
+    inline std::uint64_t mixHash64(std::uint64_t hash) noexcept {
+        std::uint64_t mixed = hash * 0x9E3779B97F4A7C15ull;
+        return mixed ^ (mixed >> 32);
+    }
+
+    /**
+     * Mix the bits of a hash value using Fibonacci hashing.
+     * std::hash of integral types is usually the identity function, so hash tables that index using the lower bits
+     * of the hash need the upper bits to be folded in first.
+     * @param hash
+     * @return
+     */
+    inline std::size_t mixHash(std::size_t hash) noexcept {
+        return static_cast<std::size_t>(mixHash64(hash));
+    }
+
+    /**
+     * Upper half of the bits of a hash value, for picking a shard or stripe when the lower bits of the same hash are
+     * used for something else. Unlike a shift by 32, this works whatever the width of std::size_t.
+     * @param hash
+     * @return
+     */
+    inline std::size_t upperHalf(std::size_t hash) noexcept {
+        return hash >> (std::numeric_limits<std::size_t>::digits / 2);
+    }
+
+    /**
+     * Floor of the base 2 logarithm of a positive integer, computed from the number of leading zero bits instead of
+     * in floating point. Value must not be 0.
+     * @param value
+     * @return
+     */
+    inline std::size_t floorLog2(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(63 - __builtin_clzll(value));
+#else
+        std::size_t log = 0;
+        while (value >>= 1) {
+            ++log;
+        }
+        return log;
+#endif
+    }
+
+    /**
+     * Index of the lowest set bit of a 64 bit integer. Value must not be 0.
+     * @param value
+     * @return
+     */
+    inline std::size_t countTrailingZeros(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+        std::size_t count = 0;
+        while ((value & 1u) == 0) {
+            value >>= 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * Move elements from one storage to another storage that does not overlap it. The source elements are destroyed.
+     * Trivially copyable elements are copied with a single memcpy.
+     * @tparam T
+     * @param destination Uninitialised storage
+     * @param source
+     * @param count
+     */
+    template<typename T>
+    void relocate(T* destination, T* source, std::size_t count) noexcept {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+            }
+        } else {
+            for (std::size_t i = 0; i < count; i++) {
+                new(&destination[i]) T(std::move(source[i]));
+                source[i].~T();
+            }
+        }
+    }
+
+    /**
+     * Check if a hash or comparator functor declares an is_transparent member type, which allows containers to look
+     * up keys using a type other than the key type.
+     * @tparam T
+     */
+    template<typename T, typename = void>
+    struct IsTransparent : std::false_type {
+    };
+
+    template<typename T>
+    struct IsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type {
+    };
+
+    /**
+     * Enables a heterogeneous lookup overload only if the functor is transparent and the query type is not already
+     * the key type, so that lookups with the key type itself still pick the non-template overload.
+     * @tparam Functor
+     * @tparam K Key type
+     * @tparam Q Query type
+     */
+    template<typename Functor, typename K, typename Q>
+    using EnableIfTransparent = std::enable_if_t<IsTransparent<Functor>::value &&
+                                                 !std::is_same_v<std::remove_cv_t<std::remove_reference_t<Q>>, K>>;
+
+    /**
+     * A pair of iterators that can be used in a range-based for loop.
+     * @tparam Iterator
+     */
+    template<typename Iterator>
+    class IteratorRange {
+    private:
+
+        Iterator m_Begin;
+
+        Iterator m_End;
+
+    public:
+
+        IteratorRange(Iterator begin, Iterator end) noexcept : m_Begin(begin), m_End(end) {}
+
+        [[nodiscard]] Iterator begin() const noexcept {
+            return m_Begin;
+        }
+
+        [[nodiscard]] Iterator end() const noexcept {
+            return m_End;
+        }
+
+    };
+
     /**
      * Standard comparator functor, similar to std::less.
      * @tparam T
@@ -17,6 +170,44 @@ namespace wtl::impl::ds {
         }
     };
 
+    /**
+     * Answer a range of range queries, writing the results to an output iterator in the same order. Each query is a
+     * pair of inclusive indexes. If a query throws, such as when it is out of range, the results of the queries before
+     * it have already been written.
+     * @tparam RangeIterator Iterator over std::pair<std::size_t, std::size_t>, or similar
+     * @tparam OutputIterator
+     * @tparam Query Callable that checks the two indexes of a query and answers it
+     * @param first
+     * @param last
+     * @param out
+     * @param query
+     * @return Output iterator past the last result written
+     */
+    template<typename RangeIterator, typename OutputIterator, typename Query>
+    OutputIterator batchRangeQuery(RangeIterator first, RangeIterator last, OutputIterator out, const Query& query) {
+        for (; first != last; ++first) {
+            *out = query(first->first, first->second);
+            ++out;
+        }
+        return out;
+    }
+
+    /**
+     * Answer a batch of range queries, each a pair of inclusive indexes.
+     * @tparam T Type of a result
+     * @tparam Query Callable that checks the two indexes of a query and answers it
+     * @param ranges
+     * @param query
+     * @return Results in the same order as the queries
+     */
+    template<typename T, typename Query>
+    std::vector<T> batchRangeQuery(const std::vector<std::pair<std::size_t, std::size_t>>& ranges, const Query& query) {
+        std::vector<T> results;
+        results.reserve(ranges.size());
+        batchRangeQuery(ranges.begin(), ranges.end(), std::back_inserter(results), query);
+        return results;
+    }
+
     /**
      * Wrapper around a standard binary predicate.
      * @tparam T
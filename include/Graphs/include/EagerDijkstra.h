@@ -13,7 +13,7 @@
 
 #include "SimpleGraph_Weighted.h"
 #include "Edges/Edges.h"
-#include "IndexedPriorityQueue.h"
+#include "DenseIndexedPriorityQueue.h"
 
 namespace wtl {
 
@@ -57,7 +57,7 @@ namespace wtl {
 
         using Graph = SimpleGraph_Weighted<directed>;
         using Element = impl::EagerDijkstra_Element;
-        using IPQ = wtl::IndexedPriorityQueue<std::size_t, double, impl::EagerDijkstra_Compare>;
+        using IPQ = wtl::DenseIndexedPriorityQueue<double, impl::EagerDijkstra_Compare, 4>;
 
         /// Number of vertices
         const std::size_t m_Size;
@@ -96,7 +96,7 @@ namespace wtl {
         }
 
         void performDijkstra(const Graph& graph) {
-            IPQ ipq;
+            IPQ ipq(m_Size);
             ipq.insert(m_Source, 0.0);
             while (!ipq.isEmpty()) {
                 std::size_t v = ipq.peek().first;
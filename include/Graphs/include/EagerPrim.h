@@ -10,7 +10,7 @@
 #include <iterator>
 
 #include "Edges/Edges.h"
-#include "IndexedPriorityQueue.h"
+#include "DenseIndexedPriorityQueue.h"
 #include "SimpleGraph_Weighted.h"
 
 namespace wtl {
@@ -34,7 +34,7 @@ namespace wtl {
         using Edge = WeightedUndirectedEdge;
         using Bucket = std::list<Edge>;
         using Compare = impl::EagerPrimCompare;
-        using IPQ = wtl::IndexedPriorityQueue<double, Edge, Compare>;
+        using IPQ = wtl::DenseIndexedPriorityQueue<Edge, Compare, 4>;
 
         /// Number of vertices in the graph
         std::size_t m_Size = 0;
@@ -63,12 +63,11 @@ namespace wtl {
             }
         }
 
-        void primProcess(const Graph& graph, std::size_t i, bool inMST[]) {
+        void primProcess(const Graph& graph, IPQ& ipq, std::size_t i, bool inMST[]) {
             inMST[i] = true;
             m_Id[i] = m_Buckets.size() - 1;
             auto iter = m_Buckets.end();
             std::advance(iter, -1);
-            IPQ ipq;
             cut(graph, ipq, i, inMST);
             while (!ipq.isEmpty()) {
                 Edge edge = ipq.peek().second;
@@ -91,13 +90,15 @@ namespace wtl {
         explicit EagerPrim(const Graph& graph) : m_Size(graph.vertex()),
                                                  m_Id(std::make_unique<std::size_t[]>(m_Size)) {
             std::unique_ptr<bool[]> inMST = std::make_unique<bool[]>(m_Size);
+            // Shared by every tree of the forest, since it is empty again after each one
+            IPQ ipq(m_Size);
             for (std::size_t i = 0; i < m_Size; i++) {
                 inMST[i] = false;
             }
             for (std::size_t i = 0; i < m_Size; i++) {
                 if (!inMST[i]) {
                     m_Buckets.push_back(Bucket());
-                    primProcess(graph, i, inMST.get());
+                    primProcess(graph, ipq, i, inMST.get());
                 }
             }
         }
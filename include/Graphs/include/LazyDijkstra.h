@@ -26,8 +26,6 @@ namespace wtl {
 
             LazyDijkstra_Element(std::size_t v, double weight) : m_V(v), m_Weight(weight) {}
 
-            LazyDijkstra_Element(const LazyDijkstra_Element& other) : m_V(other.m_V), m_Weight(other.m_Weight) {}
-
             bool operator<(const LazyDijkstra_Element& other) const {
                 return other.m_Weight < m_Weight;
             }
@@ -50,7 +48,8 @@ namespace wtl {
 
         using Graph = SimpleGraph_Weighted<directed>;
         using Element = impl::LazyDijkstra_Element;
-        using PQ = wtl::PriorityQueue<Element>;
+        /// 4-ary heap, which is shallower than a binary heap and keeps the children of a node on one cache line
+        using PQ = wtl::PriorityQueue<Element, impl::ds::StandardComparator<Element>, 4>;
 
         /// Number of vertices
         const std::size_t m_Size;
@@ -90,6 +89,10 @@ namespace wtl {
             while (!pq.isEmpty()) {
                 Element element = pq.peek();
                 pq.poll();
+                // A shorter path to this vertex was found after this element was inserted
+                if (element.m_Weight > m_DistTo[element.m_V]) {
+                    continue;
+                }
                 relax(graph, pq, element.m_V);
             }
         }
@@ -41,7 +41,7 @@ namespace wtl {
         using Edge = WeightedUndirectedEdge;
         using Bucket = std::list<Edge>;
         using Compare = impl::LazyPrimComparator;
-        using PQ = wtl::PriorityQueue<Edge, Compare>;
+        using PQ = wtl::PriorityQueue<Edge, Compare, 4>;
 
         /// Number of vertices in the graph
         std::size_t m_Size = 0;
@@ -0,0 +1,245 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "RollbackUnionFind.h"
+
+namespace wtl {
+
+    /**
+     * Answers whether two nodes are connected at given points in time, for an undirected graph whose edges are added
+     * and removed over time, when all the events and queries are known in advance.
+     * Each event moves time forward by one: time t is the graph after the first t events, so time 0 is the graph with
+     * no edges. Adding the same edge several times is allowed, and each removal removes one of the copies.
+     * Each edge is alive over an interval of time, which is split between O(logT) nodes of a segment tree over time.
+     * A depth first traversal of the segment tree joins the edges of a node on the way down and rolls them back on
+     * the way up, using a RollbackUnionFind, so the union find holds exactly the graph at time t when leaf t is
+     * reached. Solving takes O((E logT + Q) logn) time for E edges, T events and Q queries.
+     */
+    class OfflineDynamicConnectivity {
+    public:
+
+        /**
+         * Question of whether two nodes are connected at a point in time.
+         */
+        struct Query {
+            /// Number of events that have occurred
+            std::size_t time;
+            std::size_t node1;
+            std::size_t node2;
+        };
+
+    private:
+
+        using Edge = std::pair<std::size_t, std::size_t>;
+
+        /**
+         * Edge that is alive from time start (inclusive) to time end (exclusive).
+         */
+        struct Interval {
+            std::size_t start;
+            std::size_t end;
+            Edge edge;
+        };
+
+        /// Number of nodes
+        std::size_t m_Size = 0;
+
+        /// Number of events so far
+        std::size_t m_Time = 0;
+
+        /// Edges that have been removed, with the interval they were alive for
+        std::vector<Interval> m_Intervals;
+
+        /// Time each copy of an edge that is alive now was added
+        std::map<Edge, std::vector<std::size_t>> m_Alive;
+
+        [[nodiscard]] Edge makeEdge(std::size_t node1, std::size_t node2) const {
+            if (node1 >= m_Size || node2 >= m_Size) {
+                throw std::invalid_argument("Invalid node");
+            }
+            return node1 < node2 ? Edge(node1, node2) : Edge(node2, node1);
+        }
+
+        /**
+         * Visit a node of the segment tree over time, and the nodes below it. Nodes without any queries in their range
+         * of time are skipped.
+         * @param node Index of the node
+         * @param start First time covered by the node
+         * @param end One past the last time covered by the node
+         * @param edgeOffsets Index in edges of the first edge of each node, and one past the last
+         * @param edges Edges of each node, one node after another
+         * @param queryOffsets Index in queries of the first query at each time, and one past the last
+         * @param queries Indexes of the queries at each time, one time after another
+         * @param input
+         * @param unionFind
+         * @param results
+         */
+        void visit(std::size_t node, std::size_t start, std::size_t end, const std::vector<std::size_t>& edgeOffsets,
+                   const std::vector<Edge>& edges, const std::vector<std::size_t>& queryOffsets,
+                   const std::vector<std::size_t>& queries, const std::vector<Query>& input,
+                   RollbackUnionFind& unionFind, std::vector<bool>& results) const {
+            if (start > m_Time || queryOffsets[start] == queryOffsets[std::min(end, m_Time + 1)]) {
+                return;
+            }
+            RollbackUnionFind::Snapshot snapshot = unionFind.snapshot();
+            for (std::size_t i = edgeOffsets[node]; i < edgeOffsets[node + 1]; i++) {
+                unionFind.join(edges[i].first, edges[i].second);
+            }
+            if (end - start == 1) {
+                for (std::size_t i = queryOffsets[start]; i < queryOffsets[start + 1]; i++) {
+                    const Query& query = input[queries[i]];
+                    results[queries[i]] = unionFind.connected(query.node1, query.node2);
+                }
+            } else {
+                std::size_t middle = start + (end - start) / 2;
+                visit(node * 2, start, middle, edgeOffsets, edges, queryOffsets, queries, input, unionFind, results);
+                visit(node * 2 + 1, middle, end, edgeOffsets, edges, queryOffsets, queries, input, unionFind, results);
+            }
+            unionFind.rollback(snapshot);
+        }
+
+    public:
+
+        /**
+         * Constructor
+         * @param size Number of nodes
+         */
+        explicit OfflineDynamicConnectivity(std::size_t size) : m_Size(size) {
+            if (size <= 0) {
+                throw std::invalid_argument("Number of nodes cannot be less than 1");
+            }
+        }
+
+        /**
+         * Get the number of nodes.
+         * @return
+         */
+        [[nodiscard]] std::size_t getSize() const noexcept {
+            return m_Size;
+        }
+
+        /**
+         * Get the number of events so far, which is the latest time that can be queried.
+         * @return
+         */
+        [[nodiscard]] std::size_t getTime() const noexcept {
+            return m_Time;
+        }
+
+        /**
+         * Add an edge between two nodes.
+         * @param node1
+         * @param node2
+         */
+        void addEdge(std::size_t node1, std::size_t node2) {
+            Edge edge = makeEdge(node1, node2);
+            m_Alive[edge].push_back(++m_Time);
+        }
+
+        /**
+         * Remove an edge between two nodes, which must have been added and not yet removed.
+         * @param node1
+         * @param node2
+         */
+        void removeEdge(std::size_t node1, std::size_t node2) {
+            Edge edge = makeEdge(node1, node2);
+            auto it = m_Alive.find(edge);
+            if (it == m_Alive.end()) {
+                throw std::invalid_argument("Edge does not exist");
+            }
+            m_Intervals.push_back({it->second.back(), ++m_Time, edge});
+            it->second.pop_back();
+            if (it->second.empty()) {
+                m_Alive.erase(it);
+            }
+        }
+
+        /**
+         * Answer a batch of queries. Edges that have not been removed are alive until the latest time.
+         * @param queries
+         * @return For each query in the same order, true if its nodes are connected at its time
+         */
+        [[nodiscard]] std::vector<bool> solve(const std::vector<Query>& queries) const {
+            for (const Query& query : queries) {
+                if (query.time > m_Time) {
+                    throw std::invalid_argument("Invalid time");
+                }
+                if (query.node1 >= m_Size || query.node2 >= m_Size) {
+                    throw std::invalid_argument("Invalid node");
+                }
+            }
+            std::size_t leafCount = 1;
+            while (leafCount < m_Time + 1) {
+                leafCount <<= 1;
+            }
+
+            // Split each interval between the nodes of the segment tree that cover it, counting them per node first
+            std::vector<Interval> intervals = m_Intervals;
+            for (const auto& [edge, starts] : m_Alive) {
+                for (std::size_t start : starts) {
+                    intervals.push_back({start, m_Time + 1, edge});
+                }
+            }
+            auto forEachNode = [leafCount](const Interval& interval, auto&& function) {
+                std::size_t l = interval.start + leafCount;
+                std::size_t r = interval.end + leafCount;
+                for (; l < r; l >>= 1, r >>= 1) {
+                    if (l & 1) {
+                        function(l++);
+                    }
+                    if (r & 1) {
+                        function(--r);
+                    }
+                }
+            };
+            std::vector<std::size_t> edgeOffsets(2 * leafCount + 1, 0);
+            for (const Interval& interval : intervals) {
+                forEachNode(interval, [&edgeOffsets](std::size_t node) { edgeOffsets[node + 1]++; });
+            }
+            for (std::size_t node = 0; node < 2 * leafCount; node++) {
+                edgeOffsets[node + 1] += edgeOffsets[node];
+            }
+            std::vector<Edge> edges(edgeOffsets.back());
+            std::vector<std::size_t> edgeCursor(edgeOffsets.begin(), edgeOffsets.end() - 1);
+            for (const Interval& interval : intervals) {
+                forEachNode(interval, [&](std::size_t node) { edges[edgeCursor[node]++] = interval.edge; });
+            }
+
+            // Group the queries by time
+            std::vector<std::size_t> queryOffsets(m_Time + 2, 0);
+            for (const Query& query : queries) {
+                queryOffsets[query.time + 1]++;
+            }
+            for (std::size_t time = 0; time <= m_Time; time++) {
+                queryOffsets[time + 1] += queryOffsets[time];
+            }
+            std::vector<std::size_t> queryIndexes(queries.size());
+            std::vector<std::size_t> queryCursor(queryOffsets.begin(), queryOffsets.end() - 1);
+            for (std::size_t i = 0; i < queries.size(); i++) {
+                queryIndexes[queryCursor[queries[i].time]++] = i;
+            }
+
+            std::vector<bool> results(queries.size(), false);
+            RollbackUnionFind unionFind(m_Size);
+            visit(1, 0, leafCount, edgeOffsets, edges, queryOffsets, queryIndexes, queries, unionFind, results);
+            return results;
+        }
+
+        /**
+         * Destructor
+         */
+        ~OfflineDynamicConnectivity() = default;
+
+    };
+
+}
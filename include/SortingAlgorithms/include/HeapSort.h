@@ -5,6 +5,7 @@
 #pragma once
 
 #include "impl/SortingAlgorithmsImpl.h"
+#include "Heap.h"
 #include <cstddef>
 #include <vector>
 #include <utility>
@@ -12,52 +13,14 @@
 namespace wtl {
 
     /**
-     * Recursive heap sort algorithm
+     * Iterative heap sort algorithm. The elements are arranged into a d-ary max heap in O(n) time, and the root is
+     * then repeatedly moved to the end of the unsorted part.
      * @tparam T
+     * @tparam Comparator
+     * @tparam Arity Number of children of each node of the heap
      */
-    template<typename T, typename Comparator = impl::sort::StandardComparator<T>>
+    template<typename T, typename Comparator = impl::sort::StandardComparator<T>, std::size_t Arity = 2>
     class HeapSort {
-    private:
-
-        static void constructHeap(std::vector<T>& arr, const Comparator& comparator) {
-            heapify(arr, 1, arr.size(), comparator);
-        }
-
-        static void
-        heapify(std::vector<T>& arr, std::size_t root, std::size_t numberOfElements, const Comparator& comparator) {
-            if (root * 2 > numberOfElements) {
-                return;
-            }
-            std::size_t leftNode = 2 * root;
-            std::size_t rightNode = leftNode + 1;
-            heapify(arr, leftNode, numberOfElements, comparator);
-            if (rightNode <= numberOfElements) {
-                heapify(arr, rightNode, numberOfElements, comparator);
-            }
-            fixHeap(arr, root, numberOfElements, comparator);
-        }
-
-        static void
-        fixHeap(std::vector<T>& arr, std::size_t root, std::size_t numberOfElements, const Comparator& comparator) {
-            if (root * 2 > numberOfElements) {
-                return;
-            }
-            std::size_t leftNode = 2 * root;
-            std::size_t rightNode = leftNode + 1;
-            std::size_t childIndex = -1;
-            if (rightNode <= numberOfElements) {
-                // arr[leftNode - 1] >= arr[rightNode - 1]
-                childIndex = (comparator(arr[rightNode - 1], arr[leftNode - 1]) ||
-                              !comparator(arr[leftNode - 1], arr[rightNode - 1])) ? leftNode : rightNode;
-            } else {
-                childIndex = leftNode;
-            }
-            if (comparator(arr[root - 1], arr[childIndex - 1])) {
-                std::swap(arr[root - 1], arr[childIndex - 1]);
-                fixHeap(arr, childIndex, numberOfElements, comparator);
-            }
-        }
-
     public:
 
         /**
@@ -73,10 +36,9 @@ namespace wtl {
             if (size < 2) {
                 return;
             }
-            constructHeap(arr, comparator);
-            for (std::size_t i = 0; i < size; i++) {
-                std::swap(arr[0], arr[size - i - 1]);
-                fixHeap(arr, 1, size - i - 1, comparator);
+            impl::heap::build<Arity>(arr.data(), size, comparator);
+            for (std::size_t i = size; i > 1; i--) {
+                impl::heap::popRoot<Arity>(arr.data(), i, comparator);
             }
         }
     };
@@ -8,12 +8,39 @@
 // Data Structures
 #include "include/Array_uut.h"
 #include "include/UnionFind_uut.h"
+#include "include/ConcurrentUnionFind_uut.h"
+#include "include/RollbackUnionFind_uut.h"
 #include "include/FenwickTree_uut.h"
+#include "include/RangeFenwickTree_uut.h"
+#include "include/FenwickTree2D_uut.h"
 #include "include/SparseTable_uut.h"
+#include "include/DisjointSparseTable_uut.h"
+#include "include/CompactRMQ_uut.h"
+#include "include/SegmentTree_uut.h"
 #include "include/UnorderedSet_uut.h"
+#include "include/UnorderedMap_uut.h"
 #include "include/ClosedMap_uut.h"
 #include "include/BiMap_uut.h"
+#include "include/FlatBiMap_uut.h"
+#include "include/Heap_uut.h"
+#include "include/PairingHeap_uut.h"
 #include "include/IndexedPriorityQueue_uut.h"
+#include "include/DenseIndexedPriorityQueue_uut.h"
 #include "include/Queue_uut.h"
+#include "include/FlatMap_uut.h"
+#include "include/RobinHoodMap_uut.h"
+#include "include/ConcurrentMap_uut.h"
+#include "include/ConcurrentFenwickTree_uut.h"
+#include "include/BloomFilter_uut.h"
+#include "include/CuckooFilter_uut.h"
+#include "include/FilteredContainer_uut.h"
+#include "include/Vector_uut.h"
+#include "include/SmallVector_uut.h"
+#include "include/NodePool_uut.h"
+#include "include/TreeMap_uut.h"
+#include "include/BTreeMap_uut.h"
+#include "include/RingQueue_uut.h"
+#include "include/SpscQueue_uut.h"
+#include "include/MpmcQueue_uut.h"
 
 #endif // !CATCH_CONFIG_MAIN
\ No newline at end of file
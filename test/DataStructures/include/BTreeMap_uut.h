@@ -0,0 +1,374 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BTreeMap.h"
+#include "Entity.h"
+
+TEST_CASE("BTreeMap test") {
+
+    constexpr int size = 1000;
+    wtl::BTreeMap<int, wtl_test::Entity> map;
+    for (int i = 0; i < size; i++) {
+        map.insert((i * 7) % size, wtl_test::Entity((i * 7) % size));
+    }
+
+    SECTION("Searching for object") {
+        REQUIRE(map.getSize() == size);
+        REQUIRE(map.getHeight() == 2);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(map.at(i).value().get().m_Id == i);
+        }
+        REQUIRE(map.contains(-1) == false);
+        REQUIRE(map.at(size).has_value() == false);
+    }
+
+    SECTION("Insert or replace") {
+        REQUIRE(map.insert(1, wtl_test::Entity(-1)).second == false);
+        REQUIRE(map.at(1).value().get().m_Id == 1);
+        REQUIRE(map.insertOrReplace(1, wtl_test::Entity(-1)).second == false);
+        REQUIRE(map.at(1).value().get().m_Id == -1);
+        auto[result, inserted] = map.emplace(size, 5);
+        REQUIRE(inserted == true);
+        REQUIRE(result.first.get() == size);
+        REQUIRE(result.second.get().m_Id == 5);
+    }
+
+    SECTION("Iterating") {
+        int expected = 0;
+        for (auto[key, value] : map) {
+            REQUIRE(key == expected);
+            REQUIRE(value.m_Id == expected);
+            value.m_Id = -expected;
+            expected++;
+        }
+        REQUIRE(expected == size);
+        REQUIRE(map.at(10).value().get().m_Id == -10);
+
+        const auto& constMap = map;
+        auto last = std::prev(constMap.end());
+        REQUIRE(last->first == size - 1);
+        REQUIRE(std::distance(constMap.begin(), constMap.end()) == size);
+        expected = size;
+        for (auto iterator = constMap.end(); iterator != constMap.begin();) {
+            REQUIRE((--iterator)->first == --expected);
+        }
+        REQUIRE(expected == 0);
+    }
+
+    SECTION("Bounds and ranges") {
+        wtl::BTreeMap<std::uint64_t, std::uint64_t> evens;
+        for (std::uint64_t i = 0; i < 1000; i += 2) {
+            evens.insert(i, i * i);
+        }
+        REQUIRE((*evens.lowerBound(10)).first == 10);
+        REQUIRE((*evens.lowerBound(11)).first == 12);
+        REQUIRE((*evens.upperBound(10)).first == 12);
+        REQUIRE(evens.lowerBound(999) == evens.end());
+        REQUIRE(evens.upperBound(998) == evens.end());
+        REQUIRE(evens.find(7) == evens.end());
+        REQUIRE(evens.find(8)->second == 64);
+
+        std::vector<std::uint64_t> keys;
+        for (auto[key, value] : evens.range(15, 25)) {
+            keys.push_back(key);
+        }
+        REQUIRE(keys == std::vector<std::uint64_t>{16, 18, 20, 22, 24});
+        REQUIRE(evens.range(25, 15).begin() == evens.end());
+
+        keys.clear();
+        evens.forEachInRange(101, 901, [&keys](std::uint64_t key, std::uint64_t value) {
+            REQUIRE(value == key * key);
+            keys.push_back(key);
+        });
+        REQUIRE(keys.size() == 400);
+        REQUIRE(keys.front() == 102);
+        REQUIRE(keys.back() == 900);
+    }
+
+    SECTION("Erasing") {
+        for (int i = 0; i < size; i += 2) {
+            REQUIRE(map.erase(i) == true);
+        }
+        REQUIRE(map.erase(0) == false);
+        REQUIRE(map.getSize() == size / 2);
+        auto iterator = map.erase(map.find(1));
+        REQUIRE(iterator->first == 3);
+        int expected = 3;
+        for (auto[key, value] : map) {
+            REQUIRE(key == expected);
+            expected += 2;
+        }
+        for (int i = 3; i < size; i += 2) {
+            REQUIRE(map.erase(i) == true);
+        }
+        REQUIRE(map.empty() == true);
+        REQUIRE(map.getHeight() == 0);
+        REQUIRE(map.begin() == map.end());
+        map.insert(1, wtl_test::Entity(1));
+        REQUIRE(map.at(1).value().get().m_Id == 1);
+    }
+
+    SECTION("Copying and moving") {
+        wtl::BTreeMap<int, wtl_test::Entity> copy(map);
+        map.erase(0);
+        REQUIRE(copy.getSize() == size);
+        REQUIRE(copy.at(0).value().get().m_Id == 0);
+
+        wtl::BTreeMap<int, wtl_test::Entity> moved(std::move(copy));
+        REQUIRE(moved.getSize() == size);
+        REQUIRE(copy.empty() == true);
+        copy = moved;
+        moved = std::move(map);
+        REQUIRE(moved.getSize() == size - 1);
+        REQUIRE(map.empty() == true);
+        REQUIRE(copy.getSize() == size);
+        REQUIRE(copy.at(size - 1).value().get().m_Id == size - 1);
+    }
+
+    SECTION("Bulk loading") {
+        for (std::size_t count : {0, 1, 31, 32, 33, 100, 5000}) {
+            std::vector<std::pair<std::string, int>> pairs;
+            for (std::size_t i = 0; i < count; i++) {
+                pairs.emplace_back(std::to_string(100000 + i), static_cast<int>(i));
+            }
+            wtl::BTreeMap<std::string, int> strings(pairs.begin(), pairs.end());
+            REQUIRE(strings.getSize() == count);
+            REQUIRE(std::distance(strings.begin(), strings.end()) == static_cast<std::ptrdiff_t>(count));
+            for (std::size_t i = 0; i < count; i++) {
+                REQUIRE(strings.at(pairs[i].first).value().get() == static_cast<int>(i));
+            }
+            // The loaded tree is a valid tree to keep inserting into and erasing from.
+            for (std::size_t i = 0; i < count; i += 3) {
+                REQUIRE(strings.erase(pairs[i].first) == true);
+                REQUIRE(strings.insert(pairs[i].first + "x", 0).second == true);
+            }
+            REQUIRE(strings.getSize() == count);
+        }
+
+        std::vector<std::pair<int, wtl_test::Entity>> unsorted;
+        for (int key : {1, 3, 2}) {
+            unsorted.emplace_back(key, wtl_test::Entity(key));
+        }
+        map.bulkLoad(unsorted.begin(), unsorted.begin() + 2);
+        REQUIRE(map.getSize() == 2);
+        REQUIRE_THROWS_AS(map.bulkLoad(unsorted.begin(), unsorted.end()), std::invalid_argument);
+        REQUIRE(map.empty() == true);
+    }
+
+}
+
+TEST_CASE("BTreeMap against std::map") {
+
+    std::mt19937 generator(7);
+
+    SECTION("Counting search") {
+        std::uniform_int_distribution<std::int64_t> keys(-3000, 3000);
+        wtl::BTreeMap<std::int64_t, int> map;
+        std::map<std::int64_t, int> expected;
+        for (int i = 0; i < 40000; i++) {
+            std::int64_t key = keys(generator);
+            if (i % 3 == 0) {
+                REQUIRE(map.erase(key) == (expected.erase(key) == 1));
+            } else {
+                REQUIRE(map.insertOrReplace(key, i).second == expected.insert_or_assign(key, i).second);
+            }
+            if (i % 1000 == 0) {
+                REQUIRE((map.lowerBound(key) == map.find(key) || !map.contains(key)));
+                auto bound = expected.upper_bound(key);
+                auto result = map.upperBound(key);
+                REQUIRE((bound == expected.end() ? result == map.end() : result->first == bound->first));
+            }
+        }
+        REQUIRE(map.getSize() == expected.size());
+        auto iterator = expected.begin();
+        for (auto[key, value] : map) {
+            REQUIRE(key == iterator->first);
+            REQUIRE(value == iterator->second);
+            ++iterator;
+        }
+    }
+
+    SECTION("Unsigned keys") {
+        std::uniform_int_distribution<std::uint32_t> keys(0, 4000);
+        wtl::BTreeMap<std::uint32_t, int> map;
+        std::map<std::uint32_t, int> expected;
+        for (int i = 0; i < 20000; i++) {
+            // Keys with the top bit set check that unsigned keys are not compared as signed.
+            std::uint32_t key = keys(generator) * 0x00100001u;
+            if (i % 3 == 0) {
+                REQUIRE(map.erase(key) == (expected.erase(key) == 1));
+            } else {
+                REQUIRE(map.insert(key, i).second == expected.insert({key, i}).second);
+            }
+        }
+        REQUIRE(map.getSize() == expected.size());
+        auto iterator = expected.begin();
+        for (auto[key, value] : map) {
+            REQUIRE(key == iterator->first);
+            REQUIRE(value == iterator->second);
+            ++iterator;
+        }
+    }
+
+    SECTION("Unsigned 64 bit keys") {
+        std::uniform_int_distribution<std::uint64_t> keys(0, 4000);
+        wtl::BTreeMap<std::uint64_t, int> map;
+        std::map<std::uint64_t, int> expected;
+        for (int i = 0; i < 20000; i++) {
+            std::uint64_t key = keys(generator) * 0x0010000000000001ull;
+            if (i % 3 == 0) {
+                REQUIRE(map.erase(key) == (expected.erase(key) == 1));
+            } else {
+                REQUIRE(map.insert(key, i).second == expected.insert({key, i}).second);
+            }
+        }
+        REQUIRE(map.getSize() == expected.size());
+        auto iterator = expected.begin();
+        for (auto[key, value] : map) {
+            REQUIRE(key == iterator->first);
+            REQUIRE(value == iterator->second);
+            ++iterator;
+        }
+    }
+
+    SECTION("Binary search") {
+        std::uniform_int_distribution<int> keys(0, 2000);
+        wtl::BTreeMap<int, int, std::greater<int>> map;
+        std::map<int, int, std::greater<int>> expected;
+        for (int i = 0; i < 20000; i++) {
+            int key = keys(generator);
+            if (i % 2 == 0) {
+                REQUIRE(map.erase(key) == (expected.erase(key) == 1));
+            } else {
+                REQUIRE(map.insertOrReplace(key, i).second == expected.insert_or_assign(key, i).second);
+            }
+        }
+        REQUIRE(map.getSize() == expected.size());
+        auto iterator = expected.begin();
+        for (auto[key, value] : map) {
+            REQUIRE(key == iterator->first);
+            REQUIRE(value == iterator->second);
+            ++iterator;
+        }
+    }
+}
+
+namespace {
+
+    /// Value whose constructor throws for negative numbers
+    struct BTreeMapThrowingValue {
+        int m_Value = 0;
+
+        BTreeMapThrowingValue() = default;
+
+        explicit BTreeMapThrowingValue(int value) : m_Value(value) {
+            if (value < 0) {
+                throw std::runtime_error("Negative value");
+            }
+        }
+    };
+
+    /**
+     * Key whose copies throw while s_ThrowOnCopy is set. Moves never throw.
+     */
+    struct BTreeMapThrowingKey {
+        static inline bool s_ThrowOnCopy = false;
+
+        int m_Key = 0;
+
+        BTreeMapThrowingKey() = default;
+
+        explicit BTreeMapThrowingKey(int key) : m_Key(key) {}
+
+        BTreeMapThrowingKey(const BTreeMapThrowingKey& other) : m_Key(other.m_Key) {
+            if (s_ThrowOnCopy) {
+                throw std::runtime_error("Copy");
+            }
+        }
+
+        BTreeMapThrowingKey(BTreeMapThrowingKey&&) noexcept = default;
+
+        BTreeMapThrowingKey& operator=(const BTreeMapThrowingKey& other) {
+            if (s_ThrowOnCopy) {
+                throw std::runtime_error("Copy");
+            }
+            m_Key = other.m_Key;
+            return *this;
+        }
+
+        BTreeMapThrowingKey& operator=(BTreeMapThrowingKey&&) noexcept = default;
+
+        bool operator<(const BTreeMapThrowingKey& other) const noexcept {
+            return m_Key < other.m_Key;
+        }
+    };
+
+}
+
+TEST_CASE("BTreeMap is unchanged when copying a separator key throws") {
+    using Key = BTreeMapThrowingKey;
+    using Map = wtl::BTreeMap<Key, int>;
+    Map map;
+    constexpr int size = 20000;
+    int splits = 0;
+    // Only inserts that split a leaf copy a key, so those are the ones that fail and have to be retried
+    for (int i = 0; i < size; i++) {
+        int key = (i * 7919) % size;
+        Key::s_ThrowOnCopy = true;
+        try {
+            map.emplace(Key(key), key);
+        } catch (const std::runtime_error&) {
+            splits++;
+            Key::s_ThrowOnCopy = false;
+            REQUIRE(map.contains(Key(key)) == false);
+            REQUIRE(map.getSize() == static_cast<std::size_t>(i));
+            map.emplace(Key(key), key);
+        }
+    }
+    Key::s_ThrowOnCopy = false;
+    REQUIRE(splits > 0);
+    REQUIRE(map.getSize() == size);
+    int expected = 0;
+    for (auto[key, value] : map) {
+        REQUIRE(key.m_Key == expected);
+        REQUIRE(value == expected);
+        expected++;
+    }
+    REQUIRE(expected == size);
+
+    // A copy that fails part way through frees the nodes it had built
+    Key::s_ThrowOnCopy = true;
+    REQUIRE_THROWS_AS(Map(map), std::runtime_error);
+    Key::s_ThrowOnCopy = false;
+}
+
+TEST_CASE("BTreeMap is unchanged when constructing a value throws") {
+    wtl::BTreeMap<int, BTreeMapThrowingValue> map;
+    for (int i = 0; i < 200; i += 2) {
+        map.emplace(i, i);
+    }
+    REQUIRE_THROWS_AS(map.emplace(51, -1), std::runtime_error);
+    REQUIRE_THROWS_AS(map.emplace(-1, -1), std::runtime_error);
+    REQUIRE(map.getSize() == 100);
+    REQUIRE(map.contains(51) == false);
+    int expected = 0;
+    for (auto[key, value] : map) {
+        REQUIRE(key == expected);
+        REQUIRE(value.m_Value == expected);
+        expected += 2;
+    }
+    REQUIRE(expected == 200);
+}
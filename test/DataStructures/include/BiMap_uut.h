@@ -7,6 +7,7 @@
 #include "catch.hpp"
 #include "BiMap.h"
 #include <string>
+#include <string_view>
 #include <cstddef>
 #include <vector>
 #include <optional>
@@ -66,3 +67,18 @@ TEST_CASE("BiMap Test with same types") {
     }
 
 }
+
+TEST_CASE("BiMap heterogeneous lookup") {
+
+    wtl::BiMap<std::string, int, std::less<>> biMap;
+    biMap.insert("one", 1);
+    biMap.insert("two", 2);
+    std::string_view two = "two";
+    REQUIRE(biMap.find(two, wtl::bimap_left_tag).value() == 2);
+    REQUIRE(biMap.contains(std::string_view("three"), wtl::bimap_left_tag) == false);
+    REQUIRE(biMap.find(1, wtl::bimap_right_tag).value().get() == "one");
+    REQUIRE(biMap.erase(two, wtl::bimap_left_tag) == true);
+    REQUIRE(biMap.contains(2, wtl::bimap_right_tag) == false);
+    REQUIRE(biMap.getSize() == 1);
+    REQUIRE(biMap.empty() == false);
+}
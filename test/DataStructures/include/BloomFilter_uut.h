@@ -0,0 +1,89 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include "BloomFilter.h"
+
+TEST_CASE("BloomFilter test") {
+
+    constexpr int size = 10000;
+    wtl::BloomFilter<int> bloomFilter(size, 0.01);
+    for (int i = 0; i < size; i++) {
+        REQUIRE(bloomFilter.insert(i) == true);
+    }
+
+    SECTION("No false negatives") {
+        REQUIRE(bloomFilter.getSize() == size);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(bloomFilter.mayContain(i) == true);
+        }
+    }
+
+    SECTION("False positive rate") {
+        REQUIRE(bloomFilter.getFalsePositiveRate() <= 0.01);
+        int falsePositives = 0;
+        for (int i = size; i < size * 11; i++) {
+            falsePositives += bloomFilter.mayContain(i);
+        }
+        REQUIRE(falsePositives < size * 10 * 0.015);
+    }
+
+    SECTION("Copying and clearing") {
+        wtl::BloomFilter<int> copy = bloomFilter;
+        bloomFilter.clear();
+        REQUIRE(bloomFilter.getSize() == 0);
+        REQUIRE(bloomFilter.mayContain(1) == false);
+        REQUIRE(copy.mayContain(1) == true);
+    }
+
+}
+
+TEST_CASE("BloomFilter sizing") {
+
+    wtl::BloomFilter<std::string> precise(1000, 0.001);
+    wtl::BloomFilter<std::string> loose(1000, 0.1);
+    REQUIRE(precise.getMemoryUsage() > loose.getMemoryUsage());
+
+    wtl::BloomFilter<std::string> capped(1000000, 0.001, 4096);
+    REQUIRE(capped.getMemoryUsage() <= 4096);
+    capped.insert("key");
+    REQUIRE(capped.mayContain("key") == true);
+
+    REQUIRE_THROWS_AS(wtl::BloomFilter<int>(10, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(wtl::BloomFilter<int>(10, 1.5), std::invalid_argument);
+    REQUIRE_THROWS_AS(wtl::BloomFilter<int>(10, 0.01, 1), std::invalid_argument);
+}
+
+TEST_CASE("BloomFilter filled past its expected size") {
+
+    wtl::BloomFilter<int> bloomFilter(100, 0.01);
+    std::size_t blocks = bloomFilter.getMemoryUsage() / 32;
+    // About 1000 keys per block, where e^-lambda underflows to 0
+    for (int i = 0; i < static_cast<int>(blocks) * 1000; i++) {
+        bloomFilter.insert(i);
+    }
+    REQUIRE(bloomFilter.getFalsePositiveRate() > 0.99);
+    REQUIRE(bloomFilter.getFalsePositiveRate() <= 1);
+    int falsePositives = 0;
+    for (int i = -1000; i < 0; i++) {
+        falsePositives += bloomFilter.mayContain(i);
+    }
+    REQUIRE(falsePositives > 990);
+
+    // The rate only grows with the number of keys per block, up to 1
+    double previous = 0;
+    for (std::size_t elements = 0; elements <= 1000000; elements += 997) {
+        double rate = wtl::BloomFilter<int>::falsePositiveRateOf(elements, 100);
+        REQUIRE(rate >= previous);
+        REQUIRE(rate <= 1);
+        previous = rate;
+    }
+    REQUIRE(previous == Approx(1));
+    REQUIRE(wtl::BloomFilter<int>::falsePositiveRateOf(1000000000, 1) == 1);
+}
@@ -7,9 +7,11 @@
 #include "catch.hpp"
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 #include "ClosedMap.h"
+#include "StringHash.h"
 #include "Entity.h"
 
 TEST_CASE("ClosedMap test"){
@@ -43,3 +45,17 @@ TEST_CASE("ClosedMap test"){
     }
 
 }
+
+TEST_CASE("ClosedMap heterogeneous lookup") {
+
+    wtl::ClosedMap<std::string, int, wtl::StringHash> closedMap;
+    for (int i = 0; i < 16; i++) {
+        closedMap.insert(std::to_string(i), i);
+    }
+    std::string_view key = "12";
+    REQUIRE(closedMap.at(key).value().get() == 12);
+    REQUIRE(closedMap.contains(std::string_view("16")) == false);
+    REQUIRE(closedMap.erase(key) == true);
+    REQUIRE(closedMap.contains(key) == false);
+    REQUIRE(closedMap.getSize() == 15);
+}
@@ -0,0 +1,99 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "CompactRMQ.h"
+#include "SparseTable.h"
+
+namespace {
+
+    std::vector<int> compactRMQRandomValues(std::size_t size, int range) {
+        std::vector<int> values(size);
+        std::uint64_t state = 987654321;
+        for (int& value : values) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            value = static_cast<int>((state >> 33) % static_cast<std::uint64_t>(range)) - range / 2;
+        }
+        return values;
+    }
+
+}
+
+TEST_CASE("Compact range minimum query") {
+    std::vector<double> vector = {5, 2.1, 7, -9.1, 6.6, 2.9, 0, -10.1, -12.3, 4.1, 5.6, -7.9};
+    wtl::CompactRMQ<double> rmq(vector.begin(), vector.end());
+
+    SECTION("Check min values over a range") {
+        REQUIRE(rmq.getSize() == vector.size());
+        REQUIRE(rmq.query(0, 11) == -12.3);
+        REQUIRE(rmq.query(0, 2) == 2.1);
+        REQUIRE(rmq.query(0, 6) == -9.1);
+        REQUIRE(rmq.query(4, 6) == 0);
+        REQUIRE(rmq.query(3, 9) == -12.3);
+        REQUIRE(rmq.query(10, 11) == -7.9);
+        REQUIRE(rmq.query(11, 11) == -7.9);
+    }
+
+    SECTION("Check max values over a range") {
+        wtl::CompactRMQ<double, std::greater<double>> maxRmq(vector.begin(), vector.end());
+        REQUIRE(maxRmq.query(0, 11) == 7);
+        REQUIRE(maxRmq.query(4, 6) == 6.6);
+        REQUIRE(maxRmq.query(3, 9) == 6.6);
+    }
+
+    SECTION("Invalid range throws") {
+        REQUIRE_THROWS_AS(rmq.query(6, 5), std::invalid_argument);
+        REQUIRE_THROWS_AS(rmq.query(0, 12), std::invalid_argument);
+        std::vector<double> empty;
+        REQUIRE_THROWS_AS(wtl::CompactRMQ<double>(empty.begin(), empty.end()), std::invalid_argument);
+    }
+
+    SECTION("Batch query") {
+        std::vector<std::pair<std::size_t, std::size_t>> ranges = {{0, 11}, {0, 2}, {4, 6}, {10, 11}};
+        REQUIRE(rmq.query(ranges) == std::vector<double>{-12.3, 2.1, 0, -7.9});
+    }
+}
+
+TEST_CASE("Compact range minimum query against brute force") {
+    SECTION("Every range within and across a few blocks, with many duplicates") {
+        for (std::size_t size : {1, 2, 63, 64, 65, 130, 200}) {
+            std::vector<int> values = compactRMQRandomValues(size, 16);
+            wtl::CompactRMQ<int> minRmq(values.begin(), values.end());
+            wtl::CompactRMQ<int, std::greater<int>> maxRmq(values.begin(), values.end());
+            for (std::size_t i = 0; i < size; i++) {
+                int minimum = values[i];
+                int maximum = values[i];
+                for (std::size_t j = i; j < size; j++) {
+                    minimum = std::min(minimum, values[j]);
+                    maximum = std::max(maximum, values[j]);
+                    REQUIRE(minRmq.query(i, j) == minimum);
+                    REQUIRE(maxRmq.query(i, j) == maximum);
+                }
+            }
+        }
+    }
+
+    SECTION("Random ranges over many blocks agree with SparseTable") {
+        std::vector<int> values = compactRMQRandomValues(20000, 1000000);
+        wtl::CompactRMQ<int> rmq(values.begin(), values.end());
+        wtl::SparseTable<int, wtl::RangeMin<int>> st(values.begin(), values.end());
+        std::uint64_t state = 42;
+        for (std::size_t k = 0; k < 20000; k++) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            std::size_t a = (state >> 20) % values.size();
+            std::size_t b = (state >> 42) % values.size();
+            REQUIRE(rmq.query(std::min(a, b), std::max(a, b)) == st.query(std::min(a, b), std::max(a, b)));
+        }
+        REQUIRE(rmq.getMemoryUsage() < st.getMemoryUsage() / 3);
+    }
+}
@@ -0,0 +1,166 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "ConcurrentFenwickTree.h"
+#include "FenwickTree.h"
+
+TEST_CASE("Concurrent fenwick tree on a single thread") {
+    std::vector<std::int64_t> orgArr = {3, 4, -2, 7, 3, 11, 5, -8, -9, 2, 4, -8};
+
+    SECTION("Matches FenwickTree, with and without stripes") {
+        for (std::size_t stripes : {0, 1, 3}) {
+            wtl::ConcurrentFenwickTree<std::int64_t> cft(orgArr, stripes);
+            wtl::FenwickTree<std::int64_t> ft(orgArr);
+            REQUIRE(cft.getSize() == orgArr.size());
+            REQUIRE(cft.getStripeCount() == (stripes == 3 ? 4 : stripes));
+            cft.update(1, 8);
+            ft.update(1, 8);
+            cft.update(11, -3);
+            ft.update(11, -3);
+            for (std::size_t i = 0; i < orgArr.size(); i++) {
+                REQUIRE(cft.retrieve(i) == ft.retrieve(i));
+                REQUIRE(cft.query(i) == ft.query(i));
+                REQUIRE(cft.query(i, orgArr.size() - 1) == ft.query(i, orgArr.size() - 1));
+            }
+            cft.fold();
+            for (std::size_t i = 0; i < orgArr.size(); i++) {
+                REQUIRE(cft.query(i) == ft.query(i));
+            }
+        }
+    }
+
+    SECTION("Tree of zeroes") {
+        wtl::ConcurrentFenwickTree<unsigned> counters(100, 2);
+        counters.update(50, 2);
+        counters.update(99, 1);
+        REQUIRE(counters.query(49) == 0);
+        REQUIRE(counters.query(50) == 2);
+        REQUIRE(counters.query(51, 99) == 1);
+    }
+
+    SECTION("Invalid index throws") {
+        wtl::ConcurrentFenwickTree<std::int64_t> cft(orgArr);
+        REQUIRE_THROWS_AS(cft.update(12, 1), std::invalid_argument);
+        REQUIRE_THROWS_AS(cft.query(12), std::invalid_argument);
+        REQUIRE_THROWS_AS(cft.query(5, 4), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Concurrent fenwick tree updated by several threads") {
+    constexpr std::size_t size = 1000;
+    constexpr std::size_t threadCount = 4;
+    constexpr std::size_t updatesPerThread = 20000;
+
+    for (std::size_t stripes : {0, 4}) {
+        wtl::ConcurrentFenwickTree<std::uint64_t> cft(size, stripes);
+        std::atomic<bool> done = false;
+        std::atomic<std::size_t> completed = 0;
+        std::atomic<bool> overCounted = false;
+        std::atomic<bool> underCounted = false;
+
+        // Every update adds 1, so no prefix sum can be less than the number of updates that completed before it
+        // started, even while other threads are folding. A query that overlaps a fold may count the amounts being
+        // moved again, so the sum can exceed the number of updates, but only by what was in the stripes.
+        std::thread reader([&]() {
+            while (!done.load()) {
+                std::size_t before = completed.load();
+                std::uint64_t sum = cft.query(size - 1);
+                if (sum > 3 * threadCount * updatesPerThread) {
+                    overCounted = true;
+                }
+                if (sum < before) {
+                    underCounted = true;
+                }
+            }
+        });
+        // Two folders, since folds may also overlap each other
+        std::vector<std::thread> folders;
+        for (int f = 0; f < 2; f++) {
+            folders.emplace_back([&]() {
+                while (!done.load()) {
+                    cft.fold();
+                }
+            });
+        }
+        std::vector<std::thread> writers;
+        for (std::size_t t = 0; t < threadCount; t++) {
+            writers.emplace_back([&cft, &completed, t]() {
+                for (std::size_t i = 0; i < updatesPerThread; i++) {
+                    cft.update((i * 7 + t) % size, 1);
+                    completed.fetch_add(1);
+                }
+            });
+        }
+        for (std::thread& writer : writers) {
+            writer.join();
+        }
+        done = true;
+        reader.join();
+        for (std::thread& folder : folders) {
+            folder.join();
+        }
+
+        REQUIRE_FALSE(overCounted.load());
+        REQUIRE_FALSE(underCounted.load());
+        REQUIRE(cft.query(size - 1) == threadCount * updatesPerThread);
+        cft.fold();
+        REQUIRE(cft.query(size - 1) == threadCount * updatesPerThread);
+        std::vector<std::uint64_t> expected(size, 0);
+        for (std::size_t t = 0; t < threadCount; t++) {
+            for (std::size_t i = 0; i < updatesPerThread; i++) {
+                expected[(i * 7 + t) % size]++;
+            }
+        }
+        for (std::size_t i = 0; i < size; i++) {
+            REQUIRE(cft.retrieve(i) == expected[i]);
+        }
+    }
+}
+
+TEST_CASE("Concurrent fenwick tree queried while folding") {
+    constexpr std::size_t size = 1 << 14;
+    constexpr std::size_t threadCount = 4;
+    constexpr std::size_t updatesPerThread = 1024;
+
+    // Every update has completed before the fold starts, so every query must count all of them. A query that reads
+    // the main tree before an amount is folded into it and the stripe after it is folded out would miss it. A query
+    // that overlaps the fold may count an amount twice, and every query after it is exact.
+    bool underCounted = false;
+    for (std::size_t round = 0; round < 100 && !underCounted; round++) {
+        wtl::ConcurrentFenwickTree<std::uint64_t> cft(size, threadCount);
+        std::vector<std::thread> writers;
+        for (std::size_t t = 0; t < threadCount; t++) {
+            writers.emplace_back([&cft, t]() {
+                for (std::size_t i = 0; i < updatesPerThread; i++) {
+                    cft.update((i * 13 + t) % size, 1);
+                }
+            });
+        }
+        for (std::thread& writer : writers) {
+            writer.join();
+        }
+        std::atomic<bool> folded = false;
+        std::thread folder([&]() {
+            cft.fold();
+            folded = true;
+        });
+        while (!folded.load()) {
+            if (cft.query(size - 1) < threadCount * updatesPerThread) {
+                underCounted = true;
+            }
+        }
+        folder.join();
+        REQUIRE(cft.query(size - 1) == threadCount * updatesPerThread);
+    }
+    REQUIRE_FALSE(underCounted);
+}
@@ -0,0 +1,99 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentMap.h"
+#include "Entity.h"
+
+TEST_CASE("ConcurrentMap test") {
+
+    constexpr int size = 1000;
+    wtl::ConcurrentMap<std::string, wtl_test::Entity> map(6);
+    REQUIRE(map.getShardCount() == 8);
+    for (int i = 0; i < size; i++) {
+        REQUIRE(map.insert(std::to_string(i), wtl_test::Entity(i)) == true);
+    }
+
+    SECTION("Searching for object") {
+        REQUIRE(map.getSize() == size);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(map.find(std::to_string(i)).value().m_Id == i);
+        }
+        REQUIRE(map.find("-1") == std::nullopt);
+        REQUIRE(map.contains(std::to_string(size)) == false);
+    }
+
+    SECTION("Inserting, replacing and computing") {
+        REQUIRE(map.insert("10", wtl_test::Entity(-10)) == false);
+        REQUIRE(map.find("10").value().m_Id == 10);
+        REQUIRE(map.insertOrReplace("10", wtl_test::Entity(-10)) == false);
+        REQUIRE(map.find("10").value().m_Id == -10);
+        int calls = 0;
+        auto factory = [&]() {
+            ++calls;
+            return wtl_test::Entity(-1);
+        };
+        REQUIRE(map.computeIfAbsent("11", factory).m_Id == 11);
+        REQUIRE(map.computeIfAbsent("new", factory).m_Id == -1);
+        REQUIRE(map.computeIfAbsent("new", factory).m_Id == -1);
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("Removing objects") {
+        for (int i = 0; i < size; i += 2) {
+            REQUIRE(map.erase(std::to_string(i)) == true);
+        }
+        REQUIRE(map.erase("0") == false);
+        REQUIRE(map.getSize() == size / 2);
+        map.clear();
+        REQUIRE(map.empty() == true);
+    }
+
+}
+
+TEST_CASE("ConcurrentMap with several threads") {
+
+    constexpr int threadCount = 4;
+    constexpr int perThread = 20000;
+    wtl::ConcurrentMap<int, int> map;
+    std::atomic<int> factoryCalls = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+            // Each thread inserts its own keys, erases half of them, and races the others on a set of shared keys.
+            for (int i = 0; i < perThread; i++) {
+                map.insert(t * perThread + i, i);
+            }
+            for (int i = 0; i < perThread; i += 2) {
+                map.erase(t * perThread + i);
+            }
+            for (int i = 0; i < 1000; i++) {
+                map.computeIfAbsent(-1 - i, [&]() {
+                    ++factoryCalls;
+                    return i;
+                });
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(factoryCalls == 1000);
+    REQUIRE(map.getSize() == threadCount * perThread / 2 + 1000);
+    for (int t = 0; t < threadCount; t++) {
+        for (int i = 0; i < perThread; i++) {
+            REQUIRE(map.contains(t * perThread + i) == (i % 2 == 1));
+        }
+    }
+    for (int i = 0; i < 1000; i++) {
+        REQUIRE(map.find(-1 - i).value() == i);
+    }
+}
@@ -0,0 +1,93 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ConcurrentUnionFind.h"
+#include "UnionFind.h"
+
+TEST_CASE("Concurrent union find on a single thread") {
+    wtl::ConcurrentUnionFind uf(8);
+
+    REQUIRE(uf.getSize() == 8);
+    REQUIRE(uf.getSets() == 8);
+
+    REQUIRE(uf.join(0, 1) == true);
+    REQUIRE(uf.join(2, 0) == true);
+    REQUIRE(uf.join(3, 5) == true);
+    REQUIRE(uf.join(6, 3) == true);
+    REQUIRE(uf.join(5, 6) == false);
+    REQUIRE(uf.join(1, 0) == false);
+    REQUIRE(uf.join(4, 4) == false);
+
+    REQUIRE(uf.getSets() == 4);
+    REQUIRE(uf.connected(2, 1) == true);
+    REQUIRE(uf.connected(1, 2) == true);
+    REQUIRE(uf.connected(6, 5) == true);
+    REQUIRE(uf.connected(2, 3) == false);
+    REQUIRE(uf.connected(0, 4) == false);
+    REQUIRE(uf.connected(7, 7) == true);
+    REQUIRE(uf.find(0) == uf.find(2));
+    REQUIRE(uf.find(4) == 4);
+
+    REQUIRE(uf.join(5, 1) == true);
+    REQUIRE(uf.getSets() == 3);
+
+    REQUIRE_THROWS_AS(uf.join(0, 8), std::invalid_argument);
+    REQUIRE_THROWS_AS(uf.find(8), std::invalid_argument);
+    REQUIRE_THROWS_AS(uf.connected(8, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(wtl::ConcurrentUnionFind(0), std::invalid_argument);
+}
+
+TEST_CASE("Concurrent union find joined by several threads") {
+    constexpr std::size_t size = 20000;
+    constexpr std::size_t edgeCount = 15000;
+    constexpr std::size_t threadCount = 4;
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<std::size_t> distribution(0, size - 1);
+    std::vector<std::pair<std::size_t, std::size_t>> edges;
+    for (std::size_t i = 0; i < edgeCount; i++) {
+        edges.emplace_back(distribution(generator), distribution(generator));
+    }
+
+    wtl::ConcurrentUnionFind uf(size);
+    std::atomic<std::size_t> joins{0};
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+            std::size_t joined = 0;
+            for (std::size_t i = t; i < edgeCount; i += threadCount) {
+                if (uf.join(edges[i].first, edges[i].second)) {
+                    joined++;
+                }
+                // Connected is also called while other threads are joining
+                (void)uf.connected(edges[i].first, edges[(i * 7) % edgeCount].second);
+            }
+            joins.fetch_add(joined);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    wtl::UnionFind expected(size);
+    for (const auto& edge : edges) {
+        expected.join(edge.first, edge.second);
+    }
+    REQUIRE(uf.getSets() == expected.getSets());
+    REQUIRE(joins.load() == size - expected.getSets());
+    for (std::size_t i = 0; i < size; i++) {
+        REQUIRE(uf.connected(i, edges[i % edgeCount].first) == expected.connected(i, edges[i % edgeCount].first));
+        REQUIRE(uf.find(i) == uf.find(expected.belongs(i)));
+    }
+}
@@ -0,0 +1,73 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include "CuckooFilter.h"
+
+TEST_CASE("CuckooFilter test") {
+
+    constexpr int size = 10000;
+    wtl::CuckooFilter<int> cuckooFilter(size);
+    for (int i = 0; i < size; i++) {
+        REQUIRE(cuckooFilter.insert(i) == true);
+    }
+
+    SECTION("No false negatives") {
+        REQUIRE(cuckooFilter.getSize() == size);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(cuckooFilter.mayContain(i) == true);
+        }
+        int falsePositives = 0;
+        for (int i = size; i < size * 11; i++) {
+            falsePositives += cuckooFilter.mayContain(i);
+        }
+        REQUIRE(falsePositives < size * 10 * 0.001);
+    }
+
+    SECTION("Erasing keys") {
+        for (int i = 0; i < size; i += 2) {
+            REQUIRE(cuckooFilter.erase(i) == true);
+        }
+        REQUIRE(cuckooFilter.getSize() == size / 2);
+        for (int i = 1; i < size; i += 2) {
+            REQUIRE(cuckooFilter.mayContain(i) == true);
+        }
+        int remaining = 0;
+        for (int i = 0; i < size; i += 2) {
+            remaining += cuckooFilter.mayContain(i);
+        }
+        REQUIRE(remaining < 10);
+        cuckooFilter.clear();
+        REQUIRE(cuckooFilter.mayContain(1) == false);
+    }
+
+}
+
+TEST_CASE("CuckooFilter filled to capacity") {
+
+    // 8 bit fingerprints, so that the table fills up in a reasonable number of keys.
+    wtl::CuckooFilter<int, std::hash<int>, std::uint8_t> cuckooFilter(1000);
+    int inserted = 0;
+    while (cuckooFilter.insert(inserted)) {
+        ++inserted;
+    }
+    REQUIRE(cuckooFilter.getLoadFactor() > 0.9);
+    REQUIRE(cuckooFilter.getSize() == static_cast<std::size_t>(inserted));
+    for (int i = 0; i < inserted; i++) {
+        REQUIRE(cuckooFilter.mayContain(i) == true);
+    }
+    // Erasing makes space again
+    for (int i = 0; i < inserted; i += 2) {
+        REQUIRE(cuckooFilter.erase(i) == true);
+    }
+    REQUIRE(cuckooFilter.insert(-1) == true);
+    for (int i = 1; i < inserted; i += 2) {
+        REQUIRE(cuckooFilter.mayContain(i) == true);
+    }
+    REQUIRE(cuckooFilter.mayContain(-1) == true);
+}
@@ -0,0 +1,134 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "catch.hpp"
+#include "Entity.h"
+#include "DenseIndexedPriorityQueue.h"
+
+TEST_CASE("Dense Indexed Priority Queue in descending order") {
+
+    using Entity = wtl_test::Entity;
+
+    constexpr int size = 8;
+    wtl::DenseIndexedPriorityQueue<Entity> ipq(size + 2);
+    for (int i = 0; i < size; i++) {
+        REQUIRE(ipq.emplace(i, i) == true);
+    }
+    REQUIRE(ipq.emplace(3, 100) == false);
+    REQUIRE(ipq.getSize() == size);
+    REQUIRE(ipq.getCapacity() == size + 2);
+
+    SECTION("Checking if keys exists") {
+        for (int i = 0; i < size; i++) {
+            REQUIRE(ipq.exists(i) == true);
+            REQUIRE(ipq.find(i).m_Id == i);
+        }
+        REQUIRE(ipq.exists(size) == false);
+        REQUIRE(ipq.exists(size + 10) == false);
+        REQUIRE_THROWS_AS(ipq.find(size), std::invalid_argument);
+        REQUIRE_THROWS_AS(ipq.find(size + 10), std::out_of_range);
+        REQUIRE_THROWS_AS(ipq.insert(size + 2, Entity(0)), std::out_of_range);
+        REQUIRE(ipq.position(size - 1) == 0);
+    }
+
+    SECTION("Removing and polling keys") {
+        REQUIRE_NOTHROW(ipq.remove(6));
+        REQUIRE_NOTHROW(ipq.remove(7));
+        REQUIRE_THROWS_AS(ipq.remove(7), std::invalid_argument);
+        REQUIRE(ipq.getSize() == 6);
+
+        int i = 5;
+        while (!ipq.isEmpty()) {
+            const auto result = ipq.peek();
+            REQUIRE(result.first == static_cast<std::size_t>(i));
+            REQUIRE(result.second.get().m_Id == i);
+            --i;
+            ipq.poll();
+        }
+        REQUIRE_THROWS_AS(ipq.poll(), std::runtime_error);
+    }
+
+    SECTION("Updating priority of elements") {
+        for (int i = 0; i < size; i++) {
+            REQUIRE_NOTHROW(ipq.update(i, Entity(7 - i)));
+        }
+
+        int i = 0;
+        while (!ipq.isEmpty()) {
+            const auto result = ipq.peek();
+            REQUIRE(result.first == static_cast<std::size_t>(i));
+            REQUIRE(result.second.get().m_Id == (7 - i));
+            ++i;
+            ipq.poll();
+        }
+    }
+
+    SECTION("Clearing") {
+        ipq.clear();
+        REQUIRE(ipq.isEmpty() == true);
+        REQUIRE(ipq.exists(0) == false);
+        REQUIRE(ipq.emplace(0, 1) == true);
+    }
+
+}
+
+TEMPLATE_TEST_CASE_SIG("Dense Indexed Priority Queue against a sorted reference", "",
+                       ((std::size_t Arity), Arity), 2, 4, 8) {
+
+    constexpr std::size_t capacity = 500;
+    std::mt19937 engine(5);
+    std::uniform_int_distribution<int> distribution(0, 1000);
+    std::vector<int> priorities(capacity);
+    for (int& priority : priorities) {
+        priority = distribution(engine);
+    }
+
+    // Min-ordered, as in Dijkstra's algorithm
+    wtl::DenseIndexedPriorityQueue<int, std::greater<>, Arity> ipq(priorities.begin(), priorities.end());
+    REQUIRE(ipq.getSize() == capacity);
+
+    std::vector<bool> present(capacity, true);
+    for (std::size_t i = 0; i < 2000; i++) {
+        std::size_t key = engine() % capacity;
+        int priority = distribution(engine);
+        if (!present[key]) {
+            ipq.insert(key, priority);
+            present[key] = true;
+        } else if (i % 5 == 0) {
+            ipq.remove(key);
+            present[key] = false;
+        } else {
+            ipq.update(key, priority);
+        }
+        priorities[key] = priority;
+    }
+
+    std::vector<std::pair<int, std::size_t>> expected;
+    for (std::size_t key = 0; key < capacity; key++) {
+        if (present[key]) {
+            expected.emplace_back(priorities[key], key);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(ipq.getSize() == expected.size());
+
+    bool ordered = true;
+    for (const auto& [priority, key] : expected) {
+        const auto result = ipq.peek();
+        ordered &= result.second.get() == priority && ipq.find(result.first) == priority;
+        ordered &= priorities[result.first] == priority;
+        ipq.poll();
+    }
+    REQUIRE(ordered == true);
+    REQUIRE(ipq.isEmpty() == true);
+}
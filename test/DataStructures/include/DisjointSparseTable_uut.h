@@ -0,0 +1,120 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "DisjointSparseTable.h"
+
+namespace {
+
+    using DisjointSparseTableMatrix = std::array<std::int64_t, 4>;
+
+    struct DisjointSparseTableMatrixProduct {
+        DisjointSparseTableMatrix operator()(const DisjointSparseTableMatrix& lhs,
+                                             const DisjointSparseTableMatrix& rhs) const {
+            return {(lhs[0] * rhs[0] + lhs[1] * rhs[2]) % 1000003, (lhs[0] * rhs[1] + lhs[1] * rhs[3]) % 1000003,
+                    (lhs[2] * rhs[0] + lhs[3] * rhs[2]) % 1000003, (lhs[2] * rhs[1] + lhs[3] * rhs[3]) % 1000003};
+        }
+    };
+
+    template<typename T, typename Combine>
+    void checkDisjointSparseTableAgainstBruteForce(const std::vector<T>& vector) {
+        wtl::DisjointSparseTable<T, Combine> table(vector.begin(), vector.end());
+        REQUIRE(table.getSize() == vector.size());
+        Combine combine;
+        for (std::size_t i = 0; i < vector.size(); i++) {
+            T expected = vector[i];
+            REQUIRE(table.query(i, i) == expected);
+            for (std::size_t j = i + 1; j < vector.size(); j++) {
+                expected = combine(expected, vector[j]);
+                REQUIRE(table.query(i, j) == expected);
+            }
+        }
+    }
+
+}
+
+TEST_CASE("Disjoint sparse table sum") {
+    std::vector<int> vector = {5, 2, 7, -9, 6, 2, 0, -10, -12, 4, 5, -7};
+    wtl::DisjointSparseTable<int> table(vector.begin(), vector.end());
+
+    SECTION("Check sums over a range") {
+        REQUIRE(table.query(0, 11) == -7);
+        REQUIRE(table.query(0, 2) == 14);
+        REQUIRE(table.query(4, 6) == 8);
+        REQUIRE(table.query(3, 9) == -19);
+        REQUIRE(table.query(10, 11) == -2);
+    }
+
+    SECTION("Check sums against brute force for every size") {
+        std::vector<std::int64_t> values;
+        std::uint64_t value = 12345;
+        for (std::size_t size = 1; size <= 40; size++) {
+            value = value * 6364136223846793005ull + 1442695040888963407ull;
+            values.push_back(static_cast<std::int64_t>(value >> 40) - (1ll << 23));
+            checkDisjointSparseTableAgainstBruteForce<std::int64_t, wtl::RangeSum<std::int64_t>>(values);
+        }
+    }
+
+    SECTION("Invalid range throws") {
+        REQUIRE_THROWS_AS(table.query(6, 5), std::invalid_argument);
+        REQUIRE_THROWS_AS(table.query(0, 12), std::invalid_argument);
+        std::vector<int> empty;
+        REQUIRE_THROWS_AS(wtl::DisjointSparseTable<int>(empty.begin(), empty.end()), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Disjoint sparse table with non-commutative operation") {
+    SECTION("String concatenation") {
+        std::vector<std::string> vector;
+        for (char c = 'a'; c <= 'z'; c++) {
+            vector.emplace_back(1, c);
+        }
+        checkDisjointSparseTableAgainstBruteForce<std::string, wtl::RangeSum<std::string>>(vector);
+        wtl::DisjointSparseTable<std::string> table(vector.begin(), vector.end());
+        REQUIRE(table.query(3, 9) == "defghij");
+    }
+
+    SECTION("Matrix product") {
+        std::vector<DisjointSparseTableMatrix> vector;
+        for (std::int64_t i = 0; i < 37; i++) {
+            vector.push_back({i + 1, 2 * i, i % 5, 3});
+        }
+        checkDisjointSparseTableAgainstBruteForce<DisjointSparseTableMatrix, DisjointSparseTableMatrixProduct>(vector);
+    }
+}
+
+TEST_CASE("Disjoint sparse table batch query") {
+    std::vector<int> vector = {5, 2, 7, -9, 6, 2, 0, -10, -12, 4, 5, -7};
+    wtl::DisjointSparseTable<int> table(vector.begin(), vector.end());
+    std::vector<std::pair<std::size_t, std::size_t>> ranges = {{0, 11}, {0, 2}, {4, 6}, {10, 11}, {3, 3}};
+
+    SECTION("Results are in the same order as the queries") {
+        REQUIRE(table.query(ranges) == std::vector<int>{-7, 14, 8, -2, -9});
+    }
+
+    SECTION("Results are written to an output iterator") {
+        std::vector<int> results;
+        table.query(ranges.begin(), ranges.end(), std::back_inserter(results));
+        REQUIRE(results == std::vector<int>{-7, 14, 8, -2, -9});
+    }
+
+    SECTION("Copy and move") {
+        wtl::DisjointSparseTable<int> copy(table);
+        REQUIRE(copy.query(ranges) == table.query(ranges));
+        wtl::DisjointSparseTable<int> moved(std::move(table));
+        REQUIRE(moved.query(0, 11) == -7);
+        REQUIRE(table.getSize() == 0);
+        REQUIRE_THROWS_AS(table.query(0, 0), std::invalid_argument);
+    }
+}
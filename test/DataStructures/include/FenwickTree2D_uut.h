@@ -0,0 +1,80 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "FenwickTree2D.h"
+
+TEST_CASE("Two-dimensional fenwick tree") {
+    std::vector<std::vector<int>> grid = {
+            {1, 2, 3, 4, 5},
+            {-1, 0, 2, 7, 1},
+            {4, 4, -3, 2, 0},
+            {9, 1, 1, 1, 6}
+    };
+    wtl::FenwickTree2D<int> ft(grid);
+
+    auto bruteForce = [&grid](std::size_t r1, std::size_t c1, std::size_t r2, std::size_t c2) {
+        int sum = 0;
+        for (std::size_t r = r1; r <= r2; r++) {
+            for (std::size_t c = c1; c <= c2; c++) {
+                sum += grid[r][c];
+            }
+        }
+        return sum;
+    };
+
+    auto checkAll = [&]() {
+        for (std::size_t r1 = 0; r1 < grid.size(); r1++) {
+            for (std::size_t c1 = 0; c1 < grid[0].size(); c1++) {
+                REQUIRE(ft.retrieve(r1, c1) == grid[r1][c1]);
+                REQUIRE(ft.query(r1, c1) == bruteForce(0, 0, r1, c1));
+                for (std::size_t r2 = r1; r2 < grid.size(); r2++) {
+                    for (std::size_t c2 = c1; c2 < grid[0].size(); c2++) {
+                        REQUIRE(ft.query(r1, c1, r2, c2) == bruteForce(r1, c1, r2, c2));
+                    }
+                }
+            }
+        }
+    };
+
+    SECTION("Rectangle sums of the original grid") {
+        REQUIRE(ft.getRows() == 4);
+        REQUIRE(ft.getColumns() == 5);
+        checkAll();
+    }
+
+    SECTION("Updating cells") {
+        ft.update(2, 3, 10);
+        grid[2][3] += 10;
+        ft.replace(0, 0, -5);
+        grid[0][0] = -5;
+        ft.update(3, 4, -6);
+        grid[3][4] -= 6;
+        checkAll();
+    }
+
+    SECTION("Counters starting from zero") {
+        wtl::FenwickTree2D<long> counters(3, 3);
+        counters.update(1, 1, 1);
+        counters.update(1, 1, 1);
+        counters.update(2, 0, 1);
+        REQUIRE(counters.query(2, 2) == 3);
+        REQUIRE(counters.query(0, 0, 1, 2) == 2);
+        REQUIRE(counters.query(2, 0, 2, 0) == 1);
+    }
+
+    SECTION("Invalid input throws") {
+        REQUIRE_THROWS_AS(ft.query(4, 0), std::invalid_argument);
+        REQUIRE_THROWS_AS(ft.query(0, 5), std::invalid_argument);
+        REQUIRE_THROWS_AS(ft.query(2, 2, 1, 3), std::invalid_argument);
+        REQUIRE_THROWS_AS(ft.update(0, 5, 1), std::invalid_argument);
+        std::vector<std::vector<int>> ragged = {{1, 2}, {3}};
+        REQUIRE_THROWS_AS(wtl::FenwickTree2D<int>(ragged), std::invalid_argument);
+    }
+}
@@ -5,6 +5,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "catch.hpp"
 #include "FenwickTree.h"
 
@@ -51,3 +54,62 @@ TEST_CASE("Fenwick tree") {
     }
 }
 
+
+TEST_CASE("Fenwick tree lower bound") {
+    std::vector<int> weights = {3, 0, 4, 1, 0, 0, 5, 2, 9};
+    wtl::FenwickTree<int> ft(weights);
+
+    SECTION("Index of the first prefix sum that reaches a value") {
+        REQUIRE(ft.lowerBound(0) == 0);
+        REQUIRE(ft.lowerBound(1) == 0);
+        REQUIRE(ft.lowerBound(3) == 0);
+        REQUIRE(ft.lowerBound(4) == 2);
+        REQUIRE(ft.lowerBound(7) == 2);
+        REQUIRE(ft.lowerBound(8) == 3);
+        REQUIRE(ft.lowerBound(9) == 6);
+        REQUIRE(ft.lowerBound(24) == 8);
+        REQUIRE(ft.lowerBound(25) == weights.size());
+    }
+
+    SECTION("K-th element of a multiset of counts") {
+        std::vector<int> counts(100, 0);
+        wtl::FenwickTree<int> multiset(counts);
+        for (std::size_t value : {17, 3, 99, 42, 17, 64}) {
+            multiset.update(value, 1);
+        }
+        std::vector<std::size_t> sorted;
+        for (int k = 1; k <= 6; k++) {
+            sorted.push_back(multiset.lowerBound(k));
+        }
+        REQUIRE(sorted == std::vector<std::size_t>{3, 17, 17, 42, 64, 99});
+    }
+}
+
+TEST_CASE("Fenwick tree batch update") {
+    for (std::size_t size : {1, 7, 64, 1000}) {
+        std::vector<std::int64_t> values(size);
+        for (std::size_t i = 0; i < size; i++) {
+            values[i] = static_cast<std::int64_t>(i * 7 % 13) - 6;
+        }
+        wtl::FenwickTree<std::int64_t> ft(values);
+        for (std::size_t count : {1, 3, 500, 5000}) {
+            std::vector<std::pair<std::size_t, std::int64_t>> deltas;
+            for (std::size_t k = 0; k < count; k++) {
+                std::size_t index = (k * 2654435761u) % size;
+                std::int64_t delta = static_cast<std::int64_t>(k % 11) - 5;
+                deltas.emplace_back(index, delta);
+                values[index] += delta;
+            }
+            ft.batchUpdate(deltas.begin(), deltas.end());
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                sum += values[i];
+                REQUIRE(ft.retrieve(i) == values[i]);
+                REQUIRE(ft.query(i) == sum);
+            }
+        }
+        std::vector<std::pair<std::size_t, std::int64_t>> invalid = {{0, 1}, {size, 1}};
+        REQUIRE_THROWS_AS(ft.batchUpdate(invalid.begin(), invalid.end()), std::invalid_argument);
+        REQUIRE(ft.retrieve(0) == values[0]);
+    }
+}
@@ -0,0 +1,76 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <string>
+#include "BloomFilter.h"
+#include "CuckooFilter.h"
+#include "FilteredContainer.h"
+#include "UnorderedMap.h"
+#include "UnorderedSet.h"
+#include "Entity.h"
+
+TEST_CASE("FilteredContainer with UnorderedSet and BloomFilter") {
+
+    constexpr int size = 1000;
+    wtl::FilteredContainer<wtl::UnorderedSet<std::string>, wtl::BloomFilter<std::string>> set{
+            wtl::BloomFilter<std::string>(size, 0.01)};
+    for (int i = 0; i < size; i++) {
+        REQUIRE(set.insert(std::to_string(i)).second == true);
+    }
+    REQUIRE(set.insert("0").second == false);
+    REQUIRE(set.getSize() == size);
+    REQUIRE(set.getFilter().getSize() == size);
+    for (int i = 0; i < size; i++) {
+        REQUIRE(set.contains(std::to_string(i)) == true);
+    }
+    REQUIRE(set.find("10").value().get() == "10");
+    REQUIRE(set.find("-1") == std::nullopt);
+    REQUIRE(set.contains(std::to_string(size)) == false);
+    REQUIRE(set.erase("10") == true);
+    REQUIRE(set.contains("10") == false);
+    REQUIRE(set.erase("10") == false);
+    set.clear();
+    REQUIRE(set.empty() == true);
+    REQUIRE(set.getFilter().mayContain("1") == false);
+}
+
+TEST_CASE("FilteredContainer with UnorderedMap and CuckooFilter") {
+
+    constexpr int size = 1000;
+    wtl::FilteredContainer<wtl::UnorderedMap<int, wtl_test::Entity>, wtl::CuckooFilter<int>> map{
+            wtl::CuckooFilter<int>(size)};
+    for (int i = 0; i < size; i++) {
+        REQUIRE(map.insert(i, wtl_test::Entity(i)).second == true);
+    }
+    REQUIRE(map.insertOrReplace(5, wtl_test::Entity(-5)).second == false);
+    REQUIRE(map.emplace(size, size).second == true);
+    REQUIRE(map.getFilter().getSize() == size + 1);
+    REQUIRE(map.at(5).value().get().m_Id == -5);
+    REQUIRE(map.at(-1) == std::nullopt);
+    for (int i = 0; i < size; i += 2) {
+        REQUIRE(map.erase(i) == true);
+    }
+    REQUIRE(map.getFilter().getSize() == size / 2 + 1);
+    for (int i = 0; i < size; i++) {
+        REQUIRE(map.contains(i) == (i % 2 == 1));
+    }
+    REQUIRE(map.isFilterBypassed() == false);
+}
+
+TEST_CASE("FilteredContainer with a full filter") {
+
+    wtl::FilteredContainer<wtl::UnorderedSet<int>, wtl::CuckooFilter<int, std::hash<int>, std::uint8_t>> set{
+            wtl::CuckooFilter<int, std::hash<int>, std::uint8_t>(10)};
+    for (int i = 0; i < 1000; i++) {
+        set.insert(i);
+    }
+    REQUIRE(set.isFilterBypassed() == true);
+    for (int i = 0; i < 1000; i++) {
+        REQUIRE(set.contains(i) == true);
+    }
+}
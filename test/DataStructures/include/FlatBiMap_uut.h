@@ -0,0 +1,114 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include "FlatBiMap.h"
+#include "StringHash.h"
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("FlatBiMap Test with different types") {
+    wtl::FlatBiMap<std::string, int> biMap;
+    for (std::size_t i = 0; i < 10; i++) {
+        REQUIRE(biMap.insert(std::to_string(i), i) == true);
+    }
+    REQUIRE(biMap.insert("3", 100) == false);
+    REQUIRE(biMap.insert("100", 3) == false);
+    REQUIRE(biMap.getSize() == 10);
+
+    SECTION("Checking if element exists") {
+        for (std::size_t i = 0; i < 10; i++) {
+            REQUIRE(biMap.find(std::to_string(i)).value() == static_cast<int>(i));
+            REQUIRE(biMap.find(i).value().get() == std::to_string(i));
+        }
+        REQUIRE(biMap.find(100) == std::nullopt);
+        REQUIRE(biMap.find("100") == std::nullopt);
+        REQUIRE(biMap.contains("100") == false);
+    }
+
+    SECTION("Erasing elements") {
+        REQUIRE(biMap.erase(9) == true);
+        REQUIRE(biMap.erase("2") == true);
+        REQUIRE(biMap.erase("2") == false);
+        for (std::size_t i = 0; i < 10; i++) {
+            if (i != 2 && i != 9) {
+                REQUIRE(biMap.find(std::to_string(i)).value() == static_cast<int>(i));
+                REQUIRE(biMap.find(i).value().get() == std::to_string(i));
+            }
+        }
+        REQUIRE(biMap.find(2) == std::nullopt);
+        REQUIRE(biMap.find("9") == std::nullopt);
+        REQUIRE(biMap.getSize() == 8);
+    }
+
+    SECTION("Iterating through the pairs") {
+        int sum = 0;
+        for (const auto& [string, number] : biMap) {
+            REQUIRE(string == std::to_string(number));
+            sum += number;
+        }
+        REQUIRE(sum == 45);
+    }
+
+}
+
+TEST_CASE("FlatBiMap Test with same types") {
+    wtl::FlatBiMap<int, int> biMap;
+    for (int i = 0; i < 10; i++) {
+        biMap.insert(i, i * 2);
+    }
+
+    REQUIRE(biMap.erase(9, wtl::bimap_left_tag) == true);
+    REQUIRE(biMap.erase(16, wtl::bimap_right_tag) == true);
+    for (int i = 0; i < 8; i++) {
+        REQUIRE(biMap.find(i, wtl::bimap_left_tag).value() == i * 2);
+        REQUIRE(biMap.find(i * 2, wtl::bimap_right_tag).value() == i);
+    }
+    REQUIRE(biMap.find(9, wtl::bimap_left_tag) == std::nullopt);
+    REQUIRE(biMap.find(16, wtl::bimap_right_tag) == std::nullopt);
+}
+
+TEST_CASE("FlatBiMap as a large interning table") {
+
+    constexpr std::size_t count = 100000;
+    wtl::FlatBiMap<std::string, std::size_t, wtl::StringHash> biMap;
+    biMap.reserve(count);
+    std::size_t bucketCount = biMap.getBucketCount();
+    for (std::size_t i = 0; i < count; i++) {
+        biMap.insert("name" + std::to_string(i), i);
+    }
+    REQUIRE(biMap.getBucketCount() == bucketCount);
+    REQUIRE(biMap.getMemoryPerEntry() > 0.0);
+    REQUIRE(biMap.getMemoryUsage() >= count * (sizeof(std::pair<std::string, std::size_t>) + 16));
+
+    // Erase every third pair, which moves pairs around, then check that both directions still agree.
+    for (std::size_t i = 0; i < count; i += 3) {
+        REQUIRE(biMap.erase(std::string_view("name" + std::to_string(i)), wtl::bimap_left_tag) == true);
+    }
+    bool consistent = true;
+    for (std::size_t i = 0; i < count; i++) {
+        std::string name = "name" + std::to_string(i);
+        auto id = biMap.find(std::string_view(name), wtl::bimap_left_tag);
+        auto found = biMap.find(i);
+        if (i % 3 == 0) {
+            consistent &= id == std::nullopt && found == std::nullopt;
+        } else {
+            consistent &= id.has_value() && id.value() == i && found.has_value() && found.value().get() == name;
+        }
+    }
+    REQUIRE(consistent == true);
+    REQUIRE(biMap.getSize() == count - (count + 2) / 3);
+
+    biMap.clear();
+    REQUIRE(biMap.empty() == true);
+    REQUIRE(biMap.shrinkToFit() == true);
+    REQUIRE(biMap.getBucketCount() == 8);
+    REQUIRE(biMap.insert("name0", 0) == true);
+    REQUIRE(biMap.contains(std::string_view("name0"), wtl::bimap_left_tag) == true);
+}
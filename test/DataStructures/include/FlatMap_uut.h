@@ -0,0 +1,131 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "FlatMap.h"
+#include "Entity.h"
+
+TEST_CASE("FlatMap test") {
+
+    constexpr int size = 1000;
+    wtl::FlatMap<std::string, wtl_test::Entity> flatMap;
+    for (int i = 0; i < size; i++) {
+        flatMap.insert(std::to_string(i), wtl_test::Entity(i));
+    }
+
+    SECTION("Searching for object") {
+        REQUIRE(flatMap.getSize() == size);
+        REQUIRE(flatMap.getLoadFactor() <= 0.875);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(flatMap.at(std::to_string(i)).value().get().m_Id == i);
+        }
+        REQUIRE(flatMap.at("-1").has_value() == false);
+        REQUIRE(flatMap.contains(std::to_string(size)) == false);
+    }
+
+    SECTION("Inserting duplicate key") {
+        auto[result, inserted] = flatMap.insert("10", wtl_test::Entity(-10));
+        REQUIRE(inserted == false);
+        REQUIRE(result.second.get().m_Id == 10);
+        REQUIRE(flatMap.getSize() == size);
+    }
+
+    SECTION("Insert or replace") {
+        auto[result, inserted] = flatMap.insertOrReplace("10", wtl_test::Entity(-10));
+        REQUIRE(inserted == false);
+        REQUIRE(result.first.get() == "10");
+        REQUIRE(flatMap.at("10").value().get().m_Id == -10);
+        REQUIRE(flatMap.emplaceOrReplace("new", 5).second == true);
+        REQUIRE(flatMap.emplace("new", 6).second == false);
+        REQUIRE(flatMap.at("new").value().get().m_Id == 5);
+    }
+
+    SECTION("Removing objects") {
+        for (int i = 0; i < size; i += 2) {
+            REQUIRE(flatMap.erase(std::to_string(i)) == true);
+        }
+        REQUIRE(flatMap.erase("0") == false);
+        REQUIRE(flatMap.getSize() == size / 2);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(flatMap.contains(std::to_string(i)) == (i % 2 == 1));
+        }
+        REQUIRE(flatMap.shrinkToFit() == true);
+        for (int i = 1; i < size; i += 2) {
+            REQUIRE(flatMap.at(std::to_string(i)).value().get().m_Id == i);
+        }
+    }
+
+    SECTION("Copying and clearing") {
+        wtl::FlatMap<std::string, wtl_test::Entity> copy = flatMap;
+        flatMap.clear();
+        REQUIRE(flatMap.empty() == true);
+        REQUIRE(flatMap.contains("1") == false);
+        REQUIRE(copy.getSize() == size);
+        REQUIRE(copy.at("999").value().get().m_Id == 999);
+    }
+
+}
+
+TEST_CASE("FlatMap insert and erase churn") {
+
+    wtl::FlatMap<int, int> flatMap;
+    // Keep at most 64 live keys while cycling through many more, so that deleted slots are reclaimed.
+    for (int i = 0; i < 100000; i++) {
+        flatMap.insert(i, i * 2);
+        if (i >= 64) {
+            REQUIRE(flatMap.erase(i - 64) == true);
+        }
+    }
+    REQUIRE(flatMap.getSize() == 64);
+    REQUIRE(flatMap.getBucketCount() <= 256);
+    for (int i = 100000 - 64; i < 100000; i++) {
+        REQUIRE(flatMap.at(i).value().get() == i * 2);
+    }
+    REQUIRE(flatMap.contains(0) == false);
+}
+
+namespace {
+
+    struct FlatMapThrowingValue {
+        int m_Value = 0;
+
+        explicit FlatMapThrowingValue(int value) : m_Value(value) {
+            if (value < 0) {
+                throw std::runtime_error("Negative value");
+            }
+        }
+    };
+
+}
+
+TEST_CASE("FlatMap is unchanged when constructing a value throws") {
+
+    wtl::FlatMap<std::string, FlatMapThrowingValue> flatMap;
+    for (int i = 0; i < 100; i++) {
+        flatMap.emplace(std::to_string(i), i);
+        REQUIRE_THROWS_AS(flatMap.emplace("missing" + std::to_string(i), -1), std::runtime_error);
+    }
+    REQUIRE_THROWS_AS(flatMap.emplaceOrReplace("missing", -1), std::runtime_error);
+    REQUIRE(flatMap.getSize() == 100);
+    REQUIRE(flatMap.contains("missing") == false);
+    for (int i = 0; i < 100; i++) {
+        REQUIRE(flatMap.contains("missing" + std::to_string(i)) == false);
+        REQUIRE(flatMap.at(std::to_string(i)).value().get().m_Value == i);
+    }
+
+    // The slot that was given up can still be filled, and the copy and erase only see constructed values
+    REQUIRE(flatMap.emplace("missing", 7).second == true);
+    wtl::FlatMap<std::string, FlatMapThrowingValue> copy = flatMap;
+    REQUIRE(copy.getSize() == 101);
+    for (int i = 0; i < 100; i++) {
+        REQUIRE(copy.erase(std::to_string(i)) == true);
+    }
+    REQUIRE(copy.at("missing").value().get().m_Value == 7);
+}
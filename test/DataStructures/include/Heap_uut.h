@@ -0,0 +1,143 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "Heap.h"
+#include "PriorityQueue.h"
+
+namespace {
+
+    /**
+     * Poll every element of a heap, in order of priority.
+     * @tparam Heap
+     * @param heap
+     * @return
+     */
+    template<typename Heap>
+    auto drain(Heap& heap) {
+        std::vector<std::decay_t<decltype(heap.peek())>> elements;
+        while (!heap.isEmpty()) {
+            elements.push_back(heap.peek());
+            heap.poll();
+        }
+        return elements;
+    }
+
+    std::vector<int> randomInts(std::size_t count, unsigned seed) {
+        std::mt19937 engine(seed);
+        std::uniform_int_distribution<int> distribution(-500, 500);
+        std::vector<int> ints(count);
+        for (int& i : ints) {
+            i = distribution(engine);
+        }
+        return ints;
+    }
+
+}
+
+TEMPLATE_TEST_CASE_SIG("Heap of every arity", "", ((std::size_t Arity), Arity), 2, 3, 4, 8) {
+
+    std::vector<int> ints = randomInts(1000, 7);
+    std::vector<int> sorted = ints;
+    std::sort(sorted.begin(), sorted.end(), std::greater<>());
+
+    SECTION("Building from a range") {
+        wtl::Heap<int, wtl::impl::ds::StandardComparator<int>, Arity> heap(ints.begin(), ints.end());
+        REQUIRE(heap.getSize() == ints.size());
+        REQUIRE(drain(heap) == sorted);
+    }
+
+    SECTION("Inserting one element at a time") {
+        wtl::Heap<int, wtl::impl::ds::StandardComparator<int>, Arity> heap;
+        for (int i : ints) {
+            heap.insert(i);
+        }
+        REQUIRE(heap.peek() == sorted.front());
+        REQUIRE(drain(heap) == sorted);
+        REQUIRE_THROWS_AS(heap.peek(), std::runtime_error);
+        REQUIRE_THROWS_AS(heap.poll(), std::runtime_error);
+    }
+
+    SECTION("Pushing ranges smaller and larger than the heap") {
+        wtl::Heap<int, wtl::impl::ds::StandardComparator<int>, Arity> heap;
+        heap.pushRange(ints.begin(), ints.begin() + 600);
+        heap.pushRange(ints.begin() + 600, ints.begin() + 650);
+        heap.pushRange(ints.begin() + 650, ints.end());
+        REQUIRE(drain(heap) == sorted);
+    }
+
+    SECTION("Popping several elements at once") {
+        wtl::Heap<int, wtl::impl::ds::StandardComparator<int>, Arity> heap(ints);
+        std::vector<int> popped;
+        REQUIRE(heap.popN(10, std::back_inserter(popped)) == 10);
+        REQUIRE(popped == std::vector<int>(sorted.begin(), sorted.begin() + 10));
+        heap.insert(1000);
+        REQUIRE(heap.peek() == 1000);
+        REQUIRE(heap.popN(5000, std::back_inserter(popped)) == ints.size() - 9);
+        REQUIRE(heap.isEmpty() == true);
+        REQUIRE(heap.popN(1, std::back_inserter(popped)) == 0);
+    }
+
+}
+
+TEST_CASE("Heap with custom ordering and move-only use") {
+
+    SECTION("Min heap of strings") {
+        wtl::Heap<std::string, std::greater<>, 4> heap{"pear", "apple", "fig", "kiwi", "banana"};
+        heap.emplace(3, 'a');
+        heap.insert(std::string("zucchini"));
+        REQUIRE(drain(heap) == std::vector<std::string>{"aaa", "apple", "banana", "fig", "kiwi", "pear", "zucchini"});
+    }
+
+    SECTION("Equal elements") {
+        std::vector<int> ints(100, 3);
+        ints.push_back(4);
+        wtl::Heap<int> heap(ints.begin(), ints.end());
+        REQUIRE(heap.peek() == 4);
+        heap.poll();
+        REQUIRE(heap.getSize() == 100);
+        REQUIRE(heap.peek() == 3);
+    }
+
+    SECTION("Copying and comparing") {
+        wtl::Heap<int> heap{5, 1, 4};
+        wtl::Heap<int> copy = heap;
+        REQUIRE(copy == heap);
+        copy.poll();
+        REQUIRE(copy != heap);
+        heap.clear();
+        REQUIRE(heap.isEmpty() == true);
+    }
+
+}
+
+TEST_CASE("PriorityQueue test") {
+
+    std::vector<int> ints = randomInts(200, 11);
+    std::vector<int> sorted = ints;
+    std::sort(sorted.begin(), sorted.end());
+
+    wtl::PriorityQueue<int, std::greater<>, 4> pq(ints.begin(), ints.begin() + 100);
+    pq.insertRange(ints.begin() + 100, ints.end());
+    REQUIRE(pq.getSize() == ints.size());
+
+    std::vector<int> polled;
+    REQUIRE(pq.pollN(50, std::back_inserter(polled)) == 50);
+    REQUIRE(pq.peek() == sorted[50]);
+    while (!pq.isEmpty()) {
+        polled.push_back(pq.peek());
+        pq.poll();
+    }
+    REQUIRE(polled == sorted);
+    REQUIRE_THROWS_AS(pq.poll(), std::runtime_error);
+}
@@ -0,0 +1,245 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MpmcQueue.h"
+
+TEST_CASE("MpmcQueue test") {
+
+    wtl::MpmcQueue<std::string> queue(8);
+    REQUIRE(queue.getCapacity() == 8);
+
+    SECTION("Enqueueing until full") {
+        for (int i = 0; i < 8; i++) {
+            REQUIRE(queue.tryEnqueue(std::to_string(i)) == true);
+        }
+        std::string rejected = "rejected";
+        REQUIRE(queue.tryEnqueue(std::move(rejected)) == false);
+        REQUIRE(rejected == "rejected");
+        REQUIRE(queue.getSize() == 8);
+
+        std::string element;
+        for (int i = 0; i < 8; i++) {
+            REQUIRE(queue.tryDequeue(element) == true);
+            REQUIRE(element == std::to_string(i));
+            REQUIRE(queue.tryEmplace(3, 'x') == true);
+        }
+        REQUIRE(queue.tryDequeue(element) == true);
+        REQUIRE(element == "xxx");
+    }
+
+    SECTION("Batches") {
+        std::vector<std::string> batch{"a", "b", "c", "d", "e"};
+        REQUIRE(queue.tryEnqueueRange(batch.begin(), batch.end()) == 5);
+        REQUIRE(queue.tryEnqueueRange(batch.begin(), batch.end()) == 3);
+        std::vector<std::string> drained;
+        REQUIRE(queue.tryDequeueInto(std::back_inserter(drained), 6) == 6);
+        REQUIRE(queue.tryDequeueInto(std::back_inserter(drained)) == 2);
+        REQUIRE(queue.tryDequeueInto(std::back_inserter(drained)) == 0);
+        REQUIRE(drained == std::vector<std::string>{"a", "b", "c", "d", "e", "a", "b", "c"});
+        REQUIRE(queue.isEmpty() == true);
+    }
+
+    SECTION("Elements left in the queue are destroyed") {
+        auto shared = std::make_shared<int>(1);
+        {
+            wtl::MpmcQueue<std::shared_ptr<int>> pointers(4);
+            pointers.tryEnqueue(shared);
+            pointers.tryEnqueue(shared);
+            std::shared_ptr<int> element;
+            pointers.tryDequeue(element);
+            pointers.tryEnqueue(shared);
+            REQUIRE(shared.use_count() == 4);
+        }
+        REQUIRE(shared.use_count() == 1);
+    }
+
+}
+
+TEST_CASE("MpmcQueue with several producer and consumer threads") {
+
+    constexpr std::size_t producerCount = 3;
+    constexpr std::size_t consumerCount = 3;
+    constexpr std::size_t perProducer = 50000;
+    wtl::MpmcQueue<std::size_t> queue(64);
+
+    // Each element encodes its producer and its sequence number within that producer.
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < producerCount; p++) {
+        threads.emplace_back([&queue, p]() {
+            std::vector<std::size_t> batch;
+            for (std::size_t next = 0; next < perProducer;) {
+                if (next % 2 == 0) {
+                    if (queue.tryEnqueue(next * producerCount + p)) {
+                        next++;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                } else {
+                    batch.clear();
+                    for (std::size_t i = next; i < perProducer && i < next + 5; i++) {
+                        batch.push_back(i * producerCount + p);
+                    }
+                    std::size_t enqueued = queue.tryEnqueueRange(batch.begin(), batch.end());
+                    if (enqueued == 0) {
+                        std::this_thread::yield();
+                    }
+                    next += enqueued;
+                }
+            }
+        });
+    }
+
+    std::atomic<std::size_t> remaining = producerCount * perProducer;
+    std::vector<std::vector<std::size_t>> received(consumerCount);
+    for (std::size_t c = 0; c < consumerCount; c++) {
+        threads.emplace_back([&, c]() {
+            std::vector<std::size_t>& elements = received[c];
+            while (remaining.load() > 0) {
+                std::size_t element;
+                std::size_t dequeued = 0;
+                if (c % 2 == 0 && queue.tryDequeue(element)) {
+                    elements.push_back(element);
+                    dequeued = 1;
+                } else {
+                    dequeued = queue.tryDequeueInto(std::back_inserter(elements), 8);
+                }
+                if (dequeued == 0) {
+                    std::this_thread::yield();
+                }
+                remaining -= dequeued;
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Every element arrives exactly once, and each consumer sees each producer's elements in order.
+    std::vector<int> seen(producerCount * perProducer, 0);
+    bool ordered = true;
+    for (const std::vector<std::size_t>& elements : received) {
+        std::vector<std::size_t> last(producerCount, 0);
+        std::vector<bool> any(producerCount, false);
+        for (std::size_t element : elements) {
+            seen[element]++;
+            std::size_t p = element % producerCount;
+            ordered &= !any[p] || element > last[p];
+            last[p] = element;
+            any[p] = true;
+        }
+    }
+    REQUIRE(ordered == true);
+    bool exactlyOnce = true;
+    for (int count : seen) {
+        exactlyOnce &= count == 1;
+    }
+    REQUIRE(exactlyOnce == true);
+    REQUIRE(queue.isEmpty() == true);
+}
+
+namespace {
+
+    /**
+     * Element whose copies and move assignments start throwing after s_Countdown more of them succeed. A negative
+     * countdown never throws. The value is long enough to live on the heap, so that leaks are noticed.
+     */
+    struct MpmcQueueThrowingElement {
+        static inline int s_Countdown = -1;
+
+        std::string m_Value;
+
+        static void tick() {
+            if (s_Countdown == 0) {
+                s_Countdown = -1;
+                throw std::runtime_error("Countdown");
+            }
+            if (s_Countdown > 0) {
+                s_Countdown--;
+            }
+        }
+
+        MpmcQueueThrowingElement() = default;
+
+        explicit MpmcQueueThrowingElement(int value) : m_Value(std::string(32, 'x') + std::to_string(value)) {}
+
+        MpmcQueueThrowingElement(const MpmcQueueThrowingElement& other) : m_Value(other.m_Value) {
+            tick();
+        }
+
+        MpmcQueueThrowingElement(MpmcQueueThrowingElement&&) noexcept = default;
+
+        MpmcQueueThrowingElement& operator=(const MpmcQueueThrowingElement&) = default;
+
+        MpmcQueueThrowingElement& operator=(MpmcQueueThrowingElement&& other) {
+            tick();
+            m_Value = std::move(other.m_Value);
+            return *this;
+        }
+
+        bool operator==(const MpmcQueueThrowingElement& other) const noexcept {
+            return m_Value == other.m_Value;
+        }
+    };
+
+}
+
+TEST_CASE("MpmcQueue keeps moving when an element throws") {
+    using Element = MpmcQueueThrowingElement;
+    wtl::MpmcQueue<Element> queue(8);
+    Element element;
+
+    // Several laps around the ring, so that skipped slots are reused
+    for (int round = 0; round < 10; round++) {
+        Element first(round);
+        REQUIRE(queue.tryEnqueue(first) == true);
+        Element::s_Countdown = 0;
+        REQUIRE_THROWS_AS(queue.tryEnqueue(first), std::runtime_error);
+        std::vector<Element> batch{Element(1), Element(2), Element(3), Element(4)};
+        Element::s_Countdown = 2;
+        REQUIRE_THROWS_AS(queue.tryEnqueueRange(batch.begin(), batch.end()), std::runtime_error);
+        REQUIRE(queue.tryEnqueue(Element(round + 100)) == true);
+
+        REQUIRE(queue.tryDequeue(element) == true);
+        REQUIRE(element == Element(round));
+        REQUIRE(queue.tryDequeue(element) == true);
+        REQUIRE(element == Element(round + 100));
+        REQUIRE(queue.tryDequeue(element) == false);
+    }
+
+    SECTION("Moving an element out throws") {
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(queue.tryEnqueue(Element(i)) == true);
+        }
+        Element::s_Countdown = 0;
+        REQUIRE_THROWS_AS(queue.tryDequeue(element), std::runtime_error);
+        Element out[2];
+        Element::s_Countdown = 1;
+        REQUIRE_THROWS_AS(queue.tryDequeueInto(out, 2), std::runtime_error);
+        REQUIRE(out[0] == Element(1));
+        REQUIRE(queue.isEmpty() == true);
+        REQUIRE(queue.tryEnqueue(Element(3)) == true);
+        REQUIRE(queue.tryDequeueInto(out) == 1);
+        REQUIRE(out[0] == Element(3));
+    }
+
+    SECTION("Skipped slots are not elements") {
+        Element::s_Countdown = 0;
+        REQUIRE_THROWS_AS(queue.tryEnqueue(element), std::runtime_error);
+        std::vector<Element> drained;
+        REQUIRE(queue.tryDequeueInto(std::back_inserter(drained)) == 0);
+        REQUIRE(drained.empty() == true);
+        REQUIRE(queue.isEmpty() == true);
+    }
+}
@@ -0,0 +1,161 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "NodePool.h"
+#include "SinglyLinkedList.h"
+#include "DoublyLinkedList.h"
+#include "BinarySearchTree.h"
+#include "AllocationCounter.h"
+
+TEST_CASE("NodePool test") {
+
+    wtl::NodePool<std::string> pool;
+
+    SECTION("Creating and destroying nodes") {
+        std::vector<std::string*> nodes;
+        for (int i = 0; i < 1000; i++) {
+            nodes.push_back(pool.create(std::to_string(i)));
+        }
+        for (int i = 0; i < 1000; i++) {
+            REQUIRE(*nodes[i] == std::to_string(i));
+        }
+        std::size_t chunkCount = pool.getChunkCount();
+        REQUIRE(pool.getCapacity() >= 1000);
+        REQUIRE(chunkCount < 20);
+
+        // Destroyed nodes are reused before any new chunk is allocated.
+        for (int i = 0; i < 1000; i += 2) {
+            pool.destroy(nodes[i]);
+        }
+        for (int i = 0; i < 1000; i += 2) {
+            nodes[i] = pool.create("reused");
+        }
+        REQUIRE(pool.getChunkCount() == chunkCount);
+        REQUIRE(*nodes[998] == "reused");
+        REQUIRE(*nodes[999] == "999");
+        for (std::string* node : nodes) {
+            pool.destroy(node);
+        }
+    }
+
+    SECTION("Releasing all nodes") {
+        wtl::NodePool<int> numbers;
+        for (int round = 0; round < 3; round++) {
+            wtl_test::AllocationCounter counter;
+            for (int i = 0; i < 5000; i++) {
+                REQUIRE(*numbers.create(i) == i);
+            }
+            if (round > 0) {
+                REQUIRE(counter.getCount() == 0);
+            }
+            numbers.release();
+        }
+    }
+
+    SECTION("A throwing constructor gives its slot back") {
+        std::string* first = pool.create("first");
+        // Constructing a substring from past the end throws std::out_of_range.
+        REQUIRE_THROWS_AS(pool.create(std::string("abc"), 5), std::out_of_range);
+        std::size_t capacity = pool.getCapacity();
+        std::vector<std::string*> nodes;
+        for (std::size_t i = 1; i < capacity; i++) {
+            nodes.push_back(pool.create("filled"));
+        }
+        REQUIRE(pool.getChunkCount() == 1);
+        pool.destroy(first);
+        for (std::string* node : nodes) {
+            pool.destroy(node);
+        }
+    }
+
+    SECTION("Moving") {
+        std::string* node = pool.create("moved");
+        wtl::NodePool<std::string> moved(std::move(pool));
+        REQUIRE(pool.getChunkCount() == 0);
+        REQUIRE(moved.getChunkCount() == 1);
+        moved.destroy(node);
+    }
+
+}
+
+TEST_CASE("Containers using a NodePool") {
+
+    SECTION("Singly linked list") {
+        wtl::SinglyLinkedList<std::string, wtl::NodePool> list{"b", "c"};
+        list.appendFront("a");
+        list.appendBack("d");
+        list.insertAt(2, std::string("x"));
+        REQUIRE(list.remove("x") == 1);
+        REQUIRE(list.getSize() == 4);
+        REQUIRE(list.at(3) == "d");
+
+        wtl::SinglyLinkedList<std::string, wtl::NodePool> moved(std::move(list));
+        moved.detachFront();
+        REQUIRE(moved.front() == "b");
+        list = std::move(moved);
+        REQUIRE(list.getSize() == 3);
+        list.clear();
+        REQUIRE(list.isEmpty() == true);
+        list.appendFront("e");
+        REQUIRE(list.front() == "e");
+
+        wtl::SinglyLinkedList<int> heapList{1, 2, 3};
+        wtl::SinglyLinkedList<int> copy(heapList);
+        heapList.clear();
+        REQUIRE(copy.getSize() == 3);
+        REQUIRE(copy.at(2) == 3);
+    }
+
+    SECTION("Doubly linked list") {
+        wtl::DoublyLinkedList<std::string, wtl::NodePool> list{"a", "b", "c"};
+        list.appendBack("d");
+        list.removeAt(1);
+        REQUIRE(list.getSize() == 3);
+        REQUIRE(list.at(1) == "c");
+        wtl::DoublyLinkedList<std::string, wtl::NodePool> moved(std::move(list));
+        REQUIRE(moved.getSize() == 3);
+        REQUIRE(list.isEmpty() == true);
+
+        wtl::DoublyLinkedList<int, wtl::NodePool> numbers;
+        for (int round = 0; round < 3; round++) {
+            wtl_test::AllocationCounter counter;
+            for (int i = 0; i < 1000; i++) {
+                numbers.appendBack(i);
+            }
+            if (round > 0) {
+                REQUIRE(counter.getCount() == 0);
+            }
+            REQUIRE(numbers.getSize() == 1000);
+            numbers.clear();
+        }
+    }
+
+    SECTION("Binary search tree") {
+        wtl::BinarySearchTree<int, std::string, wtl::NodePool> tree;
+        for (int i = 0; i < 100; i++) {
+            tree.insert((i * 37) % 100, std::to_string(i));
+        }
+        REQUIRE(tree.getSize() == 100);
+        REQUIRE(tree.get(37).value().get() == "1");
+        tree.clear();
+        REQUIRE(tree.isEmpty() == true);
+        REQUIRE(tree.get(37).has_value() == false);
+        tree.insert(1, "one");
+        REQUIRE(tree.get(1).value().get() == "one");
+
+        wtl::BinarySearchTree<int, std::string> heapTree;
+        heapTree.insert(2, "two");
+        heapTree.insert(1, "one");
+        heapTree.insert(3, "three");
+        REQUIRE(heapTree.get(3).value().get() == "three");
+    }
+
+}
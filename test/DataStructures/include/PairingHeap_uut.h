@@ -0,0 +1,169 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "PairingHeap.h"
+
+TEST_CASE("PairingHeap test") {
+
+    wtl::PairingHeap<int> heap;
+    REQUIRE(heap.isEmpty() == true);
+    REQUIRE_THROWS_AS(heap.peek(), std::runtime_error);
+    REQUIRE_THROWS_AS(heap.poll(), std::runtime_error);
+
+    std::mt19937 engine(3);
+    std::uniform_int_distribution<int> distribution(0, 10000);
+    std::vector<int> ints(2000);
+    for (int& i : ints) {
+        i = distribution(engine);
+    }
+    std::vector<wtl::PairingHeap<int>::Handle> handles;
+    for (int i : ints) {
+        handles.push_back(heap.insert(i));
+    }
+    REQUIRE(heap.getSize() == ints.size());
+
+    SECTION("Polling in order of priority") {
+        std::sort(ints.begin(), ints.end(), std::greater<>());
+        REQUIRE(heap.peek() == ints.front());
+        REQUIRE(*heap.top() == ints.front());
+        bool ordered = true;
+        for (int i : ints) {
+            ordered &= heap.peek() == i;
+            heap.poll();
+        }
+        REQUIRE(ordered == true);
+        REQUIRE(heap.isEmpty() == true);
+    }
+
+    SECTION("Raising priorities") {
+        for (std::size_t i = 0; i < handles.size(); i += 3) {
+            ints[i] += distribution(engine);
+            heap.decreaseKey(handles[i], ints[i]);
+            REQUIRE(*handles[i] == ints[i]);
+        }
+        REQUIRE_THROWS_AS(heap.decreaseKey(handles[1], ints[1] - 1), std::invalid_argument);
+        heap.decreaseKey(handles[1], 20001);
+        REQUIRE(heap.top() == handles[1]);
+        ints[1] = 20001;
+
+        std::sort(ints.begin(), ints.end(), std::greater<>());
+        bool ordered = true;
+        for (int i : ints) {
+            ordered &= heap.peek() == i;
+            heap.poll();
+        }
+        REQUIRE(ordered == true);
+    }
+
+    SECTION("Erasing elements") {
+        for (std::size_t i = 0; i < handles.size(); i += 2) {
+            heap.erase(handles[i]);
+        }
+        heap.erase(heap.top());
+        std::vector<int> remaining;
+        for (std::size_t i = 1; i < ints.size(); i += 2) {
+            remaining.push_back(ints[i]);
+        }
+        std::sort(remaining.begin(), remaining.end(), std::greater<>());
+        remaining.erase(remaining.begin());
+        REQUIRE(heap.getSize() == remaining.size());
+        bool ordered = true;
+        for (int i : remaining) {
+            ordered &= heap.peek() == i;
+            heap.poll();
+        }
+        REQUIRE(ordered == true);
+    }
+
+    SECTION("Copying") {
+        wtl::PairingHeap<int> copy = heap;
+        REQUIRE(copy.getSize() == heap.getSize());
+        REQUIRE(copy.getPool() != heap.getPool());
+        copy.clear();
+        REQUIRE(copy.isEmpty() == true);
+        REQUIRE(heap.getSize() == ints.size());
+        copy = heap;
+        REQUIRE(copy.peek() == heap.peek());
+    }
+
+}
+
+TEST_CASE("PairingHeap melding") {
+
+    using Heap = wtl::PairingHeap<std::string, std::greater<>>;
+
+    SECTION("Heaps sharing a pool keep their handles") {
+        Heap first;
+        Heap second(first.getPool());
+        Heap::Handle pear = first.insert("pear");
+        first.emplace("fig");
+        Heap::Handle kiwi = second.insert("kiwi");
+        second.insert("banana");
+        first.meld(second);
+        REQUIRE(second.isEmpty() == true);
+        REQUIRE(first.getSize() == 4);
+        first.decreaseKey(kiwi, "apple");
+        first.erase(pear);
+        REQUIRE(first.peek() == "apple");
+        first.poll();
+        REQUIRE(first.peek() == "banana");
+        first.poll();
+        REQUIRE(first.peek() == "fig");
+
+        second.insert("cherry");
+        first.meld(std::move(second));
+        REQUIRE(first.peek() == "cherry");
+        first.meld(first);
+        REQUIRE(first.getSize() == 2);
+    }
+
+    SECTION("Heaps with different pools") {
+        Heap first{"c", "a"};
+        Heap second{"d", "b"};
+        first.meld(second);
+        REQUIRE(second.isEmpty() == true);
+        std::vector<std::string> polled;
+        while (!first.isEmpty()) {
+            polled.push_back(first.peek());
+            first.poll();
+        }
+        REQUIRE(polled == std::vector<std::string>{"a", "b", "c", "d"});
+    }
+
+    SECTION("An empty heap adopts the pool") {
+        Heap first;
+        Heap second{"x"};
+        Heap::Handle x = second.top();
+        first.meld(second);
+        REQUIRE(first.getPool() == second.getPool());
+        first.decreaseKey(x, "a");
+        REQUIRE(first.peek() == "a");
+    }
+
+    SECTION("Elements are destroyed") {
+        auto shared = std::make_shared<int>(1);
+        {
+            wtl::PairingHeap<std::shared_ptr<int>> pointers;
+            wtl::PairingHeap<std::shared_ptr<int>> others(pointers.getPool());
+            for (int i = 0; i < 10; i++) {
+                pointers.insert(shared);
+                others.insert(shared);
+            }
+            pointers.poll();
+            REQUIRE(shared.use_count() == 20);
+        }
+        REQUIRE(shared.use_count() == 1);
+    }
+
+}
@@ -0,0 +1,73 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "RangeFenwickTree.h"
+
+TEST_CASE("Range fenwick tree") {
+    std::vector<double> orgArr = {3, 4, -2, 7, 3, 11, 5, -8, -9, 2, 4, -8};
+    wtl::RangeFenwickTree<double> ft(orgArr);
+
+    SECTION("Retrieving original elements and sums") {
+        REQUIRE(ft.getSize() == orgArr.size());
+        for (std::size_t i = 0; i < orgArr.size(); i++) {
+            REQUIRE(ft.retrieve(i) == orgArr[i]);
+        }
+        REQUIRE(ft.query(5) == 26);
+        REQUIRE(ft.query(11) == 12);
+        REQUIRE(ft.query(2, 5) == 19);
+        REQUIRE(ft.query(7, 10) == -11);
+    }
+
+    SECTION("Adding to a range") {
+        ft.update(2, 5, 10);
+        ft.update(11, 1);
+        ft.update(0, 11, -1);
+        REQUIRE(ft.retrieve(1) == 3);
+        REQUIRE(ft.retrieve(2) == 7);
+        REQUIRE(ft.retrieve(5) == 20);
+        REQUIRE(ft.retrieve(6) == 4);
+        REQUIRE(ft.retrieve(11) == -8);
+        REQUIRE(ft.query(0, 5) == 60);
+        REQUIRE(ft.query(4, 7) == 27);
+        REQUIRE(ft.query(11) == 41);
+    }
+
+    SECTION("Invalid range throws") {
+        REQUIRE_THROWS_AS(ft.update(5, 4, 1), std::invalid_argument);
+        REQUIRE_THROWS_AS(ft.update(0, 12, 1), std::invalid_argument);
+        REQUIRE_THROWS_AS(ft.query(3, 2), std::invalid_argument);
+        REQUIRE_THROWS_AS(ft.retrieve(12), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Range fenwick tree against brute force") {
+    constexpr std::size_t size = 300;
+    std::vector<std::int64_t> values(size, 0);
+    wtl::RangeFenwickTree<std::int64_t> ft(values);
+    std::uint64_t state = 7;
+    for (std::size_t k = 0; k < 300; k++) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        std::size_t a = (state >> 20) % size;
+        std::size_t b = (state >> 40) % size;
+        std::size_t start = a < b ? a : b;
+        std::size_t end = a < b ? b : a;
+        std::int64_t delta = static_cast<std::int64_t>(state >> 58) - 32;
+        ft.update(start, end, delta);
+        for (std::size_t i = start; i <= end; i++) {
+            values[i] += delta;
+        }
+        std::int64_t sum = 0;
+        for (std::size_t i = start; i < size; i++) {
+            sum += values[i];
+            REQUIRE(ft.query(start, i) == sum);
+        }
+    }
+}
@@ -0,0 +1,205 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "RingQueue.h"
+#include "Entity.h"
+#include "AllocationCounter.h"
+
+TEST_CASE("RingQueue test") {
+
+    wtl::RingQueue<std::string> queue;
+    for (int i = 0; i < 6; i++) {
+        queue.enqueue(std::to_string(i));
+    }
+
+    SECTION("Removing elements from queue") {
+        REQUIRE(queue.getSize() == 6);
+        REQUIRE(queue.getCapacity() == 8);
+        for (int i = 0; i < 6; i++) {
+            REQUIRE(queue.peek() == std::to_string(i));
+            queue.dequeue();
+        }
+        REQUIRE(queue.isEmpty() == true);
+        REQUIRE_THROWS_AS(queue.dequeue(), std::runtime_error);
+        REQUIRE_THROWS_AS(queue.peek(), std::runtime_error);
+    }
+
+    SECTION("Wrapping around and growing") {
+        // Moves the front to the middle of the buffer, so that the elements wrap around before it grows.
+        queue.dequeue();
+        queue.dequeue();
+        for (int i = 6; i < 100; i++) {
+            queue.emplace(std::to_string(i));
+        }
+        REQUIRE(queue.getSize() == 98);
+        REQUIRE(queue.getCapacity() == 128);
+        std::string element;
+        for (int i = 2; i < 100; i++) {
+            REQUIRE(queue.tryDequeue(element) == true);
+            REQUIRE(element == std::to_string(i));
+        }
+        REQUIRE(queue.tryDequeue(element) == false);
+    }
+
+    SECTION("Enqueueing and draining ranges") {
+        std::vector<std::string> more{"6", "7", "8"};
+        queue.enqueueRange(more.begin(), more.end());
+        std::istringstream stream("9 10");
+        queue.enqueueRange(std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>());
+        REQUIRE(queue.getSize() == 11);
+
+        std::list<std::string> drained;
+        REQUIRE(queue.drainInto(std::back_inserter(drained), 4) == 4);
+        REQUIRE(queue.peek() == "4");
+        REQUIRE(queue.drainInto(std::back_inserter(drained)) == 7);
+        REQUIRE(queue.isEmpty() == true);
+        int expected = 0;
+        for (const std::string& element : drained) {
+            REQUIRE(element == std::to_string(expected++));
+        }
+        REQUIRE(expected == 11);
+    }
+
+    SECTION("Enqueueing elements of the queue itself while it grows") {
+        queue.enqueue("6");
+        queue.enqueue("7");
+        REQUIRE(queue.getSize() == queue.getCapacity());
+        queue.enqueue(queue.peek());
+        REQUIRE(queue.getCapacity() == 16);
+        queue.emplace(queue.peek());
+        const std::string* front = &queue.peek();
+        queue.enqueueRange(front, front + 8);
+        REQUIRE(queue.getCapacity() == 32);
+        std::vector<std::string> expected{"0", "1", "2", "3", "4", "5", "6", "7", "0", "0",
+                                          "0", "1", "2", "3", "4", "5", "6", "7"};
+        std::vector<std::string> drained;
+        queue.drainInto(std::back_inserter(drained));
+        REQUIRE(drained == expected);
+    }
+
+    SECTION("Copying and moving") {
+        queue.dequeue();
+        wtl::RingQueue<std::string> copy(queue);
+        REQUIRE(copy.getSize() == 5);
+        REQUIRE(copy.peek() == "1");
+        queue.clear();
+        copy = queue;
+        REQUIRE(copy.isEmpty() == true);
+        copy.enqueue("a");
+
+        wtl::RingQueue<std::string> moved(std::move(copy));
+        REQUIRE(copy.isEmpty() == true);
+        REQUIRE(copy.getCapacity() == 0);
+        REQUIRE(moved.peek() == "a");
+        copy = std::move(moved);
+        REQUIRE(copy.peek() == "a");
+    }
+
+    SECTION("Shrinking") {
+        for (int i = 0; i < 100; i++) {
+            queue.enqueue("x");
+        }
+        queue.clear();
+        REQUIRE(queue.getCapacity() == 128);
+        queue.enqueue("y");
+        queue.shrinkToFit();
+        REQUIRE(queue.getCapacity() == 8);
+        REQUIRE(queue.peek() == "y");
+        queue.dequeue();
+        queue.shrinkToFit();
+        REQUIRE(queue.getCapacity() == 0);
+    }
+
+}
+
+TEST_CASE("RingQueue does not allocate in steady state") {
+
+    using Entity = wtl_test::Entity;
+    wtl::RingQueue<Entity> queue;
+    queue.reserve(100);
+    REQUIRE(queue.getCapacity() == 128);
+    std::vector<Entity> drained;
+    drained.reserve(100);
+
+    wtl_test::AllocationCounter counter;
+    // A work queue pattern: dequeue one, enqueue one.
+    for (int i = 0; i < 100; i++) {
+        queue.emplace(i);
+    }
+    for (int i = 0; i < 10000; i++) {
+        REQUIRE(queue.peek().m_Id == i);
+        queue.dequeue();
+        queue.emplace(i + 100);
+    }
+    REQUIRE(queue.drainInto(std::back_inserter(drained)) == 100);
+    REQUIRE(counter.getCount() == 0);
+    REQUIRE(drained.back().m_Id == 10099);
+}
+
+namespace {
+
+    struct RingQueueThrowingElement {
+        static inline int s_Countdown = -1;
+
+        std::string m_Value;
+
+        explicit RingQueueThrowingElement(std::string value = "") : m_Value(std::move(value)) {}
+
+        RingQueueThrowingElement(const RingQueueThrowingElement&) = default;
+
+        RingQueueThrowingElement(RingQueueThrowingElement&&) noexcept = default;
+
+        RingQueueThrowingElement& operator=(const RingQueueThrowingElement&) = default;
+
+        RingQueueThrowingElement& operator=(RingQueueThrowingElement&& other) {
+            if (s_Countdown == 0) {
+                s_Countdown = -1;
+                throw std::runtime_error("Countdown");
+            }
+            if (s_Countdown > 0) {
+                s_Countdown--;
+            }
+            m_Value = std::move(other.m_Value);
+            return *this;
+        }
+    };
+
+}
+
+TEST_CASE("RingQueue keeps the undrained elements when draining throws") {
+    using Element = RingQueueThrowingElement;
+    wtl::RingQueue<Element> queue;
+    for (int i = 0; i < 12; i++) {
+        queue.emplace(std::string(32, 'x') + std::to_string(i));
+    }
+    // Move the front forward, so that the drained elements wrap around the end of the buffer
+    for (int i = 0; i < 12; i++) {
+        queue.emplace(queue.peek().m_Value);
+        queue.dequeue();
+    }
+    std::vector<Element> drained(12);
+
+    Element::s_Countdown = 3;
+    REQUIRE_THROWS_AS(queue.drainInto(drained.begin()), std::runtime_error);
+    REQUIRE(queue.getSize() == 9);
+    for (int i = 0; i < 3; i++) {
+        REQUIRE(drained[i].m_Value == std::string(32, 'x') + std::to_string(i));
+    }
+    REQUIRE(queue.drainInto(drained.begin() + 3) == 9);
+    REQUIRE(queue.isEmpty());
+    for (int i = 3; i < 12; i++) {
+        REQUIRE(drained[i].m_Value == std::string(32, 'x') + std::to_string(i));
+    }
+}
@@ -0,0 +1,86 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <string>
+#include "RobinHoodMap.h"
+#include "Entity.h"
+
+TEST_CASE("RobinHoodMap test") {
+
+    constexpr int size = 1000;
+    wtl::RobinHoodMap<std::string, wtl_test::Entity> map;
+    for (int i = 0; i < size; i++) {
+        REQUIRE(map.insert(std::to_string(i), wtl_test::Entity(i)).second == true);
+    }
+
+    SECTION("Searching for object") {
+        REQUIRE(map.getSize() == size);
+        REQUIRE(map.getBucketCount() == 2048);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(map.at(std::to_string(i)).value().get().m_Id == i);
+        }
+        REQUIRE(map.at("-1").has_value() == false);
+        REQUIRE(map.insert("1", wtl_test::Entity(-1)).second == false);
+        REQUIRE(map.at("1").value().get().m_Id == 1);
+    }
+
+    SECTION("Insert or replace") {
+        REQUIRE(map.insertOrReplace("1", wtl_test::Entity(-1)).second == false);
+        REQUIRE(map.at("1").value().get().m_Id == -1);
+        REQUIRE(map.insertOrReplace("new", wtl_test::Entity(5)).second == true);
+        REQUIRE(map.emplace("new", 6).second == false);
+        REQUIRE(map.at("new").value().get().m_Id == 5);
+    }
+
+    SECTION("Removing objects") {
+        for (int i = 0; i < size; i += 3) {
+            REQUIRE(map.erase(std::to_string(i)) == true);
+        }
+        REQUIRE(map.erase("0") == false);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(map.contains(std::to_string(i)) == (i % 3 != 0));
+        }
+        wtl::RobinHoodMap<std::string, wtl_test::Entity> copy = map;
+        REQUIRE(copy.shrinkToFit() == true);
+        for (int i = 1; i < size; i += 3) {
+            REQUIRE(copy.at(std::to_string(i)).value().get().m_Id == i);
+        }
+    }
+
+    SECTION("Probe statistics") {
+        auto statistics = map.getProbeStatistics();
+        std::size_t count = 0;
+        for (std::size_t n : statistics.m_Histogram) {
+            count += n;
+        }
+        REQUIRE(count == map.getSize());
+        REQUIRE(statistics.m_AverageProbeLength >= 1);
+        REQUIRE(statistics.m_Histogram.size() == statistics.m_MaximumProbeLength + 1);
+    }
+
+}
+
+TEST_CASE("RobinHoodMap insert and erase churn") {
+
+    wtl::RobinHoodMap<int, int> map;
+    for (int i = 0; i < 100000; i++) {
+        map.insert(i, i * 2);
+        if (i >= 100) {
+            REQUIRE(map.erase(i - 100) == true);
+        }
+    }
+    REQUIRE(map.getSize() == 100);
+    REQUIRE(map.getBucketCount() == 128);
+    for (int i = 100000 - 100; i < 100000; i++) {
+        REQUIRE(map.at(i).value().get() == i * 2);
+    }
+    REQUIRE(map.contains(0) == false);
+    map.clear();
+    REQUIRE(map.empty() == true);
+    REQUIRE(map.getProbeStatistics().m_MaximumProbeLength == 0);
+}
@@ -0,0 +1,60 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include "RollbackUnionFind.h"
+
+TEST_CASE("Rollback union find") {
+    wtl::RollbackUnionFind uf(8);
+
+    REQUIRE(uf.getSize() == 8);
+    REQUIRE(uf.getSets() == 8);
+
+    REQUIRE(uf.join(0, 1) == true);
+    REQUIRE(uf.join(2, 0) == true);
+    wtl::RollbackUnionFind::Snapshot snapshot = uf.snapshot();
+    REQUIRE(uf.join(3, 5) == true);
+    REQUIRE(uf.join(6, 3) == true);
+    REQUIRE(uf.join(5, 6) == false);
+    REQUIRE(uf.join(4, 4) == false);
+    REQUIRE(uf.join(5, 1) == true);
+
+    REQUIRE(uf.getSets() == 3);
+    REQUIRE(uf.connected(2, 6) == true);
+    REQUIRE(uf.connected(0, 4) == false);
+    REQUIRE(uf.belongs(3) == uf.belongs(1));
+
+    SECTION("Rollback undoes the joins after the snapshot") {
+        uf.rollback(snapshot);
+        REQUIRE(uf.getSets() == 6);
+        REQUIRE(uf.snapshot() == snapshot);
+        REQUIRE(uf.connected(2, 1) == true);
+        REQUIRE(uf.connected(3, 5) == false);
+        REQUIRE(uf.connected(2, 6) == false);
+        REQUIRE(uf.join(3, 5) == true);
+        REQUIRE(uf.connected(3, 5) == true);
+        uf.rollback(0);
+        REQUIRE(uf.getSets() == 8);
+        for (std::size_t i = 1; i < 8; i++) {
+            REQUIRE(uf.connected(0, i) == false);
+        }
+    }
+
+    SECTION("Rollback to the current snapshot does nothing") {
+        uf.rollback(uf.snapshot());
+        REQUIRE(uf.getSets() == 3);
+        REQUIRE(uf.connected(2, 6) == true);
+    }
+
+    SECTION("Invalid arguments throw") {
+        REQUIRE_THROWS_AS(uf.rollback(uf.snapshot() + 1), std::invalid_argument);
+        REQUIRE_THROWS_AS(uf.join(0, 8), std::invalid_argument);
+        REQUIRE_THROWS_AS(uf.belongs(8), std::invalid_argument);
+        REQUIRE_THROWS_AS(wtl::RollbackUnionFind(0), std::invalid_argument);
+    }
+}
@@ -0,0 +1,167 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+#include "SegmentTree.h"
+
+namespace {
+
+    std::uint64_t segmentTreeNext(std::uint64_t& state) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    }
+
+    /**
+     * Apply random range updates and point replacements to a segment tree and to a plain vector, and check that every
+     * range query agrees with a brute force over the vector.
+     */
+    template<typename Monoid, typename LazyOp, typename MakeUpdate, typename ApplyUpdate>
+    void checkSegmentTreeAgainstBruteForce(std::size_t size, MakeUpdate makeUpdate, ApplyUpdate applyUpdate) {
+        std::uint64_t state = size;
+        std::vector<std::int64_t> values(size);
+        for (std::int64_t& value : values) {
+            value = static_cast<std::int64_t>(segmentTreeNext(state) % 200) - 100;
+        }
+        wtl::SegmentTree<std::int64_t, Monoid, LazyOp> tree(values.begin(), values.end());
+        Monoid monoid;
+        for (std::size_t round = 0; round < 200; round++) {
+            std::size_t a = segmentTreeNext(state) % size;
+            std::size_t b = segmentTreeNext(state) % size;
+            std::size_t start = a < b ? a : b;
+            std::size_t end = a < b ? b : a;
+            if (round % 10 == 9) {
+                std::int64_t value = static_cast<std::int64_t>(segmentTreeNext(state) % 200) - 100;
+                tree.replace(start, value);
+                values[start] = value;
+            } else {
+                std::int64_t amount = static_cast<std::int64_t>(segmentTreeNext(state) % 50) - 25;
+                tree.update(start, end, makeUpdate(amount));
+                for (std::size_t i = start; i <= end; i++) {
+                    values[i] = applyUpdate(values[i], amount);
+                }
+            }
+            a = segmentTreeNext(state) % size;
+            b = segmentTreeNext(state) % size;
+            start = a < b ? a : b;
+            end = a < b ? b : a;
+            std::int64_t expected = monoid.identity();
+            for (std::size_t i = start; i <= end; i++) {
+                expected = monoid(expected, values[i]);
+            }
+            REQUIRE(tree.query(start, end) == expected);
+            REQUIRE(tree.retrieve(end) == values[end]);
+        }
+        std::int64_t all = monoid.identity();
+        for (std::int64_t value : values) {
+            all = monoid(all, value);
+        }
+        REQUIRE(tree.queryAll() == all);
+    }
+
+}
+
+TEST_CASE("Segment tree with range updates") {
+    using Sum = wtl::RangeSum<std::int64_t>;
+    using Min = wtl::RangeMin<std::int64_t>;
+    using Max = wtl::RangeMax<std::int64_t>;
+    auto add = [](std::int64_t amount) { return amount; };
+    auto addValue = [](std::int64_t value, std::int64_t amount) { return value + amount; };
+    auto assign = [](std::int64_t amount) { return std::optional<std::int64_t>(amount); };
+    auto assignValue = [](std::int64_t, std::int64_t amount) { return amount; };
+
+    for (std::size_t size : {1, 2, 3, 8, 13, 64, 100}) {
+        checkSegmentTreeAgainstBruteForce<Sum, wtl::RangeAdd<std::int64_t, Sum>>(size, add, addValue);
+        checkSegmentTreeAgainstBruteForce<Min, wtl::RangeAdd<std::int64_t, Min>>(size, add, addValue);
+        checkSegmentTreeAgainstBruteForce<Max, wtl::RangeAdd<std::int64_t, Max>>(size, add, addValue);
+        checkSegmentTreeAgainstBruteForce<Sum, wtl::RangeAssign<std::int64_t, Sum>>(size, assign, assignValue);
+        checkSegmentTreeAgainstBruteForce<Min, wtl::RangeAssign<std::int64_t, Min>>(size, assign, assignValue);
+    }
+}
+
+TEST_CASE("Segment tree operations") {
+    std::vector<double> vector = {5, 2.1, 7, -9.1, 6.6, 2.9, 0, -10.1, -12.3, 4.1, 5.6, -7.9};
+
+    SECTION("Range minimum with range assignment") {
+        wtl::SegmentTree<double, wtl::RangeMin<double>, wtl::RangeAssign<double, wtl::RangeMin<double>>>
+                tree(vector.begin(), vector.end());
+        REQUIRE(tree.getSize() == vector.size());
+        REQUIRE(tree.query(0, 11) == -12.3);
+        REQUIRE(tree.query(4, 6) == 0);
+        tree.update(7, 9, 1.5);
+        REQUIRE(tree.query(0, 11) == -9.1);
+        REQUIRE(tree.query(6, 10) == 0);
+        REQUIRE(tree.retrieve(8) == 1.5);
+    }
+
+    SECTION("Tree of identities") {
+        wtl::SegmentTree<int> tree(10);
+        REQUIRE(tree.queryAll() == 0);
+        tree.update(0, 9, 2);
+        tree.update(3, 5);
+        REQUIRE(tree.query(0, 9) == 25);
+        REQUIRE(tree.query(3, 3) == 7);
+    }
+
+    SECTION("Tree of a value") {
+        // Starting from the identity, the largest int, the first positive add would overflow
+        wtl::SegmentTree<int, wtl::RangeMin<int>> tree(10, 0);
+        REQUIRE(tree.queryAll() == 0);
+        tree.update(0, 9, 2);
+        tree.update(3, 5, -1);
+        REQUIRE(tree.query(0, 9) == 1);
+        REQUIRE(tree.query(6, 9) == 2);
+        REQUIRE(tree.retrieve(4) == 1);
+    }
+
+    SECTION("Invalid range throws") {
+        wtl::SegmentTree<double, wtl::RangeMin<double>> tree(vector.begin(), vector.end());
+        REQUIRE_THROWS_AS(tree.query(5, 4), std::invalid_argument);
+        REQUIRE_THROWS_AS(tree.query(0, 12), std::invalid_argument);
+        REQUIRE_THROWS_AS(tree.update(0, 12, 1.0), std::invalid_argument);
+        REQUIRE_THROWS_AS(tree.maxRight(13, [](double) { return true; }), std::invalid_argument);
+        REQUIRE_THROWS_AS(wtl::SegmentTree<int>(0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Segment tree max right") {
+    std::vector<int> weights = {3, 0, 4, 1, 0, 0, 5, 2, 9};
+    wtl::SegmentTree<int> tree(weights.begin(), weights.end());
+
+    SECTION("Longest prefix whose sum is at most a limit") {
+        for (std::size_t start = 0; start <= weights.size(); start++) {
+            for (int limit = -1; limit <= 25; limit++) {
+                std::size_t expected = start;
+                int sum = 0;
+                while (expected < weights.size() && sum + weights[expected] <= limit) {
+                    sum += weights[expected];
+                    expected++;
+                }
+                if (limit < 0) {
+                    continue;
+                }
+                REQUIRE(tree.maxRight(start, [limit](int value) { return value <= limit; }) == expected);
+            }
+        }
+    }
+
+    SECTION("After range updates") {
+        tree.update(0, 8, 1);
+        REQUIRE(tree.maxRight(0, [](int value) { return value <= 10; }) == 3);
+        REQUIRE(tree.maxRight(2, [](int value) { return value < 100; }) == weights.size());
+    }
+
+    SECTION("First element at least a value, using the maximum") {
+        wtl::SegmentTree<int, wtl::RangeMax<int>> maxTree(weights.begin(), weights.end());
+        REQUIRE(maxTree.maxRight(0, [](int value) { return value < 5; }) == 6);
+        REQUIRE(maxTree.maxRight(7, [](int value) { return value < 5; }) == 8);
+        REQUIRE(maxTree.maxRight(0, [](int value) { return value < 10; }) == weights.size());
+    }
+}
@@ -0,0 +1,241 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "SmallVector.h"
+#include "Stack.h"
+#include "Entity.h"
+#include "AllocationCounter.h"
+
+TEST_CASE("SmallVector test") {
+
+    constexpr int inlineSize = 8;
+    wtl::SmallVector<wtl_test::Entity, inlineSize> vector;
+
+    SECTION("Inline elements") {
+        wtl_test::AllocationCounter counter;
+        for (int i = 0; i < inlineSize; i++) {
+            vector.emplaceBack(i);
+        }
+        REQUIRE(vector.getSize() == inlineSize);
+        REQUIRE(vector.getCapacity() == inlineSize);
+        REQUIRE(vector.isInline() == true);
+        for (int i = 0; i < inlineSize; i++) {
+            REQUIRE(vector.at(i).m_Id == i);
+        }
+        vector.popBack();
+        REQUIRE(counter.getCount() == 0);
+        REQUIRE_THROWS_AS(vector.at(inlineSize - 1), std::out_of_range);
+        vector.clear();
+        REQUIRE(vector.isEmpty() == true);
+    }
+
+    SECTION("Spilling to the heap and back") {
+        constexpr int size = 1000;
+        for (int i = 0; i < size; i++) {
+            vector.pushBack(wtl_test::Entity(i));
+        }
+        REQUIRE(vector.isInline() == false);
+        REQUIRE(vector.getSize() == size);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(vector.at(i).m_Id == i);
+        }
+        while (vector.getSize() > 2) {
+            vector.popBack();
+        }
+        REQUIRE(vector.isInline() == true);
+        REQUIRE(vector.at(0).m_Id == 0);
+        REQUIRE(vector.at(1).m_Id == 1);
+
+        for (int i = 2; i < 20; i++) {
+            vector.emplaceBack(i);
+        }
+        vector.reserve(100);
+        for (int i = 0; i < 15; i++) {
+            vector.popBack();
+        }
+        REQUIRE(vector.isInline() == false);
+        vector.shrinkToFit();
+        REQUIRE(vector.isInline() == true);
+        REQUIRE(vector.getSize() == 5);
+        REQUIRE(vector.at(4).m_Id == 4);
+    }
+
+    SECTION("Moving and copying") {
+        wtl::SmallVector<std::string, 4> small{"a", "b"};
+        wtl::SmallVector<std::string, 4> large{"a", "b", "c", "d", "e", "f"};
+        REQUIRE(small.isInline() == true);
+        REQUIRE(large.isInline() == false);
+
+        wtl::SmallVector<std::string, 4> copy(large);
+        REQUIRE(copy == large);
+        copy = small;
+        REQUIRE(copy == small);
+        REQUIRE(copy.isInline() == true);
+
+        wtl::SmallVector<std::string, 4> movedSmall(std::move(small));
+        REQUIRE(movedSmall == wtl::SmallVector<std::string, 4>{"a", "b"});
+        REQUIRE(small.isEmpty() == true);
+        const std::string* heap = large.data();
+        wtl::SmallVector<std::string, 4> movedLarge(std::move(large));
+        REQUIRE(movedLarge.data() == heap);
+        REQUIRE(movedLarge.getSize() == 6);
+        REQUIRE(large.isEmpty() == true);
+        REQUIRE(large.isInline() == true);
+
+        movedSmall = std::move(movedLarge);
+        REQUIRE(movedSmall.getSize() == 6);
+        REQUIRE(movedSmall.at(5) == "f");
+        movedLarge.pushBack("g");
+        REQUIRE(movedLarge.at(0) == "g");
+    }
+
+    SECTION("Range insertion") {
+        wtl::SmallVector<int, 4> numbers{0, 5};
+        std::list<int> middle{1, 2, 3, 4};
+        numbers.insert(1, middle.begin(), middle.end());
+        std::vector<int> tail{6, 7};
+        numbers.append(tail.begin(), tail.end());
+        REQUIRE(numbers.getSize() == 8);
+        for (int i = 0; i < 8; i++) {
+            REQUIRE(numbers[i] == i);
+        }
+        REQUIRE_THROWS_AS(numbers.insert(9, tail.begin(), tail.end()), std::out_of_range);
+
+        wtl::SmallVector<std::string, 4> strings{"a", "d"};
+        std::vector<std::string> letters{"b", "c"};
+        strings.insert(1, letters.begin(), letters.end());
+        REQUIRE(strings == wtl::SmallVector<std::string, 4>{"a", "b", "c", "d"});
+        REQUIRE(strings.isInline() == true);
+    }
+
+    SECTION("Elements of the vector itself") {
+        wtl::SmallVector<std::string, 4> strings{"a", "b", "c", "d"};
+        // Moves from the inline storage to the heap while the argument is still needed
+        strings.pushBack(strings[0]);
+        REQUIRE(strings.isInline() == false);
+        strings.emplaceBack(strings[1]);
+        strings.insert(1, strings.begin(), strings.begin() + 2);
+        REQUIRE(strings == wtl::SmallVector<std::string, 4>{"a", "a", "b", "b", "c", "d", "a", "b"});
+
+        wtl::SmallVector<int, 4> numbers{0, 1};
+        numbers.insert(0, numbers.begin(), numbers.end());
+        REQUIRE(numbers.isInline() == true);
+        numbers.append(numbers.begin(), numbers.end());
+        numbers.insert(6, numbers.begin() + 1, numbers.begin() + 3);
+        REQUIRE(numbers == wtl::SmallVector<int, 4>{0, 1, 0, 1, 0, 1, 1, 0, 0, 1});
+    }
+
+}
+
+namespace {
+
+    /**
+     * Element whose copies start throwing after s_Countdown more of them succeed. A negative countdown never throws.
+     */
+    struct SmallVectorThrowingElement {
+        static inline int s_Countdown = -1;
+
+        std::string m_Value;
+
+        explicit SmallVectorThrowingElement(std::string value) : m_Value(std::move(value)) {}
+
+        SmallVectorThrowingElement(const SmallVectorThrowingElement& other) : m_Value(other.m_Value) {
+            if (s_Countdown == 0) {
+                s_Countdown = -1;
+                throw std::runtime_error("Countdown");
+            }
+            if (s_Countdown > 0) {
+                s_Countdown--;
+            }
+        }
+
+        SmallVectorThrowingElement(SmallVectorThrowingElement&&) noexcept = default;
+
+        SmallVectorThrowingElement& operator=(const SmallVectorThrowingElement&) = default;
+
+        SmallVectorThrowingElement& operator=(SmallVectorThrowingElement&&) noexcept = default;
+    };
+
+}
+
+TEST_CASE("SmallVector is unchanged when copying an inserted element throws") {
+    using Element = SmallVectorThrowingElement;
+    using Small = wtl::SmallVector<Element, 4>;
+    Small vector;
+    for (int i = 0; i < 3; i++) {
+        vector.emplaceBack(std::string(32, 'x') + std::to_string(i));
+    }
+    std::vector<Element> range(3, Element(std::string(32, 'y')));
+    auto check = [&vector]() {
+        REQUIRE(vector.getSize() == 3);
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(vector.at(i).m_Value == std::string(32, 'x') + std::to_string(i));
+        }
+    };
+
+    // Moving to the heap
+    Element::s_Countdown = 2;
+    REQUIRE_THROWS_AS(vector.insert(1, range.begin(), range.end()), std::runtime_error);
+    check();
+    REQUIRE(vector.isInline() == true);
+
+    // Within the inline storage
+    Element::s_Countdown = 0;
+    REQUIRE_THROWS_AS(vector.insert(1, range.begin(), range.begin() + 1), std::runtime_error);
+    check();
+
+    // Copying a vector on the heap
+    vector.append(range.begin(), range.end());
+    Element::s_Countdown = 4;
+    REQUIRE_THROWS_AS(Small(vector), std::runtime_error);
+}
+
+TEST_CASE("SmallVector as a bucket") {
+
+    SECTION("Adjacency list") {
+        constexpr std::size_t vertexCount = 100;
+        std::vector<wtl::SmallVector<std::size_t, 8>> adjacencyList(vertexCount);
+        wtl_test::AllocationCounter counter;
+        for (std::size_t v = 0; v < vertexCount; v++) {
+            for (std::size_t offset = 1; offset <= 4; offset++) {
+                adjacencyList[v].pushBack((v + offset) % vertexCount);
+            }
+        }
+        REQUIRE(counter.getCount() == 0);
+        std::size_t sum = 0;
+        for (const auto& bucket : adjacencyList) {
+            for (std::size_t neighbour : bucket) {
+                sum += neighbour;
+            }
+        }
+        REQUIRE(sum == 4 * (vertexCount * (vertexCount - 1) / 2));
+    }
+
+    SECTION("Stack") {
+        wtl::Stack<int, wtl::SmallVector<int, 8>> stack;
+        wtl_test::AllocationCounter counter;
+        for (int i = 0; i < 8; i++) {
+            stack.push(i);
+        }
+        for (int i = 0; i < 10000; i++) {
+            stack.pop();
+            stack.push(i);
+        }
+        REQUIRE(stack.peek() == 9999);
+        REQUIRE(counter.getCount() == 0);
+        stack.push(8);
+        REQUIRE(counter.getCount() == 1);
+        REQUIRE(stack.getSize() == 9);
+    }
+
+}
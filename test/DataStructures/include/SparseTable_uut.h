@@ -6,6 +6,9 @@
 
 #include "catch.hpp"
 #include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 #include "SparseTable.h"
 
@@ -47,3 +50,107 @@ TEST_CASE("Operation on max sparse table") {
         REQUIRE(st.query(11, 11) == vector[11]);
     }
 }
+
+namespace {
+
+    struct SparseTableLowestSetBit {
+        unsigned operator()(unsigned lhs, unsigned rhs) const noexcept {
+            return (lhs & -lhs) < (rhs & -rhs) ? lhs : rhs;
+        }
+    };
+
+    template<typename T, typename Combine>
+    T sparseTableBruteForce(const std::vector<T>& vector, std::size_t start, std::size_t end, Combine combine) {
+        T result = vector[start];
+        for (std::size_t i = start + 1; i <= end; i++) {
+            result = combine(result, vector[i]);
+        }
+        return result;
+    }
+
+    template<typename T, typename Combine>
+    void checkSparseTableAgainstBruteForce(const std::vector<T>& vector) {
+        wtl::SparseTable<T, Combine> st(vector.begin(), vector.end());
+        REQUIRE(st.getSize() == vector.size());
+        for (std::size_t i = 0; i < vector.size(); i++) {
+            for (std::size_t j = i; j < vector.size(); j++) {
+                REQUIRE(st.query(i, j) == sparseTableBruteForce(vector, i, j, Combine()));
+            }
+        }
+    }
+
+}
+
+TEST_CASE("Sparse table with compile-time operation") {
+    std::vector<unsigned> vector;
+    unsigned value = 12345;
+    for (std::size_t i = 0; i < 67; i++) {
+        value = value * 1103515245u + 12345u;
+        vector.push_back(((value >> 8) % 1000 + 1) * 6);
+    }
+
+    SECTION("Min and max") {
+        checkSparseTableAgainstBruteForce<unsigned, wtl::RangeMin<unsigned>>(vector);
+        checkSparseTableAgainstBruteForce<unsigned, wtl::RangeMax<unsigned>>(vector);
+    }
+
+    SECTION("Greatest common divisor") {
+        checkSparseTableAgainstBruteForce<unsigned, wtl::RangeGcd<unsigned>>(vector);
+        wtl::SparseTable<unsigned, wtl::RangeGcd<unsigned>> st(vector.begin(), vector.end());
+        REQUIRE(st.query(0, vector.size() - 1) % 6 == 0);
+    }
+
+    SECTION("Bitwise and, or") {
+        checkSparseTableAgainstBruteForce<unsigned, wtl::RangeBitAnd<unsigned>>(vector);
+        checkSparseTableAgainstBruteForce<unsigned, wtl::RangeBitOr<unsigned>>(vector);
+    }
+
+    SECTION("User-defined idempotent operation") {
+        checkSparseTableAgainstBruteForce<unsigned, SparseTableLowestSetBit>(vector);
+    }
+
+    SECTION("Sizes around powers of two") {
+        for (std::size_t size = 1; size <= 33; size++) {
+            std::vector<unsigned> prefix(vector.begin(), vector.begin() + size);
+            checkSparseTableAgainstBruteForce<unsigned, wtl::RangeMin<unsigned>>(prefix);
+        }
+    }
+}
+
+TEST_CASE("Sparse table batch query") {
+    std::vector<int> vector = {5, 2, 7, -9, 6, 2, 0, -10, -12, 4, 5, -7};
+    wtl::SparseTable<int, wtl::RangeMin<int>> st(vector.begin(), vector.end());
+    std::vector<std::pair<std::size_t, std::size_t>> ranges = {{0, 11}, {0, 2}, {4, 6}, {10, 11}, {3, 3}};
+
+    SECTION("Results are in the same order as the queries") {
+        std::vector<int> results = st.query(ranges);
+        REQUIRE(results == std::vector<int>{-12, 2, 0, -7, -9});
+    }
+
+    SECTION("Results are written to an output iterator") {
+        std::vector<int> results;
+        st.query(ranges.begin(), ranges.end(), std::back_inserter(results));
+        REQUIRE(results == std::vector<int>{-12, 2, 0, -7, -9});
+    }
+
+    SECTION("Invalid range throws") {
+        ranges.emplace_back(5, 12);
+        REQUIRE_THROWS_AS(st.query(ranges), std::invalid_argument);
+        REQUIRE_THROWS_AS(st.query(6, 5), std::invalid_argument);
+        REQUIRE_THROWS_AS(st.query(0, 12), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Copy and move sparse table") {
+    std::vector<double> vector = {5, 2.1, 7, -9.1, 6.6, 2.9, 0, -10.1, -12.3, 4.1, 5.6, -7.9};
+    wtl::SparseTable<double> st(vector.begin(), vector.end(), wtl::SparseTable<double>::Operation::MAX);
+
+    wtl::SparseTable<double> copy(st);
+    REQUIRE(copy.getOperation() == wtl::SparseTable<double>::Operation::MAX);
+    REQUIRE(copy.query(3, 9) == 6.6);
+
+    wtl::SparseTable<double> moved(std::move(st));
+    REQUIRE(moved.query(0, 11) == 7);
+    REQUIRE(st.getSize() == 0);
+    REQUIRE_THROWS_AS(st.query(0, 0), std::invalid_argument);
+}
@@ -0,0 +1,180 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SpscQueue.h"
+
+TEST_CASE("SpscQueue test") {
+
+    wtl::SpscQueue<std::string> queue(5);
+    REQUIRE(queue.getCapacity() == 8);
+
+    SECTION("Enqueueing until full") {
+        for (int i = 0; i < 8; i++) {
+            REQUIRE(queue.tryEnqueue(std::to_string(i)) == true);
+        }
+        std::string rejected = "rejected";
+        REQUIRE(queue.tryEnqueue(std::move(rejected)) == false);
+        REQUIRE(rejected == "rejected");
+        REQUIRE(queue.getSize() == 8);
+
+        std::string element;
+        for (int i = 0; i < 8; i++) {
+            REQUIRE(queue.tryDequeue(element) == true);
+            REQUIRE(element == std::to_string(i));
+            REQUIRE(queue.tryEmplace(3, 'x') == true);
+        }
+        REQUIRE(element == "7");
+        REQUIRE(queue.tryDequeue(element) == true);
+        REQUIRE(element == "xxx");
+    }
+
+    SECTION("Batches") {
+        std::vector<std::string> batch{"a", "b", "c", "d", "e"};
+        REQUIRE(queue.tryEnqueueRange(batch.begin(), batch.end()) == 5);
+        REQUIRE(queue.tryEnqueueRange(batch.begin(), batch.end()) == 3);
+        std::vector<std::string> drained;
+        REQUIRE(queue.tryDequeueInto(std::back_inserter(drained), 6) == 6);
+        REQUIRE(queue.tryDequeueInto(std::back_inserter(drained)) == 2);
+        REQUIRE(queue.tryDequeueInto(std::back_inserter(drained)) == 0);
+        REQUIRE(drained == std::vector<std::string>{"a", "b", "c", "d", "e", "a", "b", "c"});
+        REQUIRE(queue.isEmpty() == true);
+    }
+
+    SECTION("Elements left in the queue are destroyed") {
+        auto shared = std::make_shared<int>(1);
+        {
+            wtl::SpscQueue<std::shared_ptr<int>> pointers(4);
+            pointers.tryEnqueue(shared);
+            pointers.tryEnqueue(shared);
+            REQUIRE(shared.use_count() == 3);
+        }
+        REQUIRE(shared.use_count() == 1);
+    }
+
+}
+
+TEST_CASE("SpscQueue with a producer and a consumer thread") {
+
+    constexpr std::size_t count = 200000;
+    wtl::SpscQueue<std::size_t> queue(64);
+
+    std::thread producer([&queue]() {
+        // Alternates single elements with batches, so that both kinds of publish race the consumer.
+        std::vector<std::size_t> batch;
+        for (std::size_t next = 0; next < count;) {
+            if (next % 2 == 0) {
+                while (!queue.tryEnqueue(next)) {
+                    std::this_thread::yield();
+                }
+                next++;
+            } else {
+                batch.clear();
+                for (std::size_t i = next; i < count && i < next + 7; i++) {
+                    batch.push_back(i);
+                }
+                std::size_t enqueued = queue.tryEnqueueRange(batch.begin(), batch.end());
+                if (enqueued == 0) {
+                    std::this_thread::yield();
+                }
+                next += enqueued;
+            }
+        }
+    });
+
+    std::size_t expected = 0;
+    bool ordered = true;
+    std::vector<std::size_t> drained;
+    while (expected < count) {
+        drained.clear();
+        std::size_t element;
+        if (expected % 3 == 0 && queue.tryDequeue(element)) {
+            drained.push_back(element);
+        } else if (queue.tryDequeueInto(std::back_inserter(drained), 16) == 0) {
+            std::this_thread::yield();
+        }
+        for (std::size_t value : drained) {
+            ordered &= value == expected++;
+        }
+    }
+    producer.join();
+    REQUIRE(ordered == true);
+    REQUIRE(queue.isEmpty() == true);
+}
+
+namespace {
+
+    /**
+     * Element whose copies and move assignments start throwing after s_Countdown more of them succeed. A negative
+     * countdown never throws. The value is long enough to live on the heap, so that leaks are noticed.
+     */
+    struct SpscQueueThrowingElement {
+        static inline int s_Countdown = -1;
+
+        std::string m_Value;
+
+        static void tick() {
+            if (s_Countdown == 0) {
+                s_Countdown = -1;
+                throw std::runtime_error("Countdown");
+            }
+            if (s_Countdown > 0) {
+                s_Countdown--;
+            }
+        }
+
+        SpscQueueThrowingElement() = default;
+
+        explicit SpscQueueThrowingElement(int value) : m_Value(std::string(32, 'x') + std::to_string(value)) {}
+
+        SpscQueueThrowingElement(const SpscQueueThrowingElement& other) : m_Value(other.m_Value) {
+            tick();
+        }
+
+        SpscQueueThrowingElement(SpscQueueThrowingElement&&) noexcept = default;
+
+        SpscQueueThrowingElement& operator=(const SpscQueueThrowingElement&) = default;
+
+        SpscQueueThrowingElement& operator=(SpscQueueThrowingElement&& other) {
+            tick();
+            m_Value = std::move(other.m_Value);
+            return *this;
+        }
+
+        bool operator==(const SpscQueueThrowingElement& other) const noexcept {
+            return m_Value == other.m_Value;
+        }
+    };
+
+}
+
+TEST_CASE("SpscQueue is consistent when an element throws") {
+    using Element = SpscQueueThrowingElement;
+    wtl::SpscQueue<Element> queue(8);
+
+    std::vector<Element> batch{Element(1), Element(2), Element(3), Element(4)};
+    Element::s_Countdown = 2;
+    REQUIRE_THROWS_AS(queue.tryEnqueueRange(batch.begin(), batch.end()), std::runtime_error);
+    REQUIRE(queue.isEmpty() == true);
+
+    REQUIRE(queue.tryEnqueueRange(batch.begin(), batch.end()) == 4);
+    Element out[4];
+    Element::s_Countdown = 1;
+    REQUIRE_THROWS_AS(queue.tryDequeueInto(out), std::runtime_error);
+    REQUIRE(out[0] == Element(1));
+    REQUIRE(queue.getSize() == 3);
+    REQUIRE(queue.tryDequeueInto(out) == 3);
+    REQUIRE(out[0] == Element(2));
+    REQUIRE(out[2] == Element(4));
+    REQUIRE(queue.isEmpty() == true);
+}
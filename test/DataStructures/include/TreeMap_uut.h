@@ -0,0 +1,209 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "TreeMap.h"
+#include "Entity.h"
+
+TEST_CASE("TreeMap test") {
+
+    constexpr int size = 1000;
+    wtl::TreeMap<int, wtl_test::Entity> map;
+    // Sorted keys would turn an unbalanced tree into a linked list.
+    for (int i = 0; i < size; i++) {
+        map.insert(i, wtl_test::Entity(i));
+    }
+
+    SECTION("Searching for object") {
+        REQUIRE(map.getSize() == size);
+        REQUIRE(map.getHeight() <= 2 * std::log2(size + 1));
+        for (int i = 0; i < size; i++) {
+            REQUIRE(map.at(i).value().get().m_Id == i);
+        }
+        REQUIRE(map.contains(-1) == false);
+        REQUIRE(map.at(size).has_value() == false);
+    }
+
+    SECTION("Insert or replace") {
+        REQUIRE(map.insert(1, wtl_test::Entity(-1)).second == false);
+        REQUIRE(map.at(1).value().get().m_Id == 1);
+        REQUIRE(map.insertOrReplace(1, wtl_test::Entity(-1)).second == false);
+        REQUIRE(map.at(1).value().get().m_Id == -1);
+        auto[result, inserted] = map.emplace(size, 5);
+        REQUIRE(inserted == true);
+        REQUIRE(result.first.get() == size);
+        REQUIRE(result.second.get().m_Id == 5);
+    }
+
+    SECTION("Iterating") {
+        int expected = 0;
+        for (auto[key, value] : map) {
+            REQUIRE(key == expected);
+            REQUIRE(value.m_Id == expected);
+            value.m_Id = -expected;
+            expected++;
+        }
+        REQUIRE(expected == size);
+        REQUIRE(map.at(10).value().get().m_Id == -10);
+
+        const auto& constMap = map;
+        auto last = std::prev(constMap.end());
+        REQUIRE(last->first == size - 1);
+        REQUIRE(std::distance(constMap.begin(), constMap.end()) == size);
+    }
+
+    SECTION("Bounds and ranges") {
+        wtl::TreeMap<int, int> evens;
+        for (int i = 0; i < 100; i += 2) {
+            evens.insert(i, i * i);
+        }
+        REQUIRE((*evens.lowerBound(10)).first == 10);
+        REQUIRE((*evens.lowerBound(11)).first == 12);
+        REQUIRE((*evens.upperBound(10)).first == 12);
+        REQUIRE(evens.lowerBound(99) == evens.end());
+        REQUIRE(evens.find(7) == evens.end());
+        REQUIRE(evens.find(8)->second == 64);
+
+        std::vector<int> keys;
+        for (auto[key, value] : evens.range(15, 25)) {
+            keys.push_back(key);
+        }
+        REQUIRE(keys == std::vector<int>{16, 18, 20, 22, 24});
+        REQUIRE(evens.range(25, 15).begin() == evens.end());
+    }
+
+    SECTION("Erasing") {
+        for (int i = 0; i < size; i += 2) {
+            REQUIRE(map.erase(i) == true);
+        }
+        REQUIRE(map.erase(0) == false);
+        REQUIRE(map.getSize() == size / 2);
+        REQUIRE(map.getHeight() <= 2 * std::log2(size / 2 + 1));
+        auto iterator = map.erase(map.find(1));
+        REQUIRE(iterator->first == 3);
+        int expected = 3;
+        for (auto[key, value] : map) {
+            REQUIRE(key == expected);
+            expected += 2;
+        }
+    }
+
+    SECTION("Copying and moving") {
+        wtl::TreeMap<int, wtl_test::Entity> copy(map);
+        map.erase(0);
+        REQUIRE(copy.getSize() == size);
+        REQUIRE(copy.at(0).value().get().m_Id == 0);
+
+        wtl::TreeMap<int, wtl_test::Entity> moved(std::move(copy));
+        REQUIRE(moved.getSize() == size);
+        REQUIRE(copy.empty() == true);
+        copy = moved;
+        moved = std::move(map);
+        REQUIRE(moved.getSize() == size - 1);
+        REQUIRE(map.empty() == true);
+        REQUIRE(copy.getSize() == size);
+    }
+
+    SECTION("Draining") {
+        wtl::TreeMap<std::string, std::string> strings;
+        strings.insert("b", "2");
+        strings.insert("a", "1");
+        strings.insert("c", "3");
+        std::string order;
+        strings.drain([&order](std::string&& key, std::string&& value) {
+            order += std::move(key) + std::move(value);
+        });
+        REQUIRE(order == "a1b2c3");
+        REQUIRE(strings.empty() == true);
+    }
+
+}
+
+TEST_CASE("TreeMap against std::map") {
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> keys(0, 2000);
+    wtl::TreeMap<int, int, std::greater<int>, wtl::HeapNodeAllocator> map;
+    std::map<int, int, std::greater<int>> expected;
+
+    for (int i = 0; i < 20000; i++) {
+        int key = keys(generator);
+        if (i % 3 == 0) {
+            REQUIRE(map.erase(key) == (expected.erase(key) == 1));
+        } else {
+            REQUIRE(map.insertOrReplace(key, i).second == expected.insert_or_assign(key, i).second);
+        }
+    }
+    REQUIRE(map.getSize() == expected.size());
+    REQUIRE(map.getHeight() <= 2 * std::log2(map.getSize() + 1));
+    auto iterator = expected.begin();
+    for (auto[key, value] : map) {
+        REQUIRE(key == iterator->first);
+        REQUIRE(value == iterator->second);
+        ++iterator;
+    }
+}
+
+namespace {
+
+    struct TreeMapThrowingValue {
+        static inline int s_Countdown = -1;
+
+        std::string m_Value;
+
+        explicit TreeMapThrowingValue(std::string value) : m_Value(std::move(value)) {}
+
+        TreeMapThrowingValue(const TreeMapThrowingValue& other) : m_Value(other.m_Value) {
+            if (s_Countdown == 0) {
+                s_Countdown = -1;
+                throw std::runtime_error("Countdown");
+            }
+            if (s_Countdown > 0) {
+                s_Countdown--;
+            }
+        }
+
+        TreeMapThrowingValue& operator=(const TreeMapThrowingValue&) = default;
+    };
+
+}
+
+TEST_CASE("TreeMap is unchanged when copying a value throws") {
+    using Map = wtl::TreeMap<int, TreeMapThrowingValue>;
+    using HeapMap = wtl::TreeMap<int, TreeMapThrowingValue, wtl::impl::ds::StandardComparator<int>,
+                                  wtl::HeapNodeAllocator>;
+    Map map;
+    HeapMap heapMap;
+    for (int i = 0; i < 100; i++) {
+        map.emplace(i, std::string(32, 'x') + std::to_string(i));
+        heapMap.emplace(i, std::string(32, 'x') + std::to_string(i));
+    }
+
+    TreeMapThrowingValue::s_Countdown = 50;
+    REQUIRE_THROWS_AS(Map(map), std::runtime_error);
+    TreeMapThrowingValue::s_Countdown = 50;
+    REQUIRE_THROWS_AS(HeapMap(heapMap), std::runtime_error);
+
+    Map target;
+    target.emplace(-1, "target");
+    TreeMapThrowingValue::s_Countdown = 50;
+    REQUIRE_THROWS_AS(target = map, std::runtime_error);
+    REQUIRE(target.getSize() == 1);
+    REQUIRE(target.begin()->second.m_Value == "target");
+
+    target = map;
+    REQUIRE(target.getSize() == 100);
+    REQUIRE(target.at(99).value().get().m_Value == std::string(32, 'x') + "99");
+}
@@ -0,0 +1,96 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "UnorderedMap.h"
+#include "StringHash.h"
+#include "Entity.h"
+
+TEST_CASE("Unordered map test") {
+
+    constexpr int size = 100;
+    wtl::UnorderedMap<std::string, wtl_test::Entity> map;
+    for (int i = 0; i < size; i++) {
+        map.insert(std::to_string(i), wtl_test::Entity(i));
+    }
+
+    SECTION("Searching for object") {
+        REQUIRE(map.getSize() == size);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(map.at(std::to_string(i)).value().get().m_Id == i);
+        }
+        REQUIRE(map.contains("-1") == false);
+    }
+
+    SECTION("Insert or replace") {
+        REQUIRE(map.insertOrReplace("1", wtl_test::Entity(-1)).second == false);
+        REQUIRE(map.at("1").value().get().m_Id == -1);
+        auto[result, inserted] = map.insertOrReplace("new", wtl_test::Entity(5));
+        REQUIRE(inserted == true);
+        REQUIRE(result.second.get().m_Id == 5);
+    }
+
+    SECTION("Rehashing keeps elements in place") {
+        // Nodes are moved between buckets, not reallocated, so references survive rehashing
+        wtl_test::Entity& entity = map.at("42").value().get();
+        std::size_t bucketCount = map.getBucketCount();
+        map.reserve(size * 20);
+        REQUIRE(map.getBucketCount() >= size * 20);
+        REQUIRE(map.getBucketCount() > bucketCount);
+        REQUIRE(&map.at("42").value().get() == &entity);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(map.at(std::to_string(i)).value().get().m_Id == i);
+        }
+        REQUIRE(map.shrinkToFit() == true);
+        REQUIRE(&map.at("42").value().get() == &entity);
+    }
+
+}
+
+TEST_CASE("Unordered map range insertion") {
+
+    std::map<int, int> source;
+    for (int i = 0; i < 1000; i++) {
+        source.insert({i, i * 3});
+    }
+    wtl::UnorderedMap<int, int> map;
+    map.insert(0, -1);
+    REQUIRE(map.insertRange(source.begin(), source.end()) == 999);
+    REQUIRE(map.getSize() == 1000);
+    REQUIRE(map.getLoadFactor() <= 1);
+    REQUIRE(map.at(0).value().get() == -1);
+    for (int i = 1; i < 1000; i++) {
+        REQUIRE(map.at(i).value().get() == i * 3);
+    }
+}
+
+TEST_CASE("Unordered map heterogeneous lookup") {
+
+    wtl::UnorderedMap<std::string, int, wtl::StringHash> map;
+    for (int i = 0; i < 100; i++) {
+        map.insert(std::to_string(i), i);
+    }
+    // std::string_view is not implicitly convertible to std::string, so these only compile with the
+    // heterogeneous overloads.
+    std::string buffer = "key 42 value";
+    std::string_view key = std::string_view(buffer).substr(4, 2);
+    REQUIRE(map.at(key).value().get() == 42);
+    REQUIRE(map.contains(key) == true);
+    REQUIRE(map.contains(std::string_view("100")) == false);
+    REQUIRE(map.at("7").value().get() == 7);
+    const auto& constMap = map;
+    REQUIRE(constMap.at(key).value().get() == 42);
+    REQUIRE(map.erase(key) == true);
+    REQUIRE(map.erase(key) == false);
+    REQUIRE(map.contains(std::string("42")) == false);
+    REQUIRE(map.getSize() == 99);
+}
@@ -7,9 +7,11 @@
 #include "catch.hpp"
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 #include "UnorderedSet.h"
+#include "StringHash.h"
 
 TEST_CASE("Unordered set test") {
     wtl::UnorderedSet<std::string> unorderedSet;
@@ -53,4 +55,33 @@ TEST_CASE("Unordered set test") {
         REQUIRE(unorderedSet.find("Mary") == std::nullopt);
     }
 
+    SECTION("Reserving and inserting a range") {
+        std::vector<std::string> more;
+        for (std::size_t i = 0; i < 200; i++) {
+            more.push_back(std::to_string(i));
+        }
+        more.push_back(names[0]);
+        const std::string& amy = unorderedSet.find(names[0]).value().get();
+        REQUIRE(unorderedSet.insertRange(more.begin(), more.end()) == 200);
+        REQUIRE(unorderedSet.getSize() == names.size() + 200);
+        REQUIRE(unorderedSet.getLoadFactor() <= 1);
+        REQUIRE(&unorderedSet.find(names[0]).value().get() == &amy);
+        for (std::string& name : more) {
+            REQUIRE(unorderedSet.contains(name) == true);
+        }
+    }
+
+}
+
+TEST_CASE("Unordered set heterogeneous lookup") {
+
+    wtl::UnorderedSet<std::string, wtl::StringHash> unorderedSet;
+    unorderedSet.insert("alpha");
+    unorderedSet.insert("beta");
+    std::string_view beta = "beta";
+    REQUIRE(unorderedSet.find(beta).value().get() == "beta");
+    REQUIRE(unorderedSet.contains(std::string_view("gamma")) == false);
+    REQUIRE(unorderedSet.erase(beta) == true);
+    REQUIRE(unorderedSet.contains(beta) == false);
+    REQUIRE(unorderedSet.getSize() == 1);
 }
@@ -0,0 +1,230 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Vector.h"
+#include "Stack.h"
+#include "Entity.h"
+#include "AllocationCounter.h"
+
+TEST_CASE("Vector test") {
+
+    constexpr int size = 1000;
+    wtl::Vector<wtl_test::Entity> vector;
+    for (int i = 0; i < size; i++) {
+        vector.emplaceBack(i);
+    }
+
+    SECTION("Accessing elements") {
+        REQUIRE(vector.getSize() == size);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(vector.at(i).m_Id == i);
+        }
+        REQUIRE_THROWS_AS(vector.at(size), std::out_of_range);
+    }
+
+    SECTION("Moving") {
+        wtl::Vector<wtl_test::Entity> moved(std::move(vector));
+        REQUIRE(moved.getSize() == size);
+        REQUIRE(moved.at(size - 1).m_Id == size - 1);
+        REQUIRE(vector.isEmpty() == true);
+        REQUIRE(vector.getCapacity() == 0);
+        vector.pushBack(wtl_test::Entity(7));
+        REQUIRE(vector.at(0).m_Id == 7);
+        vector = std::move(moved);
+        REQUIRE(vector.getSize() == size);
+        REQUIRE(moved.isEmpty() == true);
+    }
+
+    SECTION("Removing elements") {
+        for (int i = 0; i < size - 10; i++) {
+            vector.popBack();
+        }
+        REQUIRE(vector.getSize() == 10);
+        REQUIRE(vector.getCapacity() >= 10);
+        REQUIRE(vector.getCapacity() <= 40);
+        for (int i = 0; i < 10; i++) {
+            REQUIRE(vector.at(i).m_Id == i);
+        }
+    }
+
+}
+
+TEST_CASE("Vector range insertion") {
+
+    SECTION("Trivially copyable elements") {
+        wtl::Vector<int> vector{0, 1, 2, 7, 8, 9};
+        std::list<int> middle{3, 4, 5, 6};
+        vector.insert(3, middle.begin(), middle.end());
+        std::vector<int> tail{10, 11};
+        vector.append(tail.begin(), tail.end());
+        REQUIRE(vector.getSize() == 12);
+        for (int i = 0; i < 12; i++) {
+            REQUIRE(vector.at(i) == i);
+        }
+        REQUIRE_THROWS_AS(vector.insert(13, tail.begin(), tail.end()), std::out_of_range);
+    }
+
+    SECTION("Other elements") {
+        wtl::Vector<std::string> vector{"a", "e"};
+        std::vector<std::string> middle{"b", "c", "d"};
+        vector.insert(1, middle.begin(), middle.end());
+        std::istringstream stream("f g");
+        vector.append(std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>());
+        std::istringstream front("0");
+        vector.insert(0, std::istream_iterator<std::string>(front), std::istream_iterator<std::string>());
+        REQUIRE(vector == wtl::Vector<std::string>{"0", "a", "b", "c", "d", "e", "f", "g"});
+    }
+
+    SECTION("Elements of the vector itself") {
+        // In place, then growing twice, then in place again
+        wtl::Vector<int> numbers{0, 1, 2, 3};
+        numbers.insert(1, numbers.begin(), numbers.end());
+        REQUIRE(numbers == wtl::Vector<int>{0, 0, 1, 2, 3, 1, 2, 3});
+        numbers.insert(2, numbers.begin() + 4, numbers.end());
+        numbers.insert(0, numbers.begin() + 10, numbers.end());
+        numbers.append(numbers.begin(), numbers.begin() + 2);
+        // The range comes before the elements that are shifted
+        numbers.insert(10, numbers.begin(), numbers.begin() + 2);
+        REQUIRE(numbers == wtl::Vector<int>{2, 3, 0, 0, 3, 1, 2, 3, 1, 2, 2, 3, 3, 1, 2, 3, 2, 3});
+
+        wtl::Vector<std::string> strings{"a", "b"};
+        strings.insert(1, strings.begin(), strings.end());
+        REQUIRE(strings == wtl::Vector<std::string>{"a", "a", "b", "b"});
+        strings.reserve(16);
+        strings.insert(0, strings.begin() + 2, strings.end());
+        strings.pushBack(strings.at(0));
+        REQUIRE(strings == wtl::Vector<std::string>{"b", "b", "a", "a", "b", "b", "b"});
+        strings.shrinkToFit();
+        strings.emplaceBack(strings.at(2));
+        REQUIRE(strings.at(7) == "a");
+    }
+
+}
+
+namespace {
+
+    /**
+     * Element whose copies start throwing after s_Countdown more of them succeed. A negative countdown never throws.
+     */
+    struct VectorThrowingElement {
+        static inline int s_Countdown = -1;
+
+        std::string m_Value;
+
+        explicit VectorThrowingElement(std::string value) : m_Value(std::move(value)) {}
+
+        VectorThrowingElement(const VectorThrowingElement& other) : m_Value(other.m_Value) {
+            if (s_Countdown == 0) {
+                s_Countdown = -1;
+                throw std::runtime_error("Countdown");
+            }
+            if (s_Countdown > 0) {
+                s_Countdown--;
+            }
+        }
+
+        VectorThrowingElement(VectorThrowingElement&&) noexcept = default;
+
+        VectorThrowingElement& operator=(const VectorThrowingElement&) = default;
+
+        VectorThrowingElement& operator=(VectorThrowingElement&&) noexcept = default;
+    };
+
+}
+
+TEST_CASE("Vector is unchanged when copying an inserted element throws") {
+    using Element = VectorThrowingElement;
+    wtl::Vector<Element> vector;
+    for (int i = 0; i < 6; i++) {
+        vector.emplaceBack(std::string(32, 'x') + std::to_string(i));
+    }
+    std::vector<Element> range(3, Element(std::string(32, 'y')));
+    auto check = [&vector]() {
+        REQUIRE(vector.getSize() == 6);
+        for (int i = 0; i < 6; i++) {
+            REQUIRE(vector.at(i).m_Value == std::string(32, 'x') + std::to_string(i));
+        }
+    };
+
+    // Growing the storage
+    Element::s_Countdown = 1;
+    REQUIRE_THROWS_AS(vector.insert(2, range.begin(), range.end()), std::runtime_error);
+    check();
+
+    // Within the existing storage
+    vector.reserve(16);
+    Element::s_Countdown = 2;
+    REQUIRE_THROWS_AS(vector.insert(2, range.begin(), range.end()), std::runtime_error);
+    check();
+    Element::s_Countdown = 1;
+    REQUIRE_THROWS_AS(vector.append(range.begin(), range.end()), std::runtime_error);
+    check();
+}
+
+TEST_CASE("Vector allocations") {
+
+    SECTION("Reserving") {
+        wtl::Vector<int> vector;
+        vector.reserve(1000);
+        REQUIRE(vector.getCapacity() >= 1000);
+        wtl_test::AllocationCounter counter;
+        for (int i = 0; i < 1000; i++) {
+            vector.pushBack(i);
+        }
+        REQUIRE(counter.getCount() == 0);
+    }
+
+    SECTION("Pushing and popping at every size") {
+        // Four pushes followed by four pops, starting from every size, so that every capacity boundary is crossed.
+        // Shrinking as soon as the vector is half full would reallocate on every round near some of the boundaries.
+        wtl::Vector<std::string> vector;
+        auto round = [&vector]() {
+            for (int i = 0; i < 4; i++) {
+                vector.pushBack("x");
+            }
+            for (int i = 0; i < 4; i++) {
+                vector.popBack();
+            }
+        };
+        for (int size = 0; size < 300; size++) {
+            vector.pushBack("element");
+            round();
+            wtl_test::AllocationCounter counter;
+            for (int i = 0; i < 100; i++) {
+                round();
+            }
+            REQUIRE(counter.getCount() == 0);
+        }
+    }
+
+    SECTION("Stack") {
+        wtl::Stack<int> stack;
+        wtl_test::AllocationCounter counter;
+        for (int i = 0; i < 64; i++) {
+            stack.push(i);
+        }
+        std::size_t growth = counter.getCount();
+        for (int i = 0; i < 10000; i++) {
+            stack.push(i);
+            stack.pop();
+            stack.pop();
+            stack.push(i);
+        }
+        REQUIRE(counter.getCount() == growth);
+        wtl::Stack<int> moved(std::move(stack));
+        REQUIRE(moved.getSize() == 64);
+    }
+
+}
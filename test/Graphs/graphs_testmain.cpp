@@ -22,5 +22,6 @@
 // #include "Graphs/BellmanFord_uut.h"
 #include "include/Tarjan_uut.h"
 #include "include/FloydWarshall_uut.h"
+#include "include/OfflineDynamicConnectivity_uut.h"
 
 #endif // !CATCH_CONFIG_MAIN
\ No newline at end of file
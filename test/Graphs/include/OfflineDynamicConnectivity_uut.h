@@ -0,0 +1,77 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include "catch.hpp"
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "OfflineDynamicConnectivity.h"
+#include "UnionFind.h"
+
+TEST_CASE("Offline dynamic connectivity") {
+    using Query = wtl::OfflineDynamicConnectivity::Query;
+
+    SECTION("Small graph") {
+        wtl::OfflineDynamicConnectivity dc(5);
+        dc.addEdge(0, 1);     // time 1
+        dc.addEdge(1, 2);     // time 2
+        dc.addEdge(2, 1);     // time 3, a second copy
+        dc.removeEdge(1, 2);  // time 4
+        dc.removeEdge(0, 1);  // time 5
+        dc.removeEdge(2, 1);  // time 6
+        dc.addEdge(3, 3);     // time 7
+        REQUIRE(dc.getTime() == 7);
+
+        std::vector<bool> results = dc.solve({{0, 0, 1}, {1, 0, 1}, {1, 0, 2}, {2, 2, 0}, {4, 0, 2}, {5, 1, 2},
+                                              {5, 0, 1}, {6, 1, 2}, {7, 3, 3}, {7, 3, 4}});
+        REQUIRE(results == std::vector<bool>{false, true, false, true, true, true, false, false, true, false});
+        REQUIRE(dc.solve({}).empty());
+
+        REQUIRE_THROWS_AS(dc.removeEdge(0, 1), std::invalid_argument);
+        REQUIRE_THROWS_AS(dc.addEdge(0, 5), std::invalid_argument);
+        REQUIRE_THROWS_AS(dc.solve({{8, 0, 1}}), std::invalid_argument);
+        REQUIRE_THROWS_AS(dc.solve({{7, 0, 5}}), std::invalid_argument);
+    }
+
+    SECTION("Matches a union find rebuilt at every time") {
+        constexpr std::size_t size = 30;
+        constexpr std::size_t eventCount = 300;
+        std::mt19937 generator(3);
+        std::uniform_int_distribution<std::size_t> nodes(0, size - 1);
+
+        wtl::OfflineDynamicConnectivity dc(size);
+        std::vector<std::pair<std::size_t, std::size_t>> alive;
+        std::vector<Query> queries;
+        std::vector<bool> expected;
+        for (std::size_t time = 0; time <= eventCount; time++) {
+            if (time > 0) {
+                if (!alive.empty() && generator() % 3 == 0) {
+                    std::size_t index = generator() % alive.size();
+                    dc.removeEdge(alive[index].first, alive[index].second);
+                    alive.erase(alive.begin() + static_cast<std::ptrdiff_t>(index));
+                } else {
+                    alive.emplace_back(nodes(generator), nodes(generator));
+                    dc.addEdge(alive.back().first, alive.back().second);
+                }
+            }
+            wtl::UnionFind uf(size);
+            for (const auto& edge : alive) {
+                uf.join(edge.first, edge.second);
+            }
+            for (std::size_t i = 0; i < 3; i++) {
+                queries.push_back({time, nodes(generator), nodes(generator)});
+                expected.push_back(uf.connected(queries.back().node1, queries.back().node2));
+            }
+        }
+        // Solving answers the queries regardless of their order
+        std::vector<Query> reversed(queries.rbegin(), queries.rend());
+        std::vector<bool> reversedExpected(expected.rbegin(), expected.rend());
+        REQUIRE(dc.solve(queries) == expected);
+        REQUIRE(dc.solve(reversed) == reversedExpected);
+    }
+}
@@ -54,6 +54,11 @@ TEST_CASE("Sorting integer types in ascending order") {
         REQUIRE(vector == sortedVector);
     }
 
+    SECTION("HeapSort with a 4-ary heap") {
+        wtl::HeapSort<int, wtl::impl::sort::StandardComparator<int>, 4>::sort(vector);
+        REQUIRE(vector == sortedVector);
+    }
+
     SECTION("InsertionSort") {
         wtl::InsertionSort<int>::sort(vector);
         REQUIRE(vector == sortedVector);
@@ -0,0 +1,101 @@
+//
+// Created by Nicholas on 16 Oct 2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*
+ * Replaces the global operator new and operator delete, so that tests can count allocations.
+ * Must only be included in a single translation unit of a test executable.
+ */
+
+namespace wtl_test {
+
+    /**
+     * Number of calls to the global operator new since the program started.
+     * @return
+     */
+    inline std::atomic<std::size_t>& allocationCount() noexcept {
+        static std::atomic<std::size_t> count{0};
+        return count;
+    }
+
+    /**
+     * Counts the allocations made between its construction and a call to getCount().
+     */
+    class AllocationCounter {
+    private:
+
+        std::size_t m_Start;
+
+    public:
+
+        AllocationCounter() noexcept : m_Start(allocationCount().load()) {}
+
+        /**
+         * Get the number of allocations since construction.
+         * @return
+         */
+        [[nodiscard]] std::size_t getCount() const noexcept {
+            return allocationCount().load() - m_Start;
+        }
+    };
+
+}
+
+// Keep GCC from inlining the replacements, after which it would warn about free() on memory from operator new.
+#if defined(__GNUC__)
+#define WTL_TEST_NOINLINE __attribute__((noinline))
+#else
+#define WTL_TEST_NOINLINE
+#endif
+
+WTL_TEST_NOINLINE void* operator new(std::size_t size) {
+    ++wtl_test::allocationCount();
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+WTL_TEST_NOINLINE void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+WTL_TEST_NOINLINE void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    ++wtl_test::allocationCount();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+WTL_TEST_NOINLINE void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+WTL_TEST_NOINLINE void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+WTL_TEST_NOINLINE void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+WTL_TEST_NOINLINE void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+WTL_TEST_NOINLINE void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+WTL_TEST_NOINLINE void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+WTL_TEST_NOINLINE void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}